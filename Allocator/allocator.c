@@ -0,0 +1,154 @@
+/**
+ * @file allocator.c
+ *
+ * Implementation for a pluggable memory allocator.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "allocator.h"
+
+/**
+ * Allocate memory from the C library.
+ *
+ * @param ctx unused
+ * @param size the number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *defaultMalloc(void *ctx, size_t size) {
+    return malloc(size);
+}
+
+/**
+ * Resize memory from the C library.
+ *
+ * @param ctx unused
+ * @param ptr the memory to resize
+ * @param oldSize unused
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *defaultRealloc(void *ctx, void *ptr, size_t oldSize, size_t newSize) {
+    return realloc(ptr, newSize);
+}
+
+/**
+ * Free memory from the C library.
+ *
+ * @param ctx unused
+ * @param ptr the memory to free
+ * @param size unused
+ */
+static void defaultFree(void *ctx, void *ptr, size_t size) {
+    free(ptr);
+}
+
+/**
+ * Copy a string using the C library.
+ *
+ * @param ctx unused
+ * @param str the string to copy
+ * @param len the length of the string
+ * @return the copy
+ */
+static char *defaultStrndup(void *ctx, const char *str, size_t len) {
+    return strndup(str, len);
+}
+
+/** Allocator that forwards to the C library */
+const Allocator defaultAllocator = {
+    defaultMalloc, defaultRealloc, defaultFree, defaultStrndup, NULL
+};
+
+/**
+ * Returns the allocator, or the default allocator if NULL.
+ *
+ * @param allocator the allocator or NULL
+ * @return the allocator to use
+ */
+const Allocator *useAllocator(const Allocator *allocator) {
+    return (allocator == NULL) ? &defaultAllocator : allocator;
+}
+
+/**
+ * Allocate memory.
+ *
+ * @param allocator the allocator
+ * @param size the number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+void *allocatorMalloc(const Allocator *allocator, size_t size) {
+    return allocator->mallocFn(allocator->ctx, size);
+}
+
+/**
+ * Allocate zeroed memory for an array.
+ *
+ * @param allocator the allocator
+ * @param count the number of elements
+ * @param size the size of an element
+ * @return the memory, or NULL if out of memory or count * size
+ *   overflows
+ */
+void *allocatorCalloc(const Allocator *allocator, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = allocator->mallocFn(allocator->ctx, count * size);
+    if (ptr != NULL) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+/**
+ * Resize memory.
+ *
+ * @param allocator the allocator
+ * @param ptr the memory to resize
+ * @param oldSize the current number of bytes
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+void *allocatorRealloc(const Allocator *allocator, void *ptr, size_t oldSize, size_t newSize) {
+    return allocator->reallocFn(allocator->ctx, ptr, oldSize, newSize);
+}
+
+/**
+ * Free memory.
+ *
+ * @param allocator the allocator
+ * @param ptr the memory to free; may be NULL
+ * @param size the number of bytes
+ */
+void allocatorFree(const Allocator *allocator, void *ptr, size_t size) {
+    if (ptr != NULL) {
+        allocator->freeFn(allocator->ctx, ptr, size);
+    }
+}
+
+/**
+ * Copy a string.
+ *
+ * @param allocator the allocator
+ * @param str the string to copy
+ * @return the copy
+ */
+char *allocatorStrdup(const Allocator *allocator, const char *str) {
+    return allocator->strndupFn(allocator->ctx, str, strlen(str));
+}
+
+/**
+ * Free a string allocated by allocatorStrdup.
+ *
+ * @param allocator the allocator
+ * @param str the string to free; may be NULL
+ */
+void allocatorFreeStr(const Allocator *allocator, char *str) {
+    if (str != NULL) {
+        allocator->freeFn(allocator->ctx, str, strlen(str) + 1);
+    }
+}
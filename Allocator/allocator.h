@@ -0,0 +1,107 @@
+/**
+ * @file allocator.h
+ *
+ * Declarations for a pluggable memory allocator.
+ *
+ * An Allocator is a table of functions and a context pointer that
+ * is passed to each function. Every container constructor accepts
+ * an allocator, and routes all of the container's allocations
+ * through it; passing NULL selects defaultAllocator, which forwards
+ * to the C library.
+ *
+ * The size of each block is passed to realloc and free, so arenas
+ * and size-class allocators do not need to record it.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ALLOCATOR_H_
+#define ALLOCATOR_H_
+
+#include <stdlib.h>
+
+/** Allocator function table */
+typedef struct {
+    /** allocate size bytes; returns NULL if out of memory */
+    void *(*mallocFn)(void *ctx, size_t size);
+    /** resize block of oldSize bytes to newSize bytes; returns NULL
+        and leaves block unchanged if out of memory */
+    void *(*reallocFn)(void *ctx, void *ptr, size_t oldSize, size_t newSize);
+    /** free block of size bytes; ptr may be NULL */
+    void (*freeFn)(void *ctx, void *ptr, size_t size);
+    /** copy len characters of str to a new string of len+1 bytes */
+    char *(*strndupFn)(void *ctx, const char *str, size_t len);
+    /** context passed to each function */
+    void *ctx;
+} Allocator;
+
+/** Allocator that forwards to the C library */
+extern const Allocator defaultAllocator;
+
+/**
+ * Returns the allocator, or the default allocator if NULL.
+ *
+ * @param allocator the allocator or NULL
+ * @return the allocator to use
+ */
+const Allocator *useAllocator(const Allocator *allocator);
+
+/**
+ * Allocate memory.
+ *
+ * @param allocator the allocator
+ * @param size the number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+void *allocatorMalloc(const Allocator *allocator, size_t size);
+
+/**
+ * Allocate zeroed memory for an array.
+ *
+ * @param allocator the allocator
+ * @param count the number of elements
+ * @param size the size of an element
+ * @return the memory, or NULL if out of memory or count * size
+ *   overflows
+ */
+void *allocatorCalloc(const Allocator *allocator, size_t count, size_t size);
+
+/**
+ * Resize memory.
+ *
+ * @param allocator the allocator
+ * @param ptr the memory to resize
+ * @param oldSize the current number of bytes
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+void *allocatorRealloc(const Allocator *allocator, void *ptr, size_t oldSize, size_t newSize);
+
+/**
+ * Free memory.
+ *
+ * @param allocator the allocator
+ * @param ptr the memory to free; may be NULL
+ * @param size the number of bytes
+ */
+void allocatorFree(const Allocator *allocator, void *ptr, size_t size);
+
+/**
+ * Copy a string.
+ *
+ * @param allocator the allocator
+ * @param str the string to copy
+ * @return the copy
+ */
+char *allocatorStrdup(const Allocator *allocator, const char *str);
+
+/**
+ * Free a string allocated by allocatorStrdup.
+ *
+ * @param allocator the allocator
+ * @param str the string to free; may be NULL
+ */
+void allocatorFreeStr(const Allocator *allocator, char *str);
+
+#endif /* ALLOCATOR_H_ */
@@ -0,0 +1,249 @@
+/*
+ * @file allocator_main.c
+ *
+ * Test program for containers with pluggable allocators.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "allocator.h"
+#include "array_list.h"
+#include "array_queue.h"
+#include "array_stack.h"
+#include "linked_stack.h"
+#include "messagepriorityqueue.h"
+
+/** Allocation counts of a counting allocator */
+typedef struct {
+    /** number of blocks allocated */
+    size_t allocs;
+    /** number of blocks freed */
+    size_t frees;
+    /** number of reallocs */
+    size_t reallocs;
+    /** bytes currently allocated */
+    size_t liveBytes;
+} AllocCounts;
+
+/**
+ * Allocate memory and count the allocation.
+ *
+ * @param ctx the AllocCounts
+ * @param size the number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *countingMalloc(void *ctx, size_t size) {
+    AllocCounts *counts = ctx;
+    counts->allocs++;
+    counts->liveBytes += size;
+    return malloc(size);
+}
+
+/**
+ * Resize memory and count the reallocation.
+ *
+ * @param ctx the AllocCounts
+ * @param ptr the memory to resize
+ * @param oldSize the current number of bytes
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *countingRealloc(void *ctx, void *ptr, size_t oldSize, size_t newSize) {
+    AllocCounts *counts = ctx;
+    void *newPtr = realloc(ptr, newSize);
+    if (newPtr != NULL) {
+        counts->reallocs++;
+        counts->liveBytes += newSize - oldSize;
+    }
+    return newPtr;
+}
+
+/**
+ * Free memory and count the free.
+ *
+ * @param ctx the AllocCounts
+ * @param ptr the memory to free
+ * @param size the number of bytes
+ */
+static void countingFree(void *ctx, void *ptr, size_t size) {
+    AllocCounts *counts = ctx;
+    counts->frees++;
+    counts->liveBytes -= size;
+    free(ptr);
+}
+
+/**
+ * Copy a string and count the allocation.
+ *
+ * @param ctx the AllocCounts
+ * @param str the string to copy
+ * @param len the length of the string
+ * @return the copy
+ */
+static char *countingStrndup(void *ctx, const char *str, size_t len) {
+    char *copy = countingMalloc(ctx, len + 1);
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+/** Bump-pointer arena; individual frees are ignored */
+typedef struct {
+    /** arena storage */
+    char *base;
+    /** bytes used */
+    size_t used;
+    /** bytes available */
+    size_t capacity;
+} Arena;
+
+/**
+ * Allocate memory from the arena.
+ *
+ * @param ctx the Arena
+ * @param size the number of bytes
+ * @return the memory, or NULL if the arena is full
+ */
+static void *arenaMalloc(void *ctx, size_t size) {
+    Arena *arena = ctx;
+    size = (size + 15) & ~(size_t)15;  // keep 16-byte alignment
+    if (arena->capacity - arena->used < size) {
+        return NULL;
+    }
+    void *ptr = arena->base + arena->used;
+    arena->used += size;
+    return ptr;
+}
+
+/**
+ * Resize memory by copying to a new arena block.
+ *
+ * @param ctx the Arena
+ * @param ptr the memory to resize
+ * @param oldSize the current number of bytes
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if the arena is full
+ */
+static void *arenaRealloc(void *ctx, void *ptr, size_t oldSize, size_t newSize) {
+    void *newPtr = arenaMalloc(ctx, newSize);
+    if (newPtr != NULL && ptr != NULL) {
+        memcpy(newPtr, ptr, (oldSize < newSize) ? oldSize : newSize);
+    }
+    return newPtr;
+}
+
+/**
+ * Free memory; does nothing for an arena.
+ *
+ * @param ctx the Arena
+ * @param ptr the memory to free
+ * @param size the number of bytes
+ */
+static void arenaFree(void *ctx, void *ptr, size_t size) {
+    // memory is reclaimed when the arena is reset
+}
+
+/**
+ * Copy a string into the arena.
+ *
+ * @param ctx the Arena
+ * @param str the string to copy
+ * @param len the length of the string
+ * @return the copy, or NULL if the arena is full
+ */
+static char *arenaStrndup(void *ctx, const char *str, size_t len) {
+    char *copy = arenaMalloc(ctx, len + 1);
+    if (copy != NULL) {
+        memcpy(copy, str, len);
+        copy[len] = '\0';
+    }
+    return copy;
+}
+
+/**
+ * Print allocation counts.
+ *
+ * @param counts the counts
+ */
+static void printCounts(AllocCounts *counts) {
+    printf("allocs: %zu, frees: %zu, reallocs: %zu, live bytes: %zu\n",
+           counts->allocs, counts->frees, counts->reallocs, counts->liveBytes);
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    AllocCounts counts = {0};
+    const Allocator counting = {
+        countingMalloc, countingRealloc, countingFree, countingStrndup, &counts
+    };
+
+    printf("Creating containers with a counting allocator\n");
+    ArrayList *list = newArrayList(SIZE_MAX, &counting);
+    ArrayStack *stack = newArrayStack(SIZE_MAX, &counting);
+    ArrayQueue *queue = newArrayQueue(SIZE_MAX, &counting);
+    LinkedStack *linked = newLinkedStack(SIZE_MAX, &counting);
+    MessagePriorityQueue *mpq = newMPQ(SIZE_MAX, &counting);
+    printCounts(&counts);
+
+    printf("\nadding 100 values to each container\n");
+    char buf[16];
+    for (int i = 0; i < 100; i++) {
+        sprintf(buf, "val%d", i);
+        addLastArrayListVal(list, buf);
+        pushArrayStackVal(stack, buf);
+        enqueueArrayQueueVal(queue, buf);
+        pushLinkedStackVal(linked, buf);
+        enqueueMessageMPQ(mpq, buf, i % 4);
+    }
+    printCounts(&counts);
+
+    printf("\npopping values; caller frees with allocatorFreeStr\n");
+    char *val;
+    popArrayStackVal(stack, &val);
+    printf("stack pop: %s\n", val);
+    allocatorFreeStr(&counting, val);
+    dequeueMessageMPQ(mpq, &val);
+    printf("mpq dequeue: %s\n", val);
+    allocatorFreeStr(&counting, val);
+    printf("mpq empty? %s\n", isEmptyMPQ(mpq) ? "true" : "false");
+
+    printf("\ndeleting containers\n");
+    deleteArrayList(list);
+    deleteArrayStack(stack);
+    deleteArrayQueue(queue);
+    deleteLinkedStack(linked);
+    deleteMPQ(mpq);
+    printCounts(&counts);
+
+    printf("\nCreating list with an arena allocator\n");
+    Arena arena = { malloc(1 << 16), 0, 1 << 16 };
+    const Allocator arenaAllocator = {
+        arenaMalloc, arenaRealloc, arenaFree, arenaStrndup, &arena
+    };
+    ArrayList *arenaList = newArrayList(SIZE_MAX, &arenaAllocator);
+    for (int i = 0; i < 10; i++) {
+        sprintf(buf, "a%d", i);
+        addLastArrayListVal(arenaList, buf);
+    }
+    printArrayList(arenaList);
+    printf("arena bytes used: %zu\n", arena.used);
+    deleteArrayList(arenaList);
+    free(arena.base);  // releases everything at once
+
+    printf("\nCreating list with the default allocator\n");
+    ArrayList *defaultList = newArrayList(SIZE_MAX, NULL);
+    addLastArrayListVal(defaultList, "default");
+    printArrayList(defaultList);
+    deleteArrayList(defaultList);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -52,6 +52,40 @@ bool addLastArrayDequeVal(ArrayDeque *deque, const char *val) {
     return addLastArrayListVal(deque->list, val);
 }
 
+/**
+ * Add values onto the deque first with one capacity check and one
+ * copy pass. Equivalent to adding each value first in turn, so
+ * vals[n-1] ends first.
+ * @param deque the ArrayDeque
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     deque is then unchanged
+ */
+bool addFirstNArrayDequeVals(ArrayDeque *deque, const char *const vals[], size_t n) {
+    if (!addArrayListValsAt(deque->list, 0, vals, n)) {
+        return false;
+    }
+    // each value added first goes before the ones added earlier
+    return reverseArrayListVals(deque->list, 0, n);
+}
+
+/**
+ * Add values onto the deque last with one capacity check and one
+ * copy pass. Equivalent to adding each value last in turn, so
+ * vals[n-1] ends last.
+ * @param deque the ArrayDeque
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     deque is then unchanged
+ */
+bool addLastNArrayDequeVals(ArrayDeque *deque, const char *const vals[], size_t n) {
+    return addArrayListValsAt(deque->list, arrayListSize(deque->list), vals, n);
+}
+
 /**
  * Enqeque value onto the deque. Cannot add NULL string to the deque.
  * @param deque the ArrayDeque
@@ -192,6 +226,34 @@ bool deleteLastArrayDequeVal(ArrayDeque *deque, char **val) {
     return false;
 }
 
+/**
+ * Delete the first n array deque values without copying them.
+ * Equivalent to deleting first n times, so vals[0] was first.
+ * @param deque the array deque
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if deque has fewer than n values; the deque is
+ *   then unchanged
+ */
+bool deleteFirstNArrayDequeVals(ArrayDeque *deque, char *vals[], size_t n) {
+    return removeArrayListValsAt(deque->list, 0, vals, n);
+}
+
+/**
+ * Delete the last n array deque values without copying them.
+ * Equivalent to deleting last n times, so vals[0] was last.
+ * @param deque the array deque
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if deque has fewer than n values; the deque is
+ *   then unchanged
+ */
+bool deleteLastNArrayDequeVals(ArrayDeque *deque, char *vals[], size_t n) {
+    return removeLastArrayListVals(deque->list, vals, n);
+}
+
 /**
  * Dequeue the array deque value.
  * @param deque the array deque
@@ -271,20 +333,8 @@ bool dropTopArrayDequeVal(ArrayDeque *deque) {
  *   operation is not supported
  */
 bool swapTopArrayDequeVal(ArrayDeque *deque) {
-    size_t size = arrayDequeSize(deque);
-    if (size >= 2) {
-        char *val1, *val2;
-        popArrayDequeVal(deque, &val1);
-        popArrayDequeVal(deque,&val2);
-        pushArrayDequeVal(deque, val1);
-        pushArrayDequeVal(deque, val2);
-
-        // must free because pop returns allocated storage
-        free(val1);
-        free(val2);
-        return true;
-    }
-    return false;
+    size_t size = arrayListSize(deque->list);
+    return size >= 2 && swapArrayListValsAt(deque->list, size-1, size-2);
 }
 
 /**
@@ -300,6 +350,85 @@ bool dupTopArrayDequeVal(ArrayDeque *deque) {
     return false;
 }
 
+/**
+ * Rotate the third deque value to the top: (a b c -- b c a).
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have three values
+ */
+bool rotTopArrayDequeVal(ArrayDeque *deque) {
+    return rollTopArrayDequeVal(deque, 2);
+}
+
+/**
+ * Pushes a copy of the second deque value: (a b -- a b a).
+ * Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values or
+ *   exceeds max capacity
+ */
+bool overTopArrayDequeVal(ArrayDeque *deque) {
+    return pickTopArrayDequeVal(deque, 1);
+}
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup and
+ * pick 1 is over. Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @param n the depth of the value, 0 for the top
+ * @return false if the deque does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickTopArrayDequeVal(ArrayDeque *deque, size_t n) {
+    size_t size = arrayListSize(deque->list);
+    const char *val;
+    // top is the last value
+    if (n < size && getArrayListValAt(deque->list, size-1-n, &val)) {
+        return pushArrayDequeVal(deque, val);
+    }
+    return false;
+}
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param deque the ArrayDeque
+ * @param n the depth of the value, 0 for the top
+ * @return false if the deque does not have n+1 values
+ */
+bool rollTopArrayDequeVal(ArrayDeque *deque, size_t n) {
+    size_t size = arrayListSize(deque->list);
+    if (n >= size) {
+        return false;
+    }
+    return rotateArrayListVals(deque->list, size-1-n, size-1);
+}
+
+/**
+ * Deletes the second deque value: (a b -- b).
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values
+ */
+bool nipTopArrayDequeVal(ArrayDeque *deque) {
+    size_t size = arrayListSize(deque->list);
+    return size >= 2 && deleteArrayListValAt(deque->list, size-2);
+}
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b). Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckTopArrayDequeVal(ArrayDeque *deque) {
+    size_t size = arrayListSize(deque->list);
+    const char *val;
+    if (size >= 2 && peekTopArrayDequeVal(deque, &val)) {
+        return addArrayListValAt(deque->list, size-2, val);
+    }
+    return false;
+}
+
 /**
  * Drops all array deque values.
  * @param deque the ArrayDeque
@@ -45,6 +45,32 @@ bool addFirstArrayDequeVal(ArrayDeque *deque, const char *val);
  */
 bool addLastArrayDequeVal(ArrayDeque *deque, const char *val);
 
+/**
+ * Add values onto the deque first with one capacity check and one
+ * copy pass. Equivalent to adding each value first in turn, so
+ * vals[n-1] ends first.
+ * @param deque the ArrayDeque
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     deque is then unchanged
+ */
+bool addFirstNArrayDequeVals(ArrayDeque *deque, const char *const vals[], size_t n);
+
+/**
+ * Add values onto the deque last with one capacity check and one
+ * copy pass. Equivalent to adding each value last in turn, so
+ * vals[n-1] ends last.
+ * @param deque the ArrayDeque
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     deque is then unchanged
+ */
+bool addLastNArrayDequeVals(ArrayDeque *deque, const char *const vals[], size_t n);
+
 /**
  * Enqeque value onto the deque. Cannot add NULL string to the deque.
  * @param deque the ArrayDeque
@@ -147,6 +173,30 @@ bool deleteFirstArrayDequeVal(ArrayDeque *deque, char **val);
  */
 bool deleteLastArrayDequeVal(ArrayDeque *deque, char **val);
 
+/**
+ * Delete the first n array deque values without copying them.
+ * Equivalent to deleting first n times, so vals[0] was first.
+ * @param deque the array deque
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if deque has fewer than n values; the deque is
+ *   then unchanged
+ */
+bool deleteFirstNArrayDequeVals(ArrayDeque *deque, char *vals[], size_t n);
+
+/**
+ * Delete the last n array deque values without copying them.
+ * Equivalent to deleting last n times, so vals[0] was last.
+ * @param deque the array deque
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if deque has fewer than n values; the deque is
+ *   then unchanged
+ */
+bool deleteLastNArrayDequeVals(ArrayDeque *deque, char *vals[], size_t n);
+
 /**
  * Dequeue the array deque value.
  * @param deque the array deque
@@ -208,6 +258,57 @@ bool swapTopArrayDequeVal(ArrayDeque *stack);
  */
 bool dupTopArrayDequeVal(ArrayDeque *stack);
 
+/**
+ * Rotate the third deque value to the top: (a b c -- b c a).
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have three values
+ */
+bool rotTopArrayDequeVal(ArrayDeque *deque);
+
+/**
+ * Pushes a copy of the second deque value: (a b -- a b a).
+ * Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values or
+ *   exceeds max capacity
+ */
+bool overTopArrayDequeVal(ArrayDeque *deque);
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup and
+ * pick 1 is over. Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @param n the depth of the value, 0 for the top
+ * @return false if the deque does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickTopArrayDequeVal(ArrayDeque *deque, size_t n);
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param deque the ArrayDeque
+ * @param n the depth of the value, 0 for the top
+ * @return false if the deque does not have n+1 values
+ */
+bool rollTopArrayDequeVal(ArrayDeque *deque, size_t n);
+
+/**
+ * Deletes the second deque value: (a b -- b).
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values
+ */
+bool nipTopArrayDequeVal(ArrayDeque *deque);
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b). Only the new value is allocated.
+ * @param deque the ArrayDeque
+ * @return false if the deque does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckTopArrayDequeVal(ArrayDeque *deque);
+
 /**
  * Drops all array deque values.
  * @param list the array list
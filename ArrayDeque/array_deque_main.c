@@ -83,6 +83,33 @@ void testArrayDequeAsDeque(void) {
         printf("\ncannot delete last\n");
     }
 
+    printf("\ndropping all array queue values\n");
+    dropAllArrayDequeVals(queue);
+    const char *batch[] = { "a", "b", "c" };
+    status = addFirstNArrayDequeVals(queue, batch, 2);
+    printf("\nadd first 2 values: %s\n", status ? "true" : "false");
+    status = addLastNArrayDequeVals(queue, batch, 3);
+    printf("add last 3 values: %s\n", status ? "true" : "false");
+    printArrayDeque(queue);
+    status = addLastNArrayDequeVals(queue, batch, 1);
+    printf("add last 1 past max capacity: %s\n", status ? "true" : "false");
+    char *deleted[3];
+    status = deleteFirstNArrayDequeVals(queue, deleted, 2);
+    if (status) {
+        printf("delete first 2: %s %s\n", deleted[0], deleted[1]);
+        free(deleted[0]);
+        free(deleted[1]);
+    }
+    status = deleteLastNArrayDequeVals(queue, deleted, 2);
+    if (status) {
+        printf("delete last 2: %s %s\n", deleted[0], deleted[1]);
+        free(deleted[0]);
+        free(deleted[1]);
+    }
+    printArrayDeque(queue);
+    status = deleteLastNArrayDequeVals(queue, deleted, 2);
+    printf("delete last 2 of 1 value: %s\n", status ? "true" : "false");
+
     printf("\ndropping all array queue values\n");
     dropAllArrayDequeVals(queue);
     empty = isArrayDequeEmpty(queue);
@@ -231,6 +258,62 @@ void testArrayDequeAsStack(void) {
         printf("\ncannot dup value\n");
     }
 
+    status = rotTopArrayDequeVal(deque);
+    if (status) {
+        printf("\nrotated third to top\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot rotate\n");
+    }
+
+    status = rollTopArrayDequeVal(deque, 4);
+    if (status) {
+        printf("\nrolled value 4 below top to top\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot roll 4\n");
+    }
+
+    status = nipTopArrayDequeVal(deque);
+    if (status) {
+        printf("\nnipped second value\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot nip\n");
+    }
+
+    status = nipTopArrayDequeVal(deque);
+    if (status) {
+        printf("\nnipped second value\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot nip\n");
+    }
+
+    status = pickTopArrayDequeVal(deque, 2);
+    if (status) {
+        printf("\npicked value 2 below top\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot pick 2\n");
+    }
+
+    status = tuckTopArrayDequeVal(deque);
+    if (status) {
+        printf("\ntucked top below second\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot tuck\n");
+    }
+
+    status = overTopArrayDequeVal(deque);
+    if (status) {
+        printf("\nover value\n");
+        printStackArrayDeque(deque);
+    } else {
+        printf("\ncannot over at max capacity\n");
+    }
+
     char *val2;
     status = popArrayDequeVal(deque, &val2);
     if (status) {
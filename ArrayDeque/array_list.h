@@ -120,6 +120,78 @@ bool setFirstArrayListVal(ArrayList *list, const char *val);
  */
 bool setLastArrayListVal(ArrayList *list, const char *val);
 
+/**
+ * Exchange the values at two indexes without copying them.
+ *
+ * @param list the ArrayList
+ * @param index1 the first index
+ * @param index2 the second index
+ * @return false if either index is out of bounds
+ */
+bool swapArrayListValsAt(ArrayList *list, size_t index1, size_t index2);
+
+/**
+ * Move the value at one index to another without copying it,
+ * shifting the values in between by one place.
+ *
+ * @param list the ArrayList
+ * @param from the index of the value to move
+ * @param to the index the value moves to
+ * @return false if either index is out of bounds
+ */
+bool rotateArrayListVals(ArrayList *list, size_t from, size_t to);
+
+/**
+ * Add copies of values to the list at index, growing the array at
+ * most once and shifting the following values once.
+ *
+ * @param list the ArrayList
+ * @param index the index for the first new value
+ * @param vals the values to insert, in list order; values will be
+ *   copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addArrayListValsAt(ArrayList *list, size_t index, const char *const vals[], size_t count);
+
+/**
+ * Remove values from the list at index without copying them, and
+ * shift the following values once. The caller owns the values.
+ *
+ * @param list the ArrayList
+ * @param index the index of the first value to remove
+ * @param vals result parameter for the values, in list order;
+ *   returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index;
+ *   the list is then unchanged
+ */
+bool removeArrayListValsAt(ArrayList *list, size_t index, char *vals[], size_t count);
+
+/**
+ * Remove the last values from the list without copying them,
+ * last value first. The caller owns the values.
+ *
+ * @param list the ArrayList
+ * @param vals result parameter for the values, in reverse list
+ *   order; returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values;
+ *   the list is then unchanged
+ */
+bool removeLastArrayListVals(ArrayList *list, char *vals[], size_t count);
+
+/**
+ * Reverse the order of values in a range without copying them.
+ *
+ * @param list the ArrayList
+ * @param index the index of the first value
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index
+ */
+bool reverseArrayListVals(ArrayList *list, size_t index, size_t count);
+
 /**
  * Returns number of items in the array list.
  * @param list the ArrayList
@@ -0,0 +1,197 @@
+/**
+ * @file array_list_map.c
+ *
+ * Implementation for saving an array list to a binary file and
+ * mapping the file back into memory as a read-only array list.
+ *
+ * The file is mapped copy-on-write, and the offset table is
+ * converted in place to the list's array of string pointers.
+ * Only the pages of the table are written and become private;
+ * the string blob is shared with the page cache and is only
+ * paged in as the values are read.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "array_list_map.h"
+
+/** The magic number that starts a mapped list file */
+static const char MAGIC[8] = {'A', 'L', 'S', 'T', 'M', 'A', 'P', '1'};
+
+/** Mapped list file header */
+typedef struct {
+    /** The magic number */
+    char magic[8];
+    /** The number of strings */
+    uint64_t count;
+    /** The file offset of the string offset table */
+    uint64_t tableOffset;
+    /** The file offset of the string blob */
+    uint64_t blobOffset;
+} MappedListHeader;
+
+/** A read-only array list and the mapped file that stores it */
+typedef struct {
+    /** The list; must be first so list pointer is also struct pointer */
+    ArrayList list;
+    /** Start of the mapped file */
+    void *addr;
+    /** Length of the mapped file */
+    size_t length;
+} MappedArrayList;
+
+/**
+ * Save the array list values to a file in mapped list format.
+ *
+ * @param list the ArrayList
+ * @param path the path of the file to write
+ * @return false if the file could not be written; errno is set
+ */
+bool saveArrayList(ArrayList *list, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    MappedListHeader header;
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.count = list->size;
+    header.tableOffset = sizeof(MappedListHeader);
+    header.blobOffset = header.tableOffset + list->size * sizeof(uint64_t);
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // write the offset table
+    uint64_t offset = header.blobOffset;
+    for (size_t i = 0; ok && i < list->size; i++) {
+        ok = fwrite(&offset, sizeof(offset), 1, file) == 1;
+        offset += strlen(list->vals[i]) + 1;
+    }
+
+    // write the strings including their terminating NULs
+    for (size_t i = 0; ok && i < list->size; i++) {
+        size_t len = strlen(list->vals[i]) + 1;
+        ok = fwrite(list->vals[i], 1, len, file) == len;
+    }
+
+    // close even if writing failed, but report the first error
+    int savedErrno = errno;
+    if (fclose(file) != 0) {
+        return false;
+    }
+    errno = savedErrno;
+    return ok;
+}
+
+/**
+ * Determines whether the mapped file has a valid header and
+ * table for the file length.
+ *
+ * @param header the mapped header
+ * @param length the length of the file
+ * @return true if valid, false otherwise
+ */
+static bool isValidMappedListHeader(const MappedListHeader *header, size_t length) {
+    if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    if (header->tableOffset != sizeof(MappedListHeader)) {
+        return false;
+    }
+    // written so that count * sizeof(uint64_t) cannot overflow
+    if (header->count > (length - header->tableOffset) / sizeof(uint64_t)) {
+        return false;
+    }
+    return header->blobOffset == header->tableOffset + header->count * sizeof(uint64_t);
+}
+
+/**
+ * Map a file written by saveArrayList() as a read-only array list.
+ * List values point directly into the mapped file, so no strings
+ * are allocated or copied. Values cannot be added, set or deleted.
+ *
+ * @param path the path of the file to map
+ * @return the mapped array list, or NULL if the file could not be
+ *   mapped or is not in mapped list format
+ */
+ArrayList *mapArrayList(const char *path) {
+    // table entries are converted in place to pointers
+    if (sizeof(char*) != sizeof(uint64_t)) {
+        return NULL;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(MappedListHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t length = st.st_size;
+    char *addr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // mapping remains valid after close
+    if (addr == MAP_FAILED) {
+        return NULL;
+    }
+
+    MappedListHeader *header = (MappedListHeader *)addr;
+    // last byte must be NUL so that every string ends inside the file
+    if (!isValidMappedListHeader(header, length)
+        || (header->count > 0 && addr[length-1] != '\0')) {
+        munmap(addr, length);
+        return NULL;
+    }
+
+    // convert the offset table in place to an array of string pointers
+    uint64_t *offsets = (uint64_t *)(addr + header->tableOffset);
+    char **vals = (char **)offsets;
+    for (size_t i = 0; i < header->count; i++) {
+        if (offsets[i] < header->blobOffset || offsets[i] >= length) {
+            munmap(addr, length);
+            return NULL;
+        }
+        vals[i] = addr + offsets[i];
+    }
+
+    MappedArrayList *mapped = malloc(sizeof(MappedArrayList));
+    mapped->addr = addr;
+    mapped->length = length;
+    mapped->list.vals = vals;
+    mapped->list.size = header->count;
+    mapped->list.capacity = header->count;
+    mapped->list.maxCapacity = header->count;
+    mapped->list.readOnly = true;
+
+    return &mapped->list;
+}
+
+/**
+ * Unmap a list returned by mapArrayList() and free the list.
+ * Values obtained from the list are no longer valid.
+ *
+ * @param list the mapped ArrayList
+ */
+void unmapArrayList(ArrayList *list) {
+    MappedArrayList *mapped = (MappedArrayList *)list;
+    munmap(mapped->addr, mapped->length);
+
+    // set fields to safe values
+    mapped->addr = NULL;
+    mapped->length = 0;
+    list->vals = NULL;
+    list->capacity = 0;
+    list->size = 0;
+
+    free(mapped);
+}
@@ -0,0 +1,56 @@
+/**
+ * @file array_list_map.h
+ *
+ * Declarations for saving an array list to a binary file and
+ * mapping the file back into memory as a read-only array list.
+ *
+ * The file has a fixed header, a table of string offsets, and
+ * a blob of packed NUL-terminated strings:
+ *
+ *   magic "ALSTMAP1" | count | table offset | blob offset
+ *   offset[0] ... offset[count-1]
+ *   "string0\0string1\0..."
+ *
+ * All header fields and offsets are 64-bit native-endian values,
+ * and offsets are relative to the start of the file.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ARRAY_LIST_MAP_H_
+#define ARRAY_LIST_MAP_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "array_list.h"
+
+/**
+ * Save the array list values to a file in mapped list format.
+ *
+ * @param list the ArrayList
+ * @param path the path of the file to write
+ * @return false if the file could not be written; errno is set
+ */
+bool saveArrayList(ArrayList *list, const char *path);
+
+/**
+ * Map a file written by saveArrayList() as a read-only array list.
+ * List values point directly into the mapped file, so no strings
+ * are allocated or copied. Values cannot be added, set or deleted.
+ *
+ * @param path the path of the file to map
+ * @return the mapped array list, or NULL if the file could not be
+ *   mapped or is not in mapped list format
+ */
+ArrayList *mapArrayList(const char *path);
+
+/**
+ * Unmap a list returned by mapArrayList() and free the list.
+ * Values obtained from the list are no longer valid.
+ *
+ * @param list the mapped ArrayList
+ */
+void unmapArrayList(ArrayList *list);
+
+#endif /* ARRAY_LIST_MAP_H_ */
@@ -0,0 +1,83 @@
+/*
+ * @file array_list_map_main.c
+ *
+ * Test program for saving and mapping ArrayList files.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list_map.h"
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    const char *path = "array_list_map_test.bin";
+
+    printf("Creating array list\n");
+    ArrayList *list = newArrayList(SIZE_MAX);
+    addLastArrayListVal(list, "A");
+    addLastArrayListVal(list, "BB");
+    addLastArrayListVal(list, "");
+    addLastArrayListVal(list, "DDDD");
+    addLastArrayListVal(list, "E");
+    printArrayList(list);
+
+    printf("\nsaving array list to %s\n", path);
+    if (!saveArrayList(list, path)) {
+        perror("cannot save array list");
+        return EXIT_FAILURE;
+    }
+    deleteArrayList(list);
+
+    printf("\nmapping array list from %s\n", path);
+    ArrayList *mapped = mapArrayList(path);
+    if (mapped == NULL) {
+        printf("cannot map array list\n");
+        return EXIT_FAILURE;
+    }
+    printArrayList(mapped);
+    printf("list size: %lu\n", arrayListSize(mapped));
+
+    const char *val;
+    if (getLastArrayListVal(mapped, &val)) {
+        printf("list last: %s\n", val);
+    }
+
+    bool status = addLastArrayListVal(mapped, "F");
+    printf("\nadd to mapped list? %s\n", status ? "true" : "false");
+    status = setArrayListValAt(mapped, 0, "Z");
+    printf("set mapped list value? %s\n", status ? "true" : "false");
+    status = deleteFirstArrayListVal(mapped);
+    printf("delete mapped list value? %s\n", status ? "true" : "false");
+    printArrayList(mapped);
+
+    printf("\nunmapping array list\n");
+    unmapArrayList(mapped);
+
+    printf("\nmapping empty array list\n");
+    list = newArrayList(SIZE_MAX);
+    saveArrayList(list, path);
+    deleteArrayList(list);
+    mapped = mapArrayList(path);
+    printArrayList(mapped);
+    unmapArrayList(mapped);
+
+    printf("\nmapping non-list file\n");
+    FILE *file = fopen(path, "w");
+    fprintf(file, "not a mapped list file\n");
+    fclose(file);
+    mapped = mapArrayList(path);
+    printf("mapped? %s\n", (mapped != NULL) ? "true" : "false");
+
+    remove(path);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
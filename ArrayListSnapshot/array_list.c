@@ -0,0 +1,589 @@
+/**
+ * @file array_list.c
+ *
+ * Implementation for variable-size array list with copy-on-write
+ * snapshots.
+ *
+ * Each string is stored after its reference count, so copying a
+ * chunk only increments the counts of its strings. The list owns
+ * its storage exclusively when all counts are 1; the list changes
+ * only storage it owns, and copies shared storage before changing
+ * it. Counts are released with release order and freed after an
+ * acquire fence, so a snapshot reader that drops the last reference
+ * sees all writes to the storage it frees.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list.h"
+
+/** Reference-counted string */
+typedef struct {
+    /** The number of chunks that share the string */
+    atomic_size_t refs;
+    /** The string characters */
+    char str[];
+} RefString;
+
+/**
+ * Create a reference-counted copy of a string.
+ *
+ * @param val the string to copy
+ * @return the string copy with a count of 1
+ */
+static char *newRefString(const char *val) {
+    size_t len = strlen(val) + 1;
+    RefString *rs = malloc(sizeof(RefString) + len);
+    atomic_init(&rs->refs, 1);
+    memcpy(rs->str, val, len);
+    return rs->str;
+}
+
+/**
+ * Add a reference to a string.
+ *
+ * @param str the string
+ */
+static void retainRefString(char *str) {
+    RefString *rs = (RefString *)(str - offsetof(RefString, str));
+    atomic_fetch_add_explicit(&rs->refs, 1, memory_order_relaxed);
+}
+
+/**
+ * Release a reference to a string; frees string if no references
+ * remain. A NULL string is ignored.
+ *
+ * @param str the string
+ */
+static void releaseRefString(char *str) {
+    if (str != NULL) {
+        RefString *rs = (RefString *)(str - offsetof(RefString, str));
+        if (atomic_fetch_sub_explicit(&rs->refs, 1, memory_order_release) == 1) {
+            atomic_thread_fence(memory_order_acquire);
+            free(rs);
+        }
+    }
+}
+
+/**
+ * Create an empty chunk.
+ *
+ * @return the chunk with a count of 1
+ */
+static ArrayListChunk *newChunk(void) {
+    ArrayListChunk *chunk = calloc(1, sizeof(ArrayListChunk)); // nulls ptrs
+    atomic_init(&chunk->refs, 1);
+    return chunk;
+}
+
+/**
+ * Create a copy of a chunk that shares its strings.
+ *
+ * @param chunk the chunk to copy
+ * @return the chunk copy with a count of 1
+ */
+static ArrayListChunk *copyChunk(ArrayListChunk *chunk) {
+    ArrayListChunk *newChunk = malloc(sizeof(ArrayListChunk));
+    atomic_init(&newChunk->refs, 1);
+    for (size_t i = 0; i < ARRAY_LIST_CHUNK_SIZE; i++) {
+        newChunk->vals[i] = chunk->vals[i];
+        if (newChunk->vals[i] != NULL) {
+            retainRefString(newChunk->vals[i]);
+        }
+    }
+    return newChunk;
+}
+
+/**
+ * Release a reference to a chunk; releases its strings and
+ * frees the chunk if no references remain.
+ *
+ * @param chunk the chunk
+ */
+static void releaseChunk(ArrayListChunk *chunk) {
+    if (atomic_fetch_sub_explicit(&chunk->refs, 1, memory_order_release) == 1) {
+        atomic_thread_fence(memory_order_acquire);
+        for (size_t i = 0; i < ARRAY_LIST_CHUNK_SIZE; i++) {
+            releaseRefString(chunk->vals[i]);
+        }
+        free(chunk);
+    }
+}
+
+/**
+ * Create an empty table.
+ *
+ * @param chunkCapacity the capacity of the chunk array
+ * @return the table with a count of 1
+ */
+static ArrayListTable *newTable(size_t chunkCapacity) {
+    ArrayListTable *table = malloc(sizeof(ArrayListTable) + chunkCapacity * sizeof(ArrayListChunk*));
+    atomic_init(&table->refs, 1);
+    table->numChunks = 0;
+    table->chunkCapacity = chunkCapacity;
+    return table;
+}
+
+/**
+ * Create a copy of a table that shares its chunks.
+ *
+ * @param table the table to copy
+ * @return the table copy with a count of 1
+ */
+static ArrayListTable *copyTable(ArrayListTable *table) {
+    ArrayListTable *newTab = newTable(table->chunkCapacity);
+    newTab->numChunks = table->numChunks;
+    for (size_t i = 0; i < table->numChunks; i++) {
+        newTab->chunks[i] = table->chunks[i];
+        atomic_fetch_add_explicit(&newTab->chunks[i]->refs, 1, memory_order_relaxed);
+    }
+    return newTab;
+}
+
+/**
+ * Release a reference to a table; releases its chunks and
+ * frees the table if no references remain.
+ *
+ * @param table the table
+ */
+static void releaseTable(ArrayListTable *table) {
+    if (atomic_fetch_sub_explicit(&table->refs, 1, memory_order_release) == 1) {
+        atomic_thread_fence(memory_order_acquire);
+        for (size_t i = 0; i < table->numChunks; i++) {
+            releaseChunk(table->chunks[i]);
+        }
+        free(table);
+    }
+}
+
+/**
+ * Returns the location of the value at index in the table.
+ *
+ * @param table the table
+ * @param index the index of the value
+ * @return the value location
+ */
+static inline char **tableValAt(ArrayListTable *table, size_t index) {
+    return &table->chunks[index / ARRAY_LIST_CHUNK_SIZE]->vals[index % ARRAY_LIST_CHUNK_SIZE];
+}
+
+/**
+ * Ensure the list owns its table, copying the table if it is shared.
+ *
+ * @param list the ArrayList
+ */
+static void makeTableWritable(ArrayList *list) {
+    if (atomic_load_explicit(&list->table->refs, memory_order_acquire) > 1) {
+        ArrayListTable *table = copyTable(list->table);
+        releaseTable(list->table);
+        list->table = table;
+    }
+}
+
+/**
+ * Ensure the list owns the chunks that store a range of values,
+ * copying the table and chunks that are shared.
+ *
+ * @param list the ArrayList
+ * @param from the index of the first value in the range
+ * @param to the index of the last value in the range
+ */
+static void makeValsWritable(ArrayList *list, size_t from, size_t to) {
+    makeTableWritable(list);
+    ArrayListTable *table = list->table;
+    for (size_t c = from / ARRAY_LIST_CHUNK_SIZE; c <= to / ARRAY_LIST_CHUNK_SIZE; c++) {
+        if (atomic_load_explicit(&table->chunks[c]->refs, memory_order_acquire) > 1) {
+            ArrayListChunk *chunk = copyChunk(table->chunks[c]);
+            releaseChunk(table->chunks[c]);
+            table->chunks[c] = chunk;
+        }
+    }
+}
+
+/**
+ * Ensure list has sufficient capacity to add a new element. If
+ * it currently does not, add a chunk to the table, growing the
+ * table if necessary.
+ *
+ * @param list the array list
+ * @return true if list has sufficient size for a new element,
+ *   false if at maximum capacity
+ */
+static bool ensureArrayCapacity(ArrayList *list) {
+    if (list->size == list->maxCapacity) {
+        return false;
+    }
+    if (list->size < list->table->numChunks * ARRAY_LIST_CHUNK_SIZE) {
+        return true;
+    }
+
+    makeTableWritable(list);
+    ArrayListTable *table = list->table;
+    if (table->numChunks == table->chunkCapacity) {
+        // double chunk capacity; table is not shared so can realloc
+        size_t newCapacity = table->chunkCapacity * 2;
+        table = realloc(table, sizeof(ArrayListTable) + newCapacity * sizeof(ArrayListChunk*));
+        if (table == NULL) { // not enough memory to reallocate
+            return false;
+        }
+        table->chunkCapacity = newCapacity;
+        list->table = table;
+    }
+    table->chunks[table->numChunks++] = newChunk();
+    return true;
+}
+
+/**
+ * Create an array list with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the ArrayList.
+ * @return the allocated array list
+ */
+ArrayList *newArrayList(size_t maxCapacity) {
+    ArrayList *list = malloc(sizeof(ArrayList));
+    list->table = newTable(2);  // small power of 2
+    list->size = 0;
+    list->maxCapacity = maxCapacity;
+
+    return list;
+}
+
+/**
+ * Add value to list at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds max capacity
+ */
+bool addArrayListValAt(ArrayList *list, size_t index, const char *val) {
+    // cannot add NULL or beyond end of list
+    if (val == NULL || index > list->size) {
+        return false;
+    }
+
+    // ensure that list has sufficient capacity to add an element
+    if (!ensureArrayCapacity(list)) {
+        return false;
+    }
+
+    // copy shared chunks that are changed by the move
+    makeValsWritable(list, index, list->size);
+
+    // move elements down to make room for new element at index position
+    ArrayListTable *table = list->table;
+    for (size_t i = list->size; i > index; i--) {
+        *tableValAt(table, i) = *tableValAt(table, i-1);
+    }
+    *tableValAt(table, index) = newRefString(val);  // must copy input string
+    list->size++;
+
+    return true;
+}
+
+/**
+ * Add value to start of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds or exceeds max capacity
+ */
+bool addFirstArrayListVal(ArrayList *list, const char *val) {
+    return addArrayListValAt(list, 0, val);
+}
+
+/**
+ * Add value to end of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds or exceeds max capacity
+ */
+bool addLastArrayListVal(ArrayList *list, const char *val) {
+    return addArrayListValAt(list, list->size, val);
+}
+
+/**
+ * Get value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListValAt(ArrayList *list, size_t index, const char **val) {
+    if (index < list->size) {
+        *val = *tableValAt(list->table, index);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Get value at first index.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getFirstArrayListVal(ArrayList *list, const char **val) {
+    return getArrayListValAt(list, 0, val);
+}
+
+/**
+ * Get value at last index.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getLastArrayListVal(ArrayList *list, const char **val) {
+    if (list->size == 0) { // prevent negative size_t index
+        return false;
+    }
+    return getArrayListValAt(list, list->size-1, val);
+}
+
+/**
+ * Set value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setArrayListValAt(ArrayList *list, size_t index, const char *val) {
+    if (val != NULL && index < list->size) {
+        // copy shared chunk that stores the value
+        makeValsWritable(list, index, index);
+        char **loc = tableValAt(list->table, index);
+        releaseRefString(*loc);
+        *loc = newRefString(val);  // must copy input string
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Set value at first index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setFirstArrayListVal(ArrayList *list, const char *val) {
+    return setArrayListValAt(list, 0, val);
+}
+
+/**
+ * Set value at last index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setLastArrayListVal(ArrayList *list, const char *val) {
+    if (list->size == 0) { // prevent negative size_t index
+        return false;
+    }
+    return setArrayListValAt(list, list->size-1, val);
+}
+
+/**
+ * Returns number of items in the array list.
+ *
+ * @param list the ArrayList
+ * @return the number of items in the array list.
+ */
+size_t arrayListSize(ArrayList *list) {
+    return list->size;
+}
+
+/**
+ * Determines whether array list is empty.
+ *
+ * @param list the ArrayList
+ * @return true if array list is empty, false otherwise
+ */
+bool isArrayListEmpty(ArrayList *list) {
+    return list->size == 0;
+}
+
+/**
+ * Delete the array list value at the specified index.
+ *
+ * @param list the ArrayList
+ * @param index the index
+ * @return false if index out of bounds
+ */
+bool deleteArrayListValAt(ArrayList *list, size_t index) {
+    if (index >= list->size) {
+        return false;
+    }
+
+    // copy shared chunks that are changed by the move
+    makeValsWritable(list, index, list->size-1);
+
+    // release string before overwriting location
+    ArrayListTable *table = list->table;
+    releaseRefString(*tableValAt(table, index));
+
+    // move elements down
+    list->size--;
+    for (size_t i = index; i < list->size; i++) {
+        *tableValAt(table, i) = *tableValAt(table, i+1);
+    }
+    *tableValAt(table, list->size) = NULL; // clear last pointer
+
+    return true;
+}
+
+/**
+ * Delete the first array list value.
+ *
+ * @param list the ArrayList
+ * @return false if list is empty
+ */
+bool deleteFirstArrayListVal(ArrayList *list) {
+    return deleteArrayListValAt(list, 0);
+}
+
+/**
+ * Delete the last array list value.
+ *
+ * @param list the ArrayList
+ * @return false if list is empty
+ */
+bool deleteLastArrayListVal(ArrayList *list) {
+    if (list->size > 0) {
+        return deleteArrayListValAt(list, list->size-1);
+    }
+    return false;
+}
+
+/**
+ * Deletes all array list values. Storage shared with a
+ * snapshot is released rather than copied.
+ *
+ * @param list the ArrayList
+ */
+void deleteAllArrayListVals(ArrayList *list) {
+    releaseTable(list->table);
+    list->table = newTable(2);  // small power of 2
+    list->size = 0;
+}
+
+/**
+ * Delete the array list. Releases the list storage; storage that
+ * is shared with snapshots remains until the snapshots are deleted.
+ *
+ * @param list the ArrayList
+ */
+void deleteArrayList(ArrayList *list) {
+    // release the table, chunks and strings
+    releaseTable(list->table);
+
+    // set fields to safe values
+    list->table = NULL;
+    list->size = 0;
+    list->maxCapacity = 0;
+
+    // free the list itself
+    free(list);
+}
+
+/**
+ * Print the array list.
+ *
+ * @param list the ArrayList
+ */
+void printArrayList(ArrayList *list) {
+    printf("( ");
+    const char *val;
+    for (size_t i = 0; getArrayListValAt(list, i, &val); i++) {
+        printf("\"%s\" ", val);
+    }
+    printf(")\n");
+}
+
+/**
+ * Take an immutable snapshot of the list in O(1). Must not be
+ * called while the list is being changed by another thread.
+ *
+ * @param list the ArrayList
+ * @return the allocated snapshot
+ */
+ArrayListSnapshot *snapshotArrayList(ArrayList *list) {
+    ArrayListSnapshot *snapshot = malloc(sizeof(ArrayListSnapshot));
+    atomic_fetch_add_explicit(&list->table->refs, 1, memory_order_relaxed);
+    snapshot->table = list->table;
+    snapshot->size = list->size;
+    return snapshot;
+}
+
+/**
+ * Get snapshot value at index. The value remains valid until
+ * the snapshot is deleted.
+ *
+ * @param snapshot the ArrayListSnapshot
+ * @param the index for the value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListSnapshotValAt(ArrayListSnapshot *snapshot, size_t index, const char **val) {
+    if (index < snapshot->size) {
+        *val = *tableValAt(snapshot->table, index);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Returns number of items in the snapshot.
+ *
+ * @param snapshot the ArrayListSnapshot
+ * @return the number of items in the snapshot.
+ */
+size_t arrayListSnapshotSize(ArrayListSnapshot *snapshot) {
+    return snapshot->size;
+}
+
+/**
+ * Delete the snapshot. Releases storage shared with the list
+ * and frees storage that is no longer shared.
+ *
+ * @param snapshot the ArrayListSnapshot
+ */
+void deleteArrayListSnapshot(ArrayListSnapshot *snapshot) {
+    releaseTable(snapshot->table);
+
+    // set fields to safe values
+    snapshot->table = NULL;
+    snapshot->size = 0;
+
+    free(snapshot);
+}
+
+/**
+ * Print the snapshot.
+ *
+ * @param snapshot the ArrayListSnapshot
+ */
+void printArrayListSnapshot(ArrayListSnapshot *snapshot) {
+    printf("( ");
+    const char *val;
+    for (size_t i = 0; getArrayListSnapshotValAt(snapshot, i, &val); i++) {
+        printf("\"%s\" ", val);
+    }
+    printf(")\n");
+}
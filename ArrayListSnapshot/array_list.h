@@ -0,0 +1,270 @@
+/**
+ * @file array_list.h
+ *
+ * Declarations for variable-size array list with copy-on-write
+ * snapshots.
+ *
+ * Values are stored in fixed-size chunks under a table of chunks.
+ * Strings, chunks and the table are reference-counted, so a snapshot
+ * shares the list storage and is created in O(1). The first change
+ * to the list after a snapshot copies the table, and each change
+ * copies only the chunks it touches, so the copy is proportional to
+ * the changed region rather than to the size of the list.
+ *
+ * A snapshot is immutable and can be read by other threads without
+ * locks while the list continues to change. The list itself is not
+ * thread-safe: it must be changed and snapshotted by one thread at
+ * a time.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ARRAY_LIST_H_
+#define ARRAY_LIST_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** The number of values in a chunk; a power of 2 */
+#define ARRAY_LIST_CHUNK_SIZE 64
+
+/** Reference-counted chunk of values */
+typedef struct {
+    /** The number of tables that share the chunk */
+    atomic_size_t refs;
+    /** Chunk storage; unused values are NULL */
+    char* vals[ARRAY_LIST_CHUNK_SIZE];
+} ArrayListChunk;
+
+/** Reference-counted table of chunks */
+typedef struct {
+    /** The number of lists and snapshots that share the table */
+    atomic_size_t refs;
+    /** The number of allocated chunks */
+    size_t numChunks;
+    /** Capacity of the chunk array */
+    size_t chunkCapacity;
+    /** Allocated chunk array */
+    ArrayListChunk* chunks[];
+} ArrayListTable;
+
+/** Array List data structure */
+typedef struct {
+    /** Table of chunks that store the values */
+    ArrayListTable* table;
+    /** The current size */
+    size_t size;
+    /** Maximum capacity of allocated chunks */
+    size_t maxCapacity;
+} ArrayList;
+
+/** Immutable snapshot of an array list */
+typedef struct {
+    /** Table of chunks shared with the list */
+    ArrayListTable* table;
+    /** The size of the list when the snapshot was taken */
+    size_t size;
+} ArrayListSnapshot;
+
+/**
+ * Create an array list with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the ArrayList.
+ * @return the allocated array list
+ */
+ArrayList *newArrayList(size_t maxCapacity);
+
+/**
+ * Add value to list at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds capacity
+ */
+bool addArrayListValAt(ArrayList *list, size_t index, const char *val);
+
+/**
+ * Add value to start of list. Cannot add NULL string to the list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addFirstArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Add value to end of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addLastArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Get value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListValAt(ArrayList *list, size_t index, const char **val);
+
+/**
+ * Get value at first index.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getFirstArrayListVal(ArrayList *list, const char **val);
+
+/**
+ * Get value at last index.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getLastArrayListVal(ArrayList *list, const char **val);
+
+/**
+ * Set value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setArrayListValAt(ArrayList *list, size_t index, const char *val);
+
+/**
+ * Set value at first index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setFirstArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Set value at last index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setLastArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Returns number of items in the array list.
+ * @param list the ArrayList
+ * @return the number of items in the array list.
+ */
+size_t arrayListSize(ArrayList *list);
+
+/**
+ * Determines whether array list is empty.
+ *
+ * @param list the ArrayList
+ * @return true if array list is empty, false otherwise
+ */
+bool isArrayListEmpty(ArrayList *list);
+
+/**
+ * Delete the array list value at the specified index.
+ *
+ * @param list the ArrayList
+ * @param index the index
+ * @return if index out of bounds
+ */
+bool deleteArrayListValAt(ArrayList *list, size_t index);
+
+/**
+ * Delete the fist array list value.
+ * @param list the ArrayList
+ * @return if list is empty
+ */
+bool deleteFirstArrayListVal(ArrayList *list);
+
+/**
+ * Delete the last array list value.
+ *
+ * @param list the ArrayList
+ * @return if list is empty
+ */
+bool deleteLastArrayListVal(ArrayList *list);
+
+/**
+ * Deletes all array list values.
+ *
+ * @param list the ArrayList
+ */
+void deleteAllArrayListVals(ArrayList *list) ;
+
+/**
+ * Delete the array list. Releases the list storage; storage that
+ * is shared with snapshots remains until the snapshots are deleted.
+ *
+ * @param list the ArrayList
+ */
+void deleteArrayList(ArrayList *list);
+
+/**
+ * Print the array list.
+ * @param list the ArrayList
+ */
+void printArrayList(ArrayList *list);
+
+/**
+ * Take an immutable snapshot of the list in O(1). Must not be
+ * called while the list is being changed by another thread.
+ *
+ * @param list the ArrayList
+ * @return the allocated snapshot
+ */
+ArrayListSnapshot *snapshotArrayList(ArrayList *list);
+
+/**
+ * Get snapshot value at index. The value remains valid until
+ * the snapshot is deleted.
+ *
+ * @param snapshot the ArrayListSnapshot
+ * @param the index for the value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListSnapshotValAt(ArrayListSnapshot *snapshot, size_t index, const char **val);
+
+/**
+ * Returns number of items in the snapshot.
+ *
+ * @param snapshot the ArrayListSnapshot
+ * @return the number of items in the snapshot.
+ */
+size_t arrayListSnapshotSize(ArrayListSnapshot *snapshot);
+
+/**
+ * Delete the snapshot. Releases storage shared with the list
+ * and frees storage that is no longer shared.
+ *
+ * @param snapshot the ArrayListSnapshot
+ */
+void deleteArrayListSnapshot(ArrayListSnapshot *snapshot);
+
+/**
+ * Print the snapshot.
+ *
+ * @param snapshot the ArrayListSnapshot
+ */
+void printArrayListSnapshot(ArrayListSnapshot *snapshot);
+
+#endif /* ARRAY_LIST_H_ */
@@ -0,0 +1,113 @@
+/*
+ * @file array_list_snapshot_main.c
+ *
+ * Test program for ArrayList snapshot functions.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list.h"
+
+/**
+ * Reporting thread that sums the values of a snapshot
+ * while the list continues to change.
+ *
+ * @param arg the snapshot
+ * @return NULL
+ */
+static void *reportSnapshot(void *arg) {
+    ArrayListSnapshot *snapshot = arg;
+    long sum = 0;
+    const char *val;
+    for (int pass = 0; pass < 100; pass++) {
+        for (size_t i = 0; getArrayListSnapshotValAt(snapshot, i, &val); i++) {
+            sum += atol(val);
+        }
+    }
+    printf("reporter: snapshot sum %ld per pass\n", sum / 100);
+    return NULL;
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating array list\n");
+    ArrayList *list = newArrayList(SIZE_MAX);
+
+    printf("\nadding 5 values\n");
+    addLastArrayListVal(list, "B");
+    addLastArrayListVal(list, "D");
+    addFirstArrayListVal(list, "A");
+    addArrayListValAt(list, 2, "C");
+    addLastArrayListVal(list, "E");
+    printArrayList(list);
+
+    printf("\ntaking snapshot\n");
+    ArrayListSnapshot *snapshot = snapshotArrayList(list);
+    printf("snapshot size: %ld\n", arrayListSnapshotSize(snapshot));
+
+    printf("\nsetting list[2] to \"Z\", deleting first, adding \"F\"\n");
+    setArrayListValAt(list, 2, "Z");
+    deleteFirstArrayListVal(list);
+    addLastArrayListVal(list, "F");
+    printf("list: ");
+    printArrayList(list);
+    printf("snapshot: ");
+    printArrayListSnapshot(snapshot);
+
+    printf("\ndeleting all list values\n");
+    deleteAllArrayListVals(list);
+    printf("list: ");
+    printArrayList(list);
+    printf("snapshot: ");
+    printArrayListSnapshot(snapshot);
+    deleteArrayListSnapshot(snapshot);
+
+    printf("\nadding 1000 values\n");
+    char buf[16];
+    for (int i = 0; i < 1000; i++) {
+        sprintf(buf, "%d", i);
+        addLastArrayListVal(list, buf);
+    }
+    snapshot = snapshotArrayList(list);
+    printf("snapshot chunks: %ld\n", snapshot->table->numChunks);
+
+    printf("\nsetting list[999]; only the last chunk is copied\n");
+    setLastArrayListVal(list, "0");
+    size_t shared = 0;
+    for (size_t c = 0; c < list->table->numChunks; c++) {
+        if (list->table->chunks[c] == snapshot->table->chunks[c]) {
+            shared++;
+        }
+    }
+    printf("chunks shared with snapshot: %ld of %ld\n", shared, list->table->numChunks);
+
+    printf("\nreporting on snapshot while deleting values from the list\n");
+    pthread_t reporter;
+    pthread_create(&reporter, NULL, reportSnapshot, snapshot);
+    for (int i = 0; i < 500; i++) {
+        deleteArrayListValAt(list, arrayListSize(list)/2);
+    }
+    pthread_join(reporter, NULL);
+    printf("list size: %ld, snapshot size: %ld\n",
+           arrayListSize(list), arrayListSnapshotSize(snapshot));
+
+    printf("\ndeleting array list, then snapshot\n");
+    deleteArrayList(list);
+    const char *val;
+    if (getArrayListSnapshotValAt(snapshot, 999, &val)) {
+        printf("snapshot[999] after list deleted: %s\n", val);
+    }
+    deleteArrayListSnapshot(snapshot);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
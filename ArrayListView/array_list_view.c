@@ -0,0 +1,266 @@
+/**
+ * @file array_list_view.c
+ *
+ * Implementation for views of a range of an array list.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list_view.h"
+
+/**
+ * Value returned by indexOfArrayListViewVal if value not found.
+ */
+const size_t ARRAY_LIST_VIEW_NOT_FOUND = SIZE_MAX;
+
+/**
+ * Create a view of a range of the list.
+ *
+ * @param list the ArrayList
+ * @param offset the index of the first value in the range
+ * @param length the number of values in the range
+ * @return the allocated view or NULL if range exceeds the list
+ */
+ArrayListView *newArrayListView(ArrayList *list, size_t offset, size_t length) {
+    ArrayListView view;
+    if (!initArrayListView(&view, list, offset, length)) {
+        return NULL;
+    }
+
+    ArrayListView *newView = malloc(sizeof(ArrayListView));
+    *newView = view;
+    return newView;
+}
+
+/**
+ * Initialize an existing view, such as one on the stack, to
+ * a range of the list. No storage is allocated.
+ *
+ * @param view the ArrayListView
+ * @param list the ArrayList
+ * @param offset the index of the first value in the range
+ * @param length the number of values in the range
+ * @return false if range exceeds the list
+ */
+bool initArrayListView(ArrayListView *view, ArrayList *list, size_t offset, size_t length) {
+    // written so that offset + length cannot overflow
+    if (offset > list->size || length > list->size - offset) {
+        return false;
+    }
+
+    view->list = list;
+    view->offset = offset;
+    view->length = length;
+    view->generation = list->generation;
+    return true;
+}
+
+/**
+ * Initialize a view to a range of another view.
+ *
+ * @param view the ArrayListView
+ * @param offset the index of the first value in the range of the view
+ * @param length the number of values in the range
+ * @param subView the view to initialize
+ * @return false if view is stale or range exceeds the view
+ */
+bool subArrayListView(ArrayListView *view, size_t offset, size_t length, ArrayListView *subView) {
+    if (!isArrayListViewValid(view)) {
+        return false;
+    }
+    if (offset > view->length || length > view->length - offset) {
+        return false;
+    }
+
+    subView->list = view->list;
+    subView->offset = view->offset + offset;
+    subView->length = length;
+    subView->generation = view->generation;
+    return true;
+}
+
+/**
+ * Determines whether the list is unchanged since the view was created.
+ *
+ * @param view the ArrayListView
+ * @return true if view is valid, false if stale
+ */
+bool isArrayListViewValid(ArrayListView *view) {
+    return view->generation == view->list->generation;
+}
+
+/**
+ * Returns number of values in the view.
+ *
+ * @param view the ArrayListView
+ * @return the number of values in the view
+ */
+size_t arrayListViewSize(ArrayListView *view) {
+    return view->length;
+}
+
+/**
+ * Determines whether the view is empty.
+ *
+ * @param view the ArrayListView
+ * @return true if view is empty, false otherwise
+ */
+bool isArrayListViewEmpty(ArrayListView *view) {
+    return view->length == 0;
+}
+
+/**
+ * Get value at index of the view.
+ *
+ * @param view the ArrayListView
+ * @param index the index in the view
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or index out of bounds
+ */
+bool getArrayListViewValAt(ArrayListView *view, size_t index, const char **val) {
+    if (index < view->length && isArrayListViewValid(view)) {
+        *val = view->list->vals[view->offset + index];
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Get value at first index of the view.
+ *
+ * @param view the ArrayListView
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or empty
+ */
+bool getFirstArrayListViewVal(ArrayListView *view, const char **val) {
+    return getArrayListViewValAt(view, 0, val);
+}
+
+/**
+ * Get value at last index of the view.
+ *
+ * @param view the ArrayListView
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or empty
+ */
+bool getLastArrayListViewVal(ArrayListView *view, const char **val) {
+    if (view->length == 0) { // prevent negative size_t index
+        return false;
+    }
+    return getArrayListViewValAt(view, view->length-1, val);
+}
+
+/**
+ * Call the callback with each value in the view, in order.
+ * The generation is checked once, so the callback must not
+ * modify the list.
+ *
+ * @param view the ArrayListView
+ * @param cb the callback
+ * @param data the data for the callback
+ * @return true if all values visited, false if view is stale
+ *   or callback stopped early
+ */
+bool forEachArrayListViewVal(ArrayListView *view, ArrayListViewCallback cb, void *data) {
+    if (!isArrayListViewValid(view)) {
+        return false;
+    }
+
+    char **vals = view->list->vals + view->offset;
+    for (size_t i = 0; i < view->length; i++) {
+        if (!cb(vals[i], i, data)) {
+            return false;  // callback signals early completion
+        }
+    }
+    return true;
+}
+
+/**
+ * Find the first index of a value in the view.
+ *
+ * @param view the ArrayListView
+ * @param val the value to find; cannot be null
+ * @return the index in the view, or ARRAY_LIST_VIEW_NOT_FOUND
+ *   if not found or view is stale
+ */
+size_t indexOfArrayListViewVal(ArrayListView *view, const char *val) {
+    if (isArrayListViewValid(view)) {
+        char **vals = view->list->vals + view->offset;
+        for (size_t i = 0; i < view->length; i++) {
+            if (strcmp(vals[i], val) == 0) {
+                return i;
+            }
+        }
+    }
+    return ARRAY_LIST_VIEW_NOT_FOUND;
+}
+
+/**
+ * Find the index of a value in a view whose values are sorted in
+ * strcmp() order.
+ *
+ * @param view the ArrayListView
+ * @param val the value to find; cannot be null
+ * @return the index in the view, or ARRAY_LIST_VIEW_NOT_FOUND
+ *   if not found or view is stale
+ */
+size_t searchSortedArrayListViewVal(ArrayListView *view, const char *val) {
+    if (isArrayListViewValid(view)) {
+        char **vals = view->list->vals + view->offset;
+        // search half-open range [lo, hi)
+        size_t lo = 0, hi = view->length;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            int cmp = strcmp(vals[mid], val);
+            if (cmp == 0) {
+                return mid;
+            } else if (cmp < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+    return ARRAY_LIST_VIEW_NOT_FOUND;
+}
+
+/**
+ * Delete a view created by newArrayListView(). The list and
+ * its values are not affected.
+ *
+ * @param view the ArrayListView
+ */
+void deleteArrayListView(ArrayListView *view) {
+    // set fields to safe values
+    view->list = NULL;
+    view->offset = 0;
+    view->length = 0;
+
+    free(view);
+}
+
+/**
+ * Print the array list view.
+ *
+ * @param view the ArrayListView
+ */
+void printArrayListView(ArrayListView *view) {
+    if (!isArrayListViewValid(view)) {
+        printf("(stale view)\n");
+        return;
+    }
+    printf("( ");
+    const char *val;
+    for (size_t i = 0; getArrayListViewValAt(view, i, &val); i++) {
+        printf("\"%s\" ", val);
+    }
+    printf(")\n");
+}
@@ -0,0 +1,183 @@
+/**
+ * @file array_list_view.h
+ *
+ * Declarations for a view of a range of an array list. A view
+ * records the list, the offset and the length of the range, and
+ * reads values directly from the list storage without copying the
+ * strings or the array of string pointers.
+ *
+ * A view remembers the list generation when it is created. Any
+ * change to the list values or positions advances the generation,
+ * and the view is then stale: its operations return false until
+ * it is re-initialized with initArrayListView.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ARRAY_LIST_VIEW_H_
+#define ARRAY_LIST_VIEW_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "array_list.h"
+
+/** Array list view data structure */
+typedef struct {
+    /** The viewed list */
+    ArrayList *list;
+    /** Index of the first viewed value in the list */
+    size_t offset;
+    /** The number of viewed values */
+    size_t length;
+    /** The list generation when the view was created */
+    size_t generation;
+} ArrayListView;
+
+/**
+ * Value returned by indexOfArrayListViewVal if value not found
+ */
+extern const size_t ARRAY_LIST_VIEW_NOT_FOUND;
+
+/**
+ * ArrayListView callback function type. Called with each value and
+ * its index in the view. Returns true to continue, false to stop.
+ */
+typedef bool (*ArrayListViewCallback)(const char *val, size_t index, void *data);
+
+/**
+ * Create a view of a range of the list.
+ *
+ * @param list the ArrayList
+ * @param offset the index of the first value in the range
+ * @param length the number of values in the range
+ * @return the allocated view or NULL if range exceeds the list
+ */
+ArrayListView *newArrayListView(ArrayList *list, size_t offset, size_t length);
+
+/**
+ * Initialize an existing view, such as one on the stack, to
+ * a range of the list. No storage is allocated.
+ *
+ * @param view the ArrayListView
+ * @param list the ArrayList
+ * @param offset the index of the first value in the range
+ * @param length the number of values in the range
+ * @return false if range exceeds the list
+ */
+bool initArrayListView(ArrayListView *view, ArrayList *list, size_t offset, size_t length);
+
+/**
+ * Initialize a view to a range of another view.
+ *
+ * @param view the ArrayListView
+ * @param offset the index of the first value in the range of the view
+ * @param length the number of values in the range
+ * @param subView the view to initialize
+ * @return false if view is stale or range exceeds the view
+ */
+bool subArrayListView(ArrayListView *view, size_t offset, size_t length, ArrayListView *subView);
+
+/**
+ * Determines whether the list is unchanged since the view was created.
+ *
+ * @param view the ArrayListView
+ * @return true if view is valid, false if stale
+ */
+bool isArrayListViewValid(ArrayListView *view);
+
+/**
+ * Returns number of values in the view.
+ *
+ * @param view the ArrayListView
+ * @return the number of values in the view
+ */
+size_t arrayListViewSize(ArrayListView *view);
+
+/**
+ * Determines whether the view is empty.
+ *
+ * @param view the ArrayListView
+ * @return true if view is empty, false otherwise
+ */
+bool isArrayListViewEmpty(ArrayListView *view);
+
+/**
+ * Get value at index of the view.
+ *
+ * @param view the ArrayListView
+ * @param index the index in the view
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or index out of bounds
+ */
+bool getArrayListViewValAt(ArrayListView *view, size_t index, const char **val);
+
+/**
+ * Get value at first index of the view.
+ *
+ * @param view the ArrayListView
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or empty
+ */
+bool getFirstArrayListViewVal(ArrayListView *view, const char **val);
+
+/**
+ * Get value at last index of the view.
+ *
+ * @param view the ArrayListView
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if view is stale or empty
+ */
+bool getLastArrayListViewVal(ArrayListView *view, const char **val);
+
+/**
+ * Call the callback with each value in the view, in order.
+ *
+ * @param view the ArrayListView
+ * @param cb the callback
+ * @param data the data for the callback
+ * @return true if all values visited, false if view is stale
+ *   or callback stopped early
+ */
+bool forEachArrayListViewVal(ArrayListView *view, ArrayListViewCallback cb, void *data);
+
+/**
+ * Find the first index of a value in the view.
+ *
+ * @param view the ArrayListView
+ * @param val the value to find; cannot be null
+ * @return the index in the view, or ARRAY_LIST_VIEW_NOT_FOUND
+ *   if not found or view is stale
+ */
+size_t indexOfArrayListViewVal(ArrayListView *view, const char *val);
+
+/**
+ * Find the index of a value in a view whose values are sorted in
+ * strcmp() order.
+ *
+ * @param view the ArrayListView
+ * @param val the value to find; cannot be null
+ * @return the index in the view, or ARRAY_LIST_VIEW_NOT_FOUND
+ *   if not found or view is stale
+ */
+size_t searchSortedArrayListViewVal(ArrayListView *view, const char *val);
+
+/**
+ * Delete a view created by newArrayListView(). The list and
+ * its values are not affected.
+ *
+ * @param view the ArrayListView
+ */
+void deleteArrayListView(ArrayListView *view);
+
+/**
+ * Print the array list view.
+ *
+ * @param view the ArrayListView
+ */
+void printArrayListView(ArrayListView *view);
+
+#endif /* ARRAY_LIST_VIEW_H_ */
@@ -0,0 +1,106 @@
+/*
+ * @file array_list_view_main.c
+ *
+ * Test program for ArrayListView functions.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list_view.h"
+
+/**
+ * Computes the aggregate length of the strings in the view
+ * @param val the current value
+ * @param index the index of the value in the view
+ * @param data pointer to the aggregate length
+ * @return true to continue
+ */
+bool getStrLenCallback(const char *val, size_t index, void *data) {
+    size_t *len = data;
+    *len += strlen(val);
+    return true;
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating array list\n");
+    ArrayList *list = newArrayList(SIZE_MAX);
+    addLastArrayListVal(list, "A");
+    addLastArrayListVal(list, "B");
+    addLastArrayListVal(list, "CC");
+    addLastArrayListVal(list, "DDD");
+    addLastArrayListVal(list, "E");
+    addLastArrayListVal(list, "F");
+    printArrayList(list);
+
+    printf("\ncreating view of list[1..4]\n");
+    ArrayListView *view = newArrayListView(list, 1, 4);
+    printArrayListView(view);
+    printf("view size: %lu\n", arrayListViewSize(view));
+
+    const char *val;
+    if (getFirstArrayListViewVal(view, &val)) {
+        printf("view first: %s\n", val);
+    }
+    if (getLastArrayListViewVal(view, &val)) {
+        printf("view last: %s\n", val);
+    }
+    if (getArrayListViewValAt(view, 4, &val)) {
+        printf("error: got view[4] \"%s\" beyond view\n", val);
+    } else {
+        printf("cannot access view[4]\n");
+    }
+
+    size_t len = 0;
+    forEachArrayListViewVal(view, getStrLenCallback, &len);
+    printf("length of view strings: %lu\n", len);
+
+    printf("index of \"CC\" in view: %lu\n", indexOfArrayListViewVal(view, "CC"));
+    printf("sorted search for \"DDD\" in view: %lu\n", searchSortedArrayListViewVal(view, "DDD"));
+    printf("\"F\" in view? %s\n",
+           indexOfArrayListViewVal(view, "F") == ARRAY_LIST_VIEW_NOT_FOUND ? "false" : "true");
+
+    printf("\ncreating stack view of view[1..2]\n");
+    ArrayListView subView;
+    if (subArrayListView(view, 1, 2, &subView)) {
+        printArrayListView(&subView);
+    } else {
+        printf("cannot create sub view\n");
+    }
+
+    printf("\nview of list[5..8] valid? %s\n",
+           newArrayListView(list, 5, 4) == NULL ? "false" : "true");
+
+    printf("\nsetting list[2] to \"Z\"\n");
+    setArrayListValAt(list, 2, "Z");
+    printf("view valid? %s\n", isArrayListViewValid(view) ? "true" : "false");
+    printf("sub view valid? %s\n", isArrayListViewValid(&subView) ? "true" : "false");
+    if (getArrayListViewValAt(view, 0, &val)) {
+        printf("error: got stale view[0] \"%s\"\n", val);
+    } else {
+        printf("cannot access stale view[0]\n");
+    }
+    printArrayListView(view);
+
+    printf("\nre-initializing view on modified list\n");
+    initArrayListView(view, list, 1, 4);
+    printArrayListView(view);
+
+    printf("\ndeleting view\n");
+    deleteArrayListView(view);
+    printArrayList(list);
+
+    printf("\ndeleting array list\n");
+    deleteArrayList(list);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
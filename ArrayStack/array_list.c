@@ -22,37 +22,41 @@ ArrayList *newArrayList(size_t maxCapacity) {
 	ArrayList *list = malloc(sizeof(ArrayList));
 	list->size = 0;
 	list->capacity = 2;  // small power of 2
-    list->maxCapacity = (maxCapacity < 2) ? maxCapacity : 2;
+	list->maxCapacity = maxCapacity;
 	list->vals = calloc(list->capacity, sizeof(char*)); // nulls ptrs
 
 	return list;
 }
 
 /**
- * Ensure array has sufficient capacity to add a new element. If
+ * Ensure array has sufficient capacity to add new elements. If
  * it currently does not, grow the array so that it does, up to
  * the maximum capacity.
  *
  * @param list the array list
- * @return true if list has sufficient size for a new element,
- *   false if at maximum capacity or there is no room to grow it
+ * @param count the number of elements to add
+ * @return true if list has sufficient size for the new elements,
+ *   false if they would exceed maximum capacity or there is no room
+ *   to grow it
  */
-static bool ensureArrayCapacity(ArrayList *list) {
-	// need to grow array if size is at capacity
-	if (list->size == list->capacity) {
-		// done if already at maxCapacity
-		if (list->capacity == list->maxCapacity) {
+static bool ensureArrayCapacity(ArrayList *list, size_t count) {
+	// need to grow array if the new elements do not fit
+	if (count > list->capacity - list->size) {
+		// done if they would exceed maxCapacity
+		if (count > list->maxCapacity - list->size) {
 			return false;
 		}
 
-		// if over, use maxCapacity
-		size_t newCapacity;
-		if (list->maxCapacity - list->capacity < list->capacity) {
-			// no room to double: set to maxCapacity
-			newCapacity = list->maxCapacity;
-		} else {
-			// double current capacity
-			newCapacity = list->capacity * 2;
+		// double until large enough; if over, use maxCapacity
+		size_t newCapacity = list->capacity;
+		while (newCapacity - list->size < count) {
+			if (list->maxCapacity - newCapacity < newCapacity) {
+				// no room to double: set to maxCapacity
+				newCapacity = list->maxCapacity;
+			} else {
+				// double current capacity
+				newCapacity *= 2;
+			}
 		}
 
 		// realloc memory to new capacity
@@ -61,7 +65,7 @@ static bool ensureArrayCapacity(ArrayList *list) {
 			return false;
 		}
 		// initialize new memory to NULL
-		for (int i = list->capacity; i < newCapacity; i++) {
+		for (size_t i = list->capacity; i < newCapacity; i++) {
 			newVals[i] = NULL;
 		}
 		list->capacity = newCapacity;
@@ -85,7 +89,7 @@ bool addArrayListValAt(ArrayList *list, size_t index, const char *val) {
 	}
 
 	// ensure that array has sufficient capacity to add an element
-	if (!ensureArrayCapacity(list)) {
+	if (!ensureArrayCapacity(list, 1)) {
 		return false;
 	}
 
@@ -213,6 +217,160 @@ bool setLastArrayListVal(ArrayList *list, const char *val) {
 	return setArrayListValAt(list, list->size-1, val);
 }
 
+/**
+ * Exchange the values at two indexes without copying them.
+ *
+ * @param list the ArrayList
+ * @param index1 the first index
+ * @param index2 the second index
+ * @return false if either index is out of bounds
+ */
+bool swapArrayListValsAt(ArrayList *list, size_t index1, size_t index2) {
+	if (index1 >= list->size || index2 >= list->size) {
+		return false;
+	}
+	char *val = list->vals[index1];
+	list->vals[index1] = list->vals[index2];
+	list->vals[index2] = val;
+	return true;
+}
+
+/**
+ * Move the value at one index to another without copying it,
+ * shifting the values in between by one place.
+ *
+ * @param list the ArrayList
+ * @param from the index of the value to move
+ * @param to the index the value moves to
+ * @return false if either index is out of bounds
+ */
+bool rotateArrayListVals(ArrayList *list, size_t from, size_t to) {
+	if (from >= list->size || to >= list->size) {
+		return false;
+	}
+	char *val = list->vals[from];
+	if (from < to) {
+		memmove(&list->vals[from], &list->vals[from+1], (to - from) * sizeof(char*));
+	} else {
+		memmove(&list->vals[to+1], &list->vals[to], (from - to) * sizeof(char*));
+	}
+	list->vals[to] = val;
+	return true;
+}
+
+/**
+ * Add copies of values to the list at index, growing the array at
+ * most once and shifting the following values once.
+ *
+ * @param list the ArrayList
+ * @param index the index for the first new value
+ * @param vals the values to insert, in list order; values will be
+ *   copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addArrayListValsAt(ArrayList *list, size_t index, const char *const vals[], size_t count) {
+	// beyond end of list
+	if (index > list->size) {
+		return false;
+	}
+	if (!ensureArrayCapacity(list, count)) {
+		return false;
+	}
+
+	// move elements down once to make room for all new elements
+	memmove(&list->vals[index+count], &list->vals[index], (list->size - index) * sizeof(char*));
+	for (size_t i = 0; i < count; i++) {
+		list->vals[index+i] = strdup(vals[i]);  // must copy input string
+		if (list->vals[index+i] == NULL) {
+			// undo: free the copies and move elements back
+			while (i > 0) {
+				free(list->vals[index + --i]);
+			}
+			memmove(&list->vals[index], &list->vals[index+count],
+					(list->size - index) * sizeof(char*));
+			for (size_t j = list->size; j < list->size + count; j++) {
+				list->vals[j] = NULL;
+			}
+			return false;
+		}
+	}
+	list->size += count;
+	return true;
+}
+
+/**
+ * Remove values from the list at index without copying them, and
+ * shift the following values once. The caller owns the values.
+ *
+ * @param list the ArrayList
+ * @param index the index of the first value to remove
+ * @param vals result parameter for the values, in list order;
+ *   returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index;
+ *   the list is then unchanged
+ */
+bool removeArrayListValsAt(ArrayList *list, size_t index, char *vals[], size_t count) {
+	if (index > list->size || count > list->size - index) {
+		return false;
+	}
+	memcpy(vals, &list->vals[index], count * sizeof(char*));
+
+	// move elements up once and clear the freed pointers
+	list->size -= count;
+	memmove(&list->vals[index], &list->vals[index+count], (list->size - index) * sizeof(char*));
+	for (size_t i = list->size; i < list->size + count; i++) {
+		list->vals[i] = NULL;
+	}
+	return true;
+}
+
+/**
+ * Remove the last values from the list without copying them,
+ * last value first. The caller owns the values.
+ *
+ * @param list the ArrayList
+ * @param vals result parameter for the values, in reverse list
+ *   order; returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values;
+ *   the list is then unchanged
+ */
+bool removeLastArrayListVals(ArrayList *list, char *vals[], size_t count) {
+	if (count > list->size) {
+		return false;
+	}
+
+	// copy from the end down, clearing the freed pointers
+	for (size_t i = 0; i < count; i++) {
+		vals[i] = list->vals[--list->size];
+		list->vals[list->size] = NULL;
+	}
+	return true;
+}
+
+/**
+ * Reverse the order of values in a range without copying them.
+ *
+ * @param list the ArrayList
+ * @param index the index of the first value
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index
+ */
+bool reverseArrayListVals(ArrayList *list, size_t index, size_t count) {
+	if (index > list->size || count > list->size - index) {
+		return false;
+	}
+	for (size_t i = index, j = index + count; i + 1 < j; i++, j--) {
+		char *val = list->vals[i];
+		list->vals[i] = list->vals[j-1];
+		list->vals[j-1] = val;
+	}
+	return true;
+}
+
 /**
  * Returns number of values in the array list.
  *
@@ -56,6 +56,21 @@ bool pushArrayStackVal(ArrayStack *stack, const char *val) {
 	return addLastArrayListVal(stack->list, val);
 }
 
+/**
+ * Push values onto the stack with one capacity check and one copy
+ * pass. Equivalent to pushing each value in turn, so vals[n-1]
+ * ends on top.
+ * @param stack the ArrayStack
+ * @param vals the values to push; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     stack is then unchanged
+ */
+bool pushNArrayStackVals(ArrayStack *stack, const char *const vals[], size_t n) {
+	return addArrayListValsAt(stack->list, arrayListSize(stack->list), vals, n);
+}
+
 /**
  * Get the top stack value without removing it.
  * @param stack the ArrayStack
@@ -95,6 +110,20 @@ bool popArrayStackVal(ArrayStack *stack, char **val) {
 	return false;
 }
 
+/**
+ * Deletes and returns the top n values without copying them.
+ * Equivalent to popping n times, so vals[0] is the old top.
+ * @param stack the array stack
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if stack has fewer than n values; the stack is
+ *   then unchanged
+ */
+bool popNArrayStackVals(ArrayStack *stack, char *vals[], size_t n) {
+	return removeLastArrayListVals(stack->list, vals, n);
+}
+
 /**
  * Exchange the top two stack values.
  * @param stack the ArrayStack
@@ -103,21 +132,7 @@ bool popArrayStackVal(ArrayStack *stack, char **val) {
  */
 bool swapArrayStackVal(ArrayStack *stack) {
 	size_t size = arrayListSize(stack->list);
-	if (size >= 2) {
-		// NOTE: having swapArrayListValsAt(stack->list, i, j)
-		// would make this operation much more efficient
-		char *val1, *val2;
-		popArrayStackVal(stack, &val1);
-		popArrayStackVal(stack, &val2);
-		pushArrayStackVal(stack, val1);
-		pushArrayStackVal(stack, val2);
-
-		// must free because pop returns allocated storage
-		free(val1);
-		free(val2);
-		return true;
-	}
-	return false;
+	return size >= 2 && swapArrayListValsAt(stack->list, size-1, size-2);
 }
 
 /**
@@ -133,6 +148,85 @@ bool dupArrayStackVal(ArrayStack *stack) {
 	return false;
 }
 
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the ArrayStack
+ * @return false if the stack does not have three values
+ */
+bool rotArrayStackVal(ArrayStack *stack) {
+	return rollArrayStackVal(stack, 2);
+}
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * Only the new value is allocated.
+ * @param stack the ArrayStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overArrayStackVal(ArrayStack *stack) {
+	return pickArrayStackVal(stack, 1);
+}
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup and
+ * pick 1 is over. Only the new value is allocated.
+ * @param stack the ArrayStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickArrayStackVal(ArrayStack *stack, size_t n) {
+	size_t size = arrayListSize(stack->list);
+	const char *val;
+	// top is the last value
+	if (n < size && getArrayListValAt(stack->list, size-1-n, &val)) {
+		return pushArrayStackVal(stack, val);
+	}
+	return false;
+}
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param stack the ArrayStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollArrayStackVal(ArrayStack *stack, size_t n) {
+	size_t size = arrayListSize(stack->list);
+	if (n >= size) {
+		return false;
+	}
+	return rotateArrayListVals(stack->list, size-1-n, size-1);
+}
+
+/**
+ * Deletes the second stack value: (a b -- b).
+ * @param stack the ArrayStack
+ * @return false if the stack does not have two values
+ */
+bool nipArrayStackVal(ArrayStack *stack) {
+	size_t size = arrayListSize(stack->list);
+	return size >= 2 && deleteArrayListValAt(stack->list, size-2);
+}
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b). Only the new value is allocated.
+ * @param stack the ArrayStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckArrayStackVal(ArrayStack *stack) {
+	size_t size = arrayListSize(stack->list);
+	const char *val;
+	if (size >= 2 && peekArrayStackVal(stack, &val)) {
+		return addArrayListValAt(stack->list, size-2, val);
+	}
+	return false;
+}
+
 /**
  * Deletes top value from the stack.
  * @param stack the ArrayStack
@@ -77,6 +77,62 @@ int main(void) {
 		printf("\ncannot dup value\n");
 	}
 
+	status = rotArrayStackVal(stack);
+	if (status) {
+		printf("\nrotated third to top\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot rotate\n");
+	}
+
+	status = rollArrayStackVal(stack, 4);
+	if (status) {
+		printf("\nrolled value 4 below top to top\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot roll 4\n");
+	}
+
+	status = nipArrayStackVal(stack);
+	if (status) {
+		printf("\nnipped second value\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot nip\n");
+	}
+
+	status = nipArrayStackVal(stack);
+	if (status) {
+		printf("\nnipped second value\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot nip\n");
+	}
+
+	status = pickArrayStackVal(stack, 2);
+	if (status) {
+		printf("\npicked value 2 below top\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot pick 2\n");
+	}
+
+	status = tuckArrayStackVal(stack);
+	if (status) {
+		printf("\ntucked top below second\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot tuck\n");
+	}
+
+	status = overArrayStackVal(stack);
+	if (status) {
+		printf("\nover value\n");
+		printArrayStack(stack);
+	} else {
+		printf("\ncannot over at max capacity\n");
+	}
+
 	empty = isArrayStackEmpty(stack);
 	printf("\nstack empty? %s\n", empty ? "true" : "false");
 	size = arrayStackSize(stack);
@@ -90,6 +146,25 @@ int main(void) {
 	printf("stack size: %ld\n", size);
 	printArrayStack(stack);
 
+	const char *batch[] = { "a", "b", "c", "d" };
+	status = pushNArrayStackVals(stack, batch, 4);
+	printf("\npush 4 values: %s\n", status ? "true" : "false");
+	printArrayStack(stack);
+	status = pushNArrayStackVals(stack, batch, 2);
+	printf("push 2 more past max capacity: %s\n", status ? "true" : "false");
+	char *popped[4];
+	status = popNArrayStackVals(stack, popped, 3);
+	if (status) {
+		printf("pop 3 values: %s %s %s\n", popped[0], popped[1], popped[2]);
+		for (int i = 0; i < 3; i++) {
+			free(popped[i]);
+		}
+	}
+	printArrayStack(stack);
+	status = popNArrayStackVals(stack, popped, 2);
+	printf("pop 2 of 1 value: %s\n", status ? "true" : "false");
+	dropAllArrayStackVals(stack);
+
 	printf("\ndeleting array stack\n");
 	deleteArrayStack(stack);
 
@@ -0,0 +1,197 @@
+/*
+ * array_stack.c
+ *
+ * Code example of ArrayStack for lecture 8.
+ *
+ * Operations add and delete from the front because
+ * that is more efficient for linked lists.
+ *
+ *  @date Nov 8, 2018
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_stack.h"
+#include "trace.h"
+
+
+/**
+ * Create an array stack with an initial capacity and max capacity.
+ *
+ * @param maxCapacity maximum capacity of ArrayStack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @param allocator the allocator for the stack; NULL for default
+ * @return the allocated array stack
+ */
+ArrayStack *newArrayStack(size_t maxCapacity, const Allocator *allocator) {
+	allocator = useAllocator(allocator);
+	ArrayStack *stack = allocatorMalloc(allocator, sizeof(ArrayStack));
+	stack->list = newArrayList(maxCapacity, allocator);
+
+	return stack;
+}
+
+/**
+ * Delete the array stack. Frees copies of all strings,
+ * then the array stack, and finally the stack itself.
+ *
+ * @param stack the ArrayStack
+ */
+void deleteArrayStack(ArrayStack *stack) {
+	// free the strings in the array
+	const Allocator *allocator = stack->list->allocator;
+	deleteArrayList(stack->list);
+	stack->list = NULL;
+
+	// free the stack itself
+	allocatorFree(allocator, stack, sizeof(ArrayStack));
+}
+
+/**
+ * Push value onto the stack. Cannot add NULL string to the stack.
+ * @param stack the ArrayStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if exceeds max capacity
+ */
+bool pushArrayStackVal(ArrayStack *stack, const char *val) {
+	TRACE_OP(stack, tracePush, 0, val);
+	return addLastArrayListVal(stack->list, val);
+}
+
+/**
+ * Get the top stack value without removing it.
+ * @param stack the ArrayStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if empty or operation is not supported
+ */
+bool peekArrayStackVal(ArrayStack *stack, const char **val) {
+	TRACE_OP(stack, tracePeek, 0, NULL);
+	return getLastArrayListVal(stack->list, val);
+}
+
+/**
+ * Set the stack top to a new value.
+ * @param stack the ArrayStack
+ * @param val the value to set; cannot be null
+ * @return false if value is null or operation is not supported
+ */
+bool pokeArrayStackVal(ArrayStack *stack, const char *val) {
+	TRACE_OP(stack, tracePokeTop, 0, val);
+	return setLastArrayListVal(stack->list, val);
+}
+
+/**
+ * Deletes and returns copy of stack top.
+ * @param stack the array stack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ *   with allocatorFreeStr
+ * @return if stack is empty
+ */
+bool popArrayStackVal(ArrayStack *stack, char **val) {
+	TRACE_OP(stack, tracePop, 0, NULL);
+	const char* localVal;
+	// copy first because drop causes returned value to be freed
+	if (getLastArrayListVal(stack->list, &localVal)) {
+		*val = allocatorStrdup(stack->list->allocator, localVal);
+		deleteLastArrayListVal(stack->list);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Exchange the top two stack values.
+ * @param stack the ArrayStack
+ * @return false if the stack does not have two values or
+ *   operation is not supported
+ */
+bool swapArrayStackVal(ArrayStack *stack) {
+	TRACE_OP(stack, traceSwap, 0, NULL);
+	size_t size = arrayListSize(stack->list);
+	if (size >= 2) {
+		// NOTE: having swapArrayListValsAt(stack->list, i, j)
+		// would make this operation much more efficient
+		const char *val1, *val2;
+		getArrayListValAt(stack->list, size-1, &val1);
+		getArrayListValAt(stack->list, size-2, &val2);
+
+		// copy first because set causes replaced value to be freed
+		char *topVal = allocatorStrdup(stack->list->allocator, val1);
+		setArrayListValAt(stack->list, size-1, val2);
+		setArrayListValAt(stack->list, size-2, topVal);
+		allocatorFreeStr(stack->list->allocator, topVal);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Pushes another copy of the top stack value onto the stack.
+ * @param stack the ArrayStack
+ * @return false if the stack is empty or operation is not supported
+ */
+bool dupArrayStackVal(ArrayStack *stack) {
+	TRACE_OP(stack, traceDup, 0, NULL);
+	const char *val;
+	if (getLastArrayListVal(stack->list, &val)) {
+		return addLastArrayListVal(stack->list, val);
+	}
+	return false;
+}
+
+/**
+ * Deletes top value from the stack.
+ * @param stack the ArrayStack
+ * @return false if the stack is empty or operation is not supported
+ */
+bool dropArrayStackVal(ArrayStack *stack) {
+	TRACE_OP(stack, traceDropTop, 0, NULL);
+	return deleteLastArrayListVal(stack->list);
+}
+
+/**
+ * Drops all array stack values.
+ * @param stack the ArrayStack
+ */
+void dropAllArrayStackVals(ArrayStack *stack) {
+	TRACE_OP(stack, traceClear, 0, NULL);
+	deleteAllArrayListVals(stack->list);
+}
+
+/**
+ * Returns number of items in the array stack.
+ * @param stack the ArrayStack
+ * @return the number of items in the array stack.
+ */
+size_t arrayStackSize(ArrayStack *stack) {
+    return arrayListSize(stack->list);
+}
+
+/**
+ * Determines whether array stack is empty.
+ * @param stack the ArrayStack
+ * @return true if array stack is empty, flase otherwise
+ */
+bool isArrayStackEmpty(ArrayStack *stack) {
+	return isArrayListEmpty(stack->list);
+}
+
+/**
+ * Print array stack for diagnostic purposes.
+ *
+ * @param stack the ArrayStack
+ */
+void printArrayStack(ArrayStack *stack) {
+	size_t size = arrayListSize(stack->list);
+	printf("stack (%lu):\n", size);
+	const char *val;
+	for (int i = size-1; i >= 0; i--) {
+		getArrayListValAt(stack->list, i, &val);
+		printf("%s\n", val);
+	}
+}
@@ -0,0 +1,708 @@
+/*
+ * @file container_bench.c
+ *
+ * Microbenchmarks for every container and operation. Each
+ * container is filled to sizes 10^2, 10^3, ... up to maxSize, and
+ * each operation is timed at that size for a fixed time budget.
+ * Results are written to stdout as JSON with ns/op, ops/sec and
+ * allocations/op so runs can be compared across commits; progress
+ * is written to stderr.
+ *
+ * Operations that change the size run in rounds of at most size/2
+ * timed operations followed by untimed operations that restore the
+ * size, so each operation is measured at close to the given size.
+ * Allocations are counted by a counting allocator passed to each
+ * container, and include only allocations made while timing.
+ *
+ * With --perf, hardware performance counters are also read around
+ * the timed operations, and cycles, instructions, IPC, and cache,
+ * branch and TLB misses per operation are added to each result.
+ * Counters the system does not provide are reported as null.
+ *
+ * Usage: container_bench [--perf] [maxSize [budgetMillis [container]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "allocator.h"
+#include "array_deque.h"
+#include "array_list.h"
+#include "array_queue.h"
+#include "array_stack.h"
+#include "linked_list.h"
+#include "linked_stack.h"
+#include "messagepriorityqueue.h"
+#include "perf_counters.h"
+
+/** Default maximum container size */
+#define DEFAULT_MAX_SIZE 10000000
+/** Default time budget for each operation and size in milliseconds */
+#define DEFAULT_BUDGET_MILLIS 200
+/** Chunks of operations shorter than this are doubled */
+#define MIN_CHUNK_NANOS 1000000
+/** Maximum operations between clock reads */
+#define MAX_CHUNK (1 << 20)
+
+/** Value stored by all operations */
+static const char *benchVal = "value";
+
+/** Allocations made through the counting allocator */
+static size_t allocCount;
+
+/** Performance counters; NULL unless enabled with --perf */
+static PerfCounters *perfCounters;
+
+/** Receives values read so the compiler keeps the reads */
+static volatile size_t checksumSink;
+
+/**
+ * Allocate memory and count the allocation.
+ *
+ * @param ctx unused
+ * @param size the number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *countingMalloc(void *ctx, size_t size) {
+    allocCount++;
+    return malloc(size);
+}
+
+/**
+ * Resize memory and count the allocation.
+ *
+ * @param ctx unused
+ * @param ptr the memory to resize
+ * @param oldSize unused
+ * @param newSize the new number of bytes
+ * @return the memory, or NULL if out of memory
+ */
+static void *countingRealloc(void *ctx, void *ptr, size_t oldSize, size_t newSize) {
+    allocCount++;
+    return realloc(ptr, newSize);
+}
+
+/**
+ * Free memory.
+ *
+ * @param ctx unused
+ * @param ptr the memory to free
+ * @param size unused
+ */
+static void countingFree(void *ctx, void *ptr, size_t size) {
+    free(ptr);
+}
+
+/**
+ * Copy a string and count the allocation.
+ *
+ * @param ctx unused
+ * @param str the string to copy
+ * @param len the length of the string
+ * @return the copy
+ */
+static char *countingStrndup(void *ctx, const char *str, size_t len) {
+    allocCount++;
+    return strndup(str, len);
+}
+
+/** Allocator passed to every container */
+static const Allocator countingAllocator = {
+    countingMalloc, countingRealloc, countingFree, countingStrndup, NULL
+};
+
+/**
+ * Returns the next pseudo-random number (xorshift64).
+ *
+ * @param state the generator state; must not be 0
+ * @return the next number
+ */
+static uint64_t nextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+ * Returns the monotonic clock time in nanoseconds.
+ *
+ * @return the time
+ */
+static uint64_t nowNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/** A benchmarked operation */
+typedef struct {
+    /** the operation name */
+    const char *name;
+    /** performs the operation on a container of size n, and
+        returns the number of element operations performed */
+    size_t (*run)(void *container, size_t n, uint64_t *rng);
+    /** reverses one run to restore the size; NULL if run
+        does not change the size */
+    void (*undo)(void *container, size_t n);
+} BenchOp;
+
+/** A benchmarked container */
+typedef struct {
+    /** the container name */
+    const char *name;
+    /** creates an empty container */
+    void *(*create)(void);
+    /** adds a value while filling the container */
+    void (*fill)(void *container);
+    /** deletes the container */
+    void (*destroy)(void *container);
+    /** the operations, ending with an entry with a NULL name */
+    BenchOp ops[8];
+} BenchContainer;
+
+/* ---- ArrayList ---- */
+
+/** Create an empty ArrayList. */
+static void *createArrayList(void) {
+    return newArrayList(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the ArrayList while filling it. */
+static void fillArrayList(void *c) {
+    addLastArrayListVal(c, benchVal);
+}
+/** Delete the ArrayList. */
+static void destroyArrayList(void *c) {
+    deleteArrayList(c);
+}
+/** Benchmark operation push on the ArrayList. */
+static size_t pushArrayList(void *c, size_t n, uint64_t *rng) {
+    addLastArrayListVal(c, benchVal);
+    return 1;
+}
+/** Reverse one push on the ArrayList. */
+static void pushArrayListUndo(void *c, size_t n) {
+    deleteLastArrayListVal(c);
+}
+/** Benchmark operation pop on the ArrayList. */
+static size_t popArrayList(void *c, size_t n, uint64_t *rng) {
+    deleteLastArrayListVal(c);
+    return 1;
+}
+/** Reverse one pop on the ArrayList. */
+static void popArrayListUndo(void *c, size_t n) {
+    addLastArrayListVal(c, benchVal);
+}
+/** Benchmark operation get on the ArrayList. */
+static size_t getArrayList(void *c, size_t n, uint64_t *rng) {
+    const char *val;
+    getArrayListValAt(c, nextRandom(rng) % n, &val);
+    checksumSink += (size_t)val[0];
+    return 1;
+}
+/** Benchmark operation set on the ArrayList. */
+static size_t setArrayList(void *c, size_t n, uint64_t *rng) {
+    setArrayListValAt(c, nextRandom(rng) % n, benchVal);
+    return 1;
+}
+/** Benchmark operation insertMiddle on the ArrayList. */
+static size_t insertMiddleArrayList(void *c, size_t n, uint64_t *rng) {
+    addArrayListValAt(c, arrayListSize(c) / 2, benchVal);
+    return 1;
+}
+/** Reverse one insertMiddle on the ArrayList. */
+static void insertMiddleArrayListUndo(void *c, size_t n) {
+    deleteArrayListValAt(c, arrayListSize(c) / 2);
+}
+/** Benchmark operation iterate on the ArrayList. */
+static size_t iterateArrayList(void *c, size_t n, uint64_t *rng) {
+    ArrayList *list = c;
+    size_t checksum = 0;
+    for (size_t i = 0; i < list->size; i++) {
+        checksum += (size_t)list->vals[i][0];
+    }
+    checksumSink += checksum;
+    return list->size;
+}
+
+/* ---- LinkedList ---- */
+
+/** Create an empty LinkedList. */
+static void *createLinkedList(void) {
+    return newLinkedList(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the LinkedList while filling it. */
+static void fillLinkedList(void *c) {
+    addFirstLinkedListVal(c, benchVal);  // addLast is O(n)
+}
+/** Delete the LinkedList. */
+static void destroyLinkedList(void *c) {
+    deleteLinkedList(c);
+}
+/** Benchmark operation push on the LinkedList. */
+static size_t pushLinkedList(void *c, size_t n, uint64_t *rng) {
+    addFirstLinkedListVal(c, benchVal);
+    return 1;
+}
+/** Reverse one push on the LinkedList. */
+static void pushLinkedListUndo(void *c, size_t n) {
+    deleteFirstLinkedListVal(c);
+}
+/** Benchmark operation pop on the LinkedList. */
+static size_t popLinkedList(void *c, size_t n, uint64_t *rng) {
+    deleteFirstLinkedListVal(c);
+    return 1;
+}
+/** Reverse one pop on the LinkedList. */
+static void popLinkedListUndo(void *c, size_t n) {
+    addFirstLinkedListVal(c, benchVal);
+}
+/** Benchmark operation get on the LinkedList. */
+static size_t getLinkedList(void *c, size_t n, uint64_t *rng) {
+    const char *val;
+    getLinkedListValAt(c, nextRandom(rng) % n, &val);
+    checksumSink += (size_t)val[0];
+    return 1;
+}
+/** Benchmark operation set on the LinkedList. */
+static size_t setLinkedList(void *c, size_t n, uint64_t *rng) {
+    setLinkedListValAt(c, nextRandom(rng) % n, benchVal);
+    return 1;
+}
+/** Benchmark operation insertMiddle on the LinkedList. */
+static size_t insertMiddleLinkedList(void *c, size_t n, uint64_t *rng) {
+    addLinkedListValAt(c, linkedListSize(c) / 2, benchVal);
+    return 1;
+}
+/** Reverse one insertMiddle on the LinkedList. */
+static void insertMiddleLinkedListUndo(void *c, size_t n) {
+    deleteLinkedListValAt(c, linkedListSize(c) / 2);
+}
+/** Benchmark operation iterate on the LinkedList. */
+static size_t iterateLinkedList(void *c, size_t n, uint64_t *rng) {
+    LinkedList *list = c;
+    size_t checksum = 0;
+    for (LinkedNode *node = list->head->next; node != NULL; node = node->next) {
+        checksum += (size_t)node->data[0];
+    }
+    checksumSink += checksum;
+    return list->size;
+}
+
+/* ---- ArrayStack ---- */
+
+/** Create an empty ArrayStack. */
+static void *createArrayStack(void) {
+    return newArrayStack(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the ArrayStack while filling it. */
+static void fillArrayStack(void *c) {
+    pushArrayStackVal(c, benchVal);
+}
+/** Delete the ArrayStack. */
+static void destroyArrayStack(void *c) {
+    deleteArrayStack(c);
+}
+/** Benchmark operation push on the ArrayStack. */
+static size_t pushArrayStack(void *c, size_t n, uint64_t *rng) {
+    pushArrayStackVal(c, benchVal);
+    return 1;
+}
+/** Reverse one push on the ArrayStack. */
+static void pushArrayStackUndo(void *c, size_t n) {
+    dropArrayStackVal(c);
+}
+/** Benchmark operation pop on the ArrayStack. */
+static size_t popArrayStack(void *c, size_t n, uint64_t *rng) {
+    char *val;
+    popArrayStackVal(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+    return 1;
+}
+/** Reverse one pop on the ArrayStack. */
+static void popArrayStackUndo(void *c, size_t n) {
+    pushArrayStackVal(c, benchVal);
+}
+
+/* ---- LinkedStack ---- */
+
+/** Create an empty LinkedStack. */
+static void *createLinkedStack(void) {
+    return newLinkedStack(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the LinkedStack while filling it. */
+static void fillLinkedStack(void *c) {
+    pushLinkedStackVal(c, benchVal);
+}
+/** Delete the LinkedStack. */
+static void destroyLinkedStack(void *c) {
+    deleteLinkedStack(c);
+}
+/** Benchmark operation push on the LinkedStack. */
+static size_t pushLinkedStack(void *c, size_t n, uint64_t *rng) {
+    pushLinkedStackVal(c, benchVal);
+    return 1;
+}
+/** Reverse one push on the LinkedStack. */
+static void pushLinkedStackUndo(void *c, size_t n) {
+    dropLinkedStackVal(c);
+}
+/** Benchmark operation pop on the LinkedStack. */
+static size_t popLinkedStack(void *c, size_t n, uint64_t *rng) {
+    const char *val;
+    popLinkedStackVal(c, &val);
+    allocatorFreeStr(&countingAllocator, (char*)val);
+    return 1;
+}
+/** Reverse one pop on the LinkedStack. */
+static void popLinkedStackUndo(void *c, size_t n) {
+    pushLinkedStackVal(c, benchVal);
+}
+
+/* ---- ArrayQueue ---- */
+
+/** Create an empty ArrayQueue. */
+static void *createArrayQueue(void) {
+    return newArrayQueue(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the ArrayQueue while filling it. */
+static void fillArrayQueue(void *c) {
+    enqueueArrayQueueVal(c, benchVal);
+}
+/** Delete the ArrayQueue. */
+static void destroyArrayQueue(void *c) {
+    deleteArrayQueue(c);
+}
+/** Benchmark operation enqueue on the ArrayQueue. */
+static size_t enqueueArrayQueue(void *c, size_t n, uint64_t *rng) {
+    enqueueArrayQueueVal(c, benchVal);
+    return 1;
+}
+/** Reverse one enqueue on the ArrayQueue. */
+static void enqueueArrayQueueUndo(void *c, size_t n) {
+    dropArrayQueueVal(c);
+}
+/** Benchmark operation dequeue on the ArrayQueue. */
+static size_t dequeueArrayQueue(void *c, size_t n, uint64_t *rng) {
+    char *val;
+    dequeueArrayQueueVal(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+    return 1;
+}
+/** Reverse one dequeue on the ArrayQueue. */
+static void dequeueArrayQueueUndo(void *c, size_t n) {
+    enqueueArrayQueueVal(c, benchVal);
+}
+
+/* ---- ArrayDeque ---- */
+
+/** Create an empty ArrayDeque. */
+static void *createArrayDeque(void) {
+    return newArrayDeque(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the ArrayDeque while filling it. */
+static void fillArrayDeque(void *c) {
+    enqueueArrayDequeVal(c, benchVal);
+}
+/** Delete the ArrayDeque. */
+static void destroyArrayDeque(void *c) {
+    deleteArrayDeque(c);
+}
+/** Benchmark operation push on the ArrayDeque. */
+static size_t pushArrayDeque(void *c, size_t n, uint64_t *rng) {
+    pushArrayDequeVal(c, benchVal);
+    return 1;
+}
+/** Reverse one push or enqueue on the ArrayDeque. */
+static void pushArrayDequeUndo(void *c, size_t n) {
+    dropTopArrayDequeVal(c);
+}
+/** Benchmark operation pop on the ArrayDeque. */
+static size_t popArrayDeque(void *c, size_t n, uint64_t *rng) {
+    char *val;
+    popArrayDequeVal(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+    return 1;
+}
+/** Reverse one pop or dequeue on the ArrayDeque. */
+static void popArrayDequeUndo(void *c, size_t n) {
+    pushArrayDequeVal(c, benchVal);
+}
+/** Benchmark operation enqueue on the ArrayDeque. */
+static size_t enqueueArrayDeque(void *c, size_t n, uint64_t *rng) {
+    enqueueArrayDequeVal(c, benchVal);
+    return 1;
+}
+/** Benchmark operation dequeue on the ArrayDeque. */
+static size_t dequeueArrayDeque(void *c, size_t n, uint64_t *rng) {
+    char *val;
+    dequeueArrayDequeVal(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+    return 1;
+}
+
+/* ---- MessagePriorityQueue ---- */
+
+/** Create an empty MessagePriorityQueue. */
+static void *createMPQ(void) {
+    return newMPQ(SIZE_MAX, &countingAllocator);
+}
+/** Add a value to the MessagePriorityQueue while filling it. */
+static void fillMPQ(void *c) {
+    static uint64_t rng = 0x9E3779B97F4A7C15u;
+    enqueueMessageMPQ(c, benchVal, nextRandom(&rng) % 4);
+}
+/** Delete the MessagePriorityQueue. */
+static void destroyMPQ(void *c) {
+    deleteMPQ(c);
+}
+/** Benchmark operation enqueue on the MessagePriorityQueue. */
+static size_t enqueueMPQ(void *c, size_t n, uint64_t *rng) {
+    enqueueMessageMPQ(c, benchVal, nextRandom(rng) % 4);
+    return 1;
+}
+/** Reverse one enqueue on the MessagePriorityQueue. */
+static void enqueueMPQUndo(void *c, size_t n) {
+    char *val;
+    dequeueMessageMPQ(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+}
+/** Benchmark operation dequeue on the MessagePriorityQueue. */
+static size_t dequeueMPQ(void *c, size_t n, uint64_t *rng) {
+    char *val;
+    dequeueMessageMPQ(c, &val);
+    allocatorFreeStr(&countingAllocator, val);
+    return 1;
+}
+/** Reverse one dequeue on the MessagePriorityQueue. */
+static void dequeueMPQUndo(void *c, size_t n) {
+    fillMPQ(c);
+}
+
+/** The benchmarked containers and operations */
+static const BenchContainer containers[] = {
+    { "ArrayList", createArrayList, fillArrayList, destroyArrayList, {
+        { "push", pushArrayList, pushArrayListUndo },
+        { "pop", popArrayList, popArrayListUndo },
+        { "get", getArrayList, NULL },
+        { "set", setArrayList, NULL },
+        { "insertMiddle", insertMiddleArrayList, insertMiddleArrayListUndo },
+        { "iterate", iterateArrayList, NULL },
+        { NULL } } },
+    { "LinkedList", createLinkedList, fillLinkedList, destroyLinkedList, {
+        { "push", pushLinkedList, pushLinkedListUndo },
+        { "pop", popLinkedList, popLinkedListUndo },
+        { "get", getLinkedList, NULL },
+        { "set", setLinkedList, NULL },
+        { "insertMiddle", insertMiddleLinkedList, insertMiddleLinkedListUndo },
+        { "iterate", iterateLinkedList, NULL },
+        { NULL } } },
+    { "ArrayStack", createArrayStack, fillArrayStack, destroyArrayStack, {
+        { "push", pushArrayStack, pushArrayStackUndo },
+        { "pop", popArrayStack, popArrayStackUndo },
+        { NULL } } },
+    { "LinkedStack", createLinkedStack, fillLinkedStack, destroyLinkedStack, {
+        { "push", pushLinkedStack, pushLinkedStackUndo },
+        { "pop", popLinkedStack, popLinkedStackUndo },
+        { NULL } } },
+    { "ArrayQueue", createArrayQueue, fillArrayQueue, destroyArrayQueue, {
+        { "enqueue", enqueueArrayQueue, enqueueArrayQueueUndo },
+        { "dequeue", dequeueArrayQueue, dequeueArrayQueueUndo },
+        { NULL } } },
+    { "ArrayDeque", createArrayDeque, fillArrayDeque, destroyArrayDeque, {
+        { "push", pushArrayDeque, pushArrayDequeUndo },
+        { "pop", popArrayDeque, popArrayDequeUndo },
+        { "enqueue", enqueueArrayDeque, pushArrayDequeUndo },
+        { "dequeue", dequeueArrayDeque, popArrayDequeUndo },
+        { NULL } } },
+    { "MessagePriorityQueue", createMPQ, fillMPQ, destroyMPQ, {
+        { "enqueue", enqueueMPQ, enqueueMPQUndo },
+        { "dequeue", dequeueMPQ, dequeueMPQUndo },
+        { NULL } } },
+};
+
+/** Result of one benchmark */
+typedef struct {
+    /** element operations performed */
+    size_t ops;
+    /** time spent in timed operations */
+    uint64_t nanos;
+    /** allocations made in timed operations */
+    size_t allocs;
+    /** performance counts in timed operations */
+    uint64_t counts[perfNumCounters];
+} BenchResult;
+
+/**
+ * Run one operation on a container of size n until the time
+ * budget is used up.
+ *
+ * @param container the container, filled to size n
+ * @param n the container size
+ * @param op the operation
+ * @param budgetNanos the time budget
+ * @param result result parameter for the measurements
+ */
+static void runBenchOp(void *container, size_t n, const BenchOp *op,
+                       uint64_t budgetNanos, BenchResult *result) {
+    uint64_t rng = 0x2545F4914F6CDD1Du;
+    size_t roundLimit = (op->undo == NULL) ? SIZE_MAX : (n / 2 > 0 ? n / 2 : 1);
+    size_t chunk = 1;
+    *result = (BenchResult){0};
+    if (perfCounters != NULL) {
+        resetPerfCounters(perfCounters);
+    }
+
+    while (result->nanos < budgetNanos) {
+        // timed operations in chunks that double until they are long
+        // enough that reading the clock does not skew the results
+        size_t roundCalls = 0;
+        while (roundCalls < roundLimit && result->nanos < budgetNanos) {
+            size_t calls = (chunk < roundLimit - roundCalls) ? chunk : roundLimit - roundCalls;
+            size_t allocsBefore = allocCount;
+            if (perfCounters != NULL) {
+                startPerfCounters(perfCounters);
+            }
+            uint64_t start = nowNanos();
+            for (size_t i = 0; i < calls; i++) {
+                result->ops += op->run(container, n, &rng);
+            }
+            uint64_t elapsed = nowNanos() - start;
+            if (perfCounters != NULL) {
+                stopPerfCounters(perfCounters);
+            }
+            result->allocs += allocCount - allocsBefore;
+            result->nanos += elapsed;
+            roundCalls += calls;
+            if (calls == chunk && elapsed < MIN_CHUNK_NANOS && chunk < MAX_CHUNK) {
+                chunk *= 2;
+            }
+        }
+
+        // untimed operations to restore the size
+        if (op->undo != NULL) {
+            for (size_t i = 0; i < roundCalls; i++) {
+                op->undo(container, n);
+            }
+        }
+    }
+
+    if (perfCounters != NULL) {
+        readPerfCounters(perfCounters, result->counts);
+    }
+}
+
+/**
+ * Print the performance counts of one result as a JSON object
+ * of per-operation metrics.
+ *
+ * @param result the measurements
+ */
+static void printPerfMetrics(const BenchResult *result) {
+    double ops = (result->ops == 0) ? 1 : (double)result->ops;
+    printf(", \"perf\": {");
+    for (PerfCounter c = perfCycles; c < perfNumCounters; c++) {
+        printf("%s\"%s_per_op\": ", (c == perfCycles) ? "" : ", ", perfCounterName(c));
+        if (isPerfCounterAvailable(perfCounters, c)) {
+            printf("%.4f", result->counts[c] / ops);
+        } else {
+            printf("null");
+        }
+    }
+    printf(", \"ipc\": ");
+    if (isPerfCounterAvailable(perfCounters, perfCycles)
+        && isPerfCounterAvailable(perfCounters, perfInstructions)
+        && result->counts[perfCycles] > 0) {
+        printf("%.3f", (double)result->counts[perfInstructions] / result->counts[perfCycles]);
+    } else {
+        printf("null");
+    }
+    printf("}");
+}
+
+/**
+ * Print one result as a JSON object.
+ *
+ * @param first true if this is the first result
+ * @param container the container name
+ * @param op the operation name
+ * @param n the container size
+ * @param result the measurements
+ */
+static void printBenchResult(bool first, const char *container, const char *op,
+                             size_t n, const BenchResult *result) {
+    double nsPerOp = (result->ops == 0) ? 0 : (double)result->nanos / result->ops;
+    double opsPerSec = (result->nanos == 0) ? 0 : result->ops * 1e9 / result->nanos;
+    double allocsPerOp = (result->ops == 0) ? 0 : (double)result->allocs / result->ops;
+    printf("%s    {\"container\": \"%s\", \"op\": \"%s\", \"size\": %zu, "
+           "\"ops\": %zu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.1f, "
+           "\"allocs_per_op\": %.4f",
+           first ? "" : ",\n", container, op, n, result->ops,
+           nsPerOp, opsPerSec, allocsPerOp);
+    if (perfCounters != NULL) {
+        printPerfMetrics(result);
+    }
+    printf("}");
+    fflush(stdout);
+}
+
+/**
+ * Run the benchmarks.
+ */
+int main(int argc, char *argv[]) {
+    PerfCounters counters;
+    if (argc > 1 && strcmp(argv[1], "--perf") == 0) {
+        if (openPerfCounters(&counters)) {
+            perfCounters = &counters;
+        } else {
+            fprintf(stderr, "performance counters unavailable; timing only\n");
+        }
+        argc--;
+        argv++;
+    }
+
+    size_t maxSize = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_MAX_SIZE;
+    uint64_t budgetMillis = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_BUDGET_MILLIS;
+    const char *filter = (argc > 3) ? argv[3] : NULL;
+
+    printf("{\n  \"max_size\": %zu,\n  \"budget_millis\": %llu,\n"
+           "  \"perf_counters\": %s,\n  \"results\": [\n",
+           maxSize, (unsigned long long)budgetMillis,
+           (perfCounters != NULL) ? "true" : "false");
+    bool first = true;
+    size_t numContainers = sizeof(containers) / sizeof(containers[0]);
+    for (size_t c = 0; c < numContainers; c++) {
+        const BenchContainer *bc = &containers[c];
+        if (filter != NULL && strcmp(filter, bc->name) != 0) {
+            continue;
+        }
+        for (size_t n = 100; n <= maxSize; n *= 10) {
+            // fill once per size; every operation restores the size
+            void *container = bc->create();
+            for (size_t i = 0; i < n; i++) {
+                bc->fill(container);
+            }
+            for (const BenchOp *op = bc->ops; op->name != NULL; op++) {
+                fprintf(stderr, "%s %s %zu\n", bc->name, op->name, n);
+                BenchResult result;
+                runBenchOp(container, n, op, budgetMillis * 1000000u, &result);
+                printBenchResult(first, bc->name, op->name, n, &result);
+                first = false;
+            }
+            bc->destroy(container);
+        }
+    }
+    printf("\n  ]\n}\n");
+
+    if (perfCounters != NULL) {
+        closePerfCounters(perfCounters);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,224 @@
+/*
+ * @file linked_array.c
+ *
+ * This file provides the definitions for functions that operate on
+ * chains of linked nodes. Methods can be used in one of two ways.
+ *
+ * If the empty chain of nodes is represented by a NULL pointer,
+ * then add the first item by setting the pointer to the first item.
+ * Delete the final node by freeing it and setting the pointer to NULL.
+ *
+ * If the empty node chain is represented by a dummy first node,
+ * then add the first item by calling addAfterLinkedNode() with the
+ * dummy node and the first node, delete the last item by calling
+ * deleteAfterLinkedNode() with the dummy first node, and get
+ * the size excluding the dummy node by passing the dummy node's
+ * next pointer to getLinkedSize().
+ *
+ *  @date Nov 8, 2018
+ *  @author: Nam H. Nguyen
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "linked_node.h"
+
+
+/**
+ * Create and initialize new node.
+ *
+ * @param data the data for the node.
+ * @param allocator the allocator for the node and its data
+ * @return Node with fields set to NULL
+ */
+LinkedNode* newLinkedNode(const char* data, const Allocator *allocator) {
+	// allocate node
+	LinkedNode* newNode = allocatorMalloc(allocator, sizeof(LinkedNode));
+
+	// initialize fields
+	newNode->data = (data == NULL) ? NULL : allocatorStrdup(allocator, data);
+	newNode->next = NULL;
+
+	return newNode;
+
+}
+
+/**
+ * Freeing node storage. The node must be removed from its chain
+ * by calling deleteNode() first. A NULL node value is ignored.
+ *
+ * @param node the LinkedListNode to delete
+ * @param allocator the allocator for the node and its data
+ */
+void deleteLinkedNode(LinkedNode* node, const Allocator *allocator) {
+	if (node != NULL) {
+		// free pointer to data string
+		allocatorFreeStr(allocator, node->data);  // ok with NULL
+		node->data = NULL;
+
+		// reset the next pointer
+		node->next = NULL;
+
+		// now free the node
+		allocatorFree(allocator, node, sizeof(LinkedNode));
+	}
+}
+
+/**
+ * Return the node at the Kth position in the chain relative to the
+ * input node. If there are fewer than K items in the list, returns NULL.
+ *
+ * @param node the first node in the chain
+ * @param k the index
+ * @return the Kth node from input node or NULL if fewer than K items
+ */
+LinkedNode *getLinkedNodeAt(LinkedNode *node, size_t k) {
+	LinkedNode* n = node;
+	for ( ; n != NULL && k > 0; n = n->next, k--) {}
+	return n;
+}
+
+/**
+ * Return the value of the node at the Kth position in the chain relative to
+ * the input node. If there are fewer than K items in the list, returns false.
+ *
+ * @param node the first node in the chain
+ * @param k the index
+ * @param val the result parameter for  the value of the Kth node from input node
+ * @return true if returned value of kth node as val, or false if index out of bounds
+ */
+bool getLinkedNodeValAt(LinkedNode *node, size_t k, const char **val) {
+	LinkedNode* n = getLinkedNodeAt(node, k);
+	if (n != NULL) {
+		*val = n->data;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Returns last node in the chain, or NULL if node is NULL.
+ *
+ * @param node first node in chain
+ * @return the last node in the chain or NULL
+ */
+LinkedNode* getLastLinkedNode(LinkedNode* node) {
+	// traverse down the list to end node
+	if (node != NULL) {
+		for ( ; node->next != NULL; node = node->next) {}
+	}
+	return node;
+}
+
+/**
+ * Set the value of the node at the Kth position relative to the input
+ * node. If there are fewer than K items in the chain, returns false.
+ *
+ * @param node the first node in the chain
+ * @param k the index
+ * @param val the value to set.
+ * @param allocator the allocator for the node data
+ * @return true if set value of kth node as val, or false if index out of bounds
+ */
+bool setLinkedNodeValAt(LinkedNode *node, size_t k, const char *val, const Allocator *allocator) {
+	LinkedNode* n = getLinkedNodeAt(node, k);
+	if (n != NULL) {
+		allocatorFreeStr(allocator, n->data);
+		n->data = (val == NULL) ? NULL : allocatorStrdup(allocator, val);
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Return the size of the node chain. If the list has a dummy
+ * first node, pass its next pointer to this function.
+ *
+ * @param node first node in chain to be measured
+ * @return the size of the node chain
+ */
+size_t linkedNodeSize(LinkedNode* node) {
+	size_t size = 0;
+	// traverse down the list, counting as it goes
+	for (LinkedNode* n = node; n != NULL; n = n->next, size++) {}
+	return size;
+}
+
+/**
+ * Add new node after the specified node in the chain.
+ *
+ * @param node the node after which new node will be added
+ * @param the new node to insert
+ */
+void addAfterLinkedNode(LinkedNode* node, LinkedNode* newNode) {
+	if (node != NULL) {
+		// make new node point to successor of list node
+		newNode->next = node->next;
+		// make list node point to new node
+		node->next = newNode;
+	} else {
+		// first node in list
+		newNode->next = NULL;
+	}
+}
+
+/**
+ * Delete node after specified chain node. Caller is responsible for
+ * freeing the deleted node by calling deleteLinkedNode().
+ *
+ * @param node the node after which node will be deleted
+ * @return the deleted node that the caller must free, or NULL if
+ *   chain has no next node
+ */
+LinkedNode* deleteAfterLinkedNode(LinkedNode* node) {
+	LinkedNode *deletedNode = NULL;
+
+	if (node != NULL) {
+		// pointer to next node that will to be deleted
+		deletedNode = node->next;
+
+		// only need to do if there is a next node to delete
+		if (deletedNode != NULL) {
+			// make list node point to where next node pointed
+			node->next = deletedNode->next;
+
+			// reset next pointer of deletedNode node
+			deletedNode->next = NULL;
+		}
+	}
+	return deletedNode;
+}
+
+/**
+ * Deletes all nodes in the chain.
+ *
+ * @param node the first node in the chain
+ * @param allocator the allocator for the nodes and their data
+ */
+void deleteAllLinkedNodes(LinkedNode *node, const Allocator *allocator) {
+	// delete all nodes after node
+	LinkedNode *n;
+	while ((n = deleteAfterLinkedNode(node)) != NULL) {
+		deleteLinkedNode(n, allocator);
+	}
+	// delete last node
+	deleteLinkedNode(node, allocator);
+}
+
+/**
+ * Print the linked node chain data.
+ *
+ * @param node the first node in the chain to print
+ */
+void printLinkedNodes(LinkedNode *node) {
+	printf("( ");
+	for (LinkedNode* n = node; n != NULL; n = n->next) {
+		printf("\"%s\" ", n->data);
+	}
+	printf(")\n");
+	fflush(stdout);
+}
+
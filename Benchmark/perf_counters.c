@@ -0,0 +1,255 @@
+/**
+ * @file perf_counters.c
+ *
+ * Implementation for hardware performance counters.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/** Counter names */
+static const char *perfCounterNames[perfNumCounters] = {
+    "cycles", "instructions", "l1d_misses", "llc_misses",
+    "branch_misses", "dtlb_misses"
+};
+
+#ifdef __linux__
+
+/** Value read from a counter with its enabled and running times */
+typedef struct {
+    /** the count */
+    uint64_t value;
+    /** time the counter was enabled */
+    uint64_t timeEnabled;
+    /** time the counter was counting */
+    uint64_t timeRunning;
+} PerfReading;
+
+/**
+ * Returns the perf event config of a hardware cache read miss.
+ *
+ * @param cache the PERF_COUNT_HW_CACHE_* cache id
+ * @return the config
+ */
+static uint64_t cacheMissConfig(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                 | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+/**
+ * Open one counter for the calling thread.
+ *
+ * @param type the PERF_TYPE_* event type
+ * @param config the event config
+ * @return the file descriptor, or -1 if unavailable
+ */
+static int openPerfCounter(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // pid 0 and cpu -1: calling thread on any cpu
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * Open the performance counters for the calling thread. The
+ * counters start disabled and at zero.
+ *
+ * @param counters the counters to open
+ * @return true if at least one counter is available
+ */
+bool openPerfCounters(PerfCounters *counters) {
+    counters->fds[perfCycles] =
+        openPerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    counters->fds[perfInstructions] =
+        openPerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    counters->fds[perfL1dMisses] =
+        openPerfCounter(PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_L1D));
+    counters->fds[perfLlcMisses] =
+        openPerfCounter(PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_LL));
+    counters->fds[perfBranchMisses] =
+        openPerfCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    counters->fds[perfDtlbMisses] =
+        openPerfCounter(PERF_TYPE_HW_CACHE, cacheMissConfig(PERF_COUNT_HW_CACHE_DTLB));
+
+    bool any = false;
+    for (int i = 0; i < perfNumCounters; i++) {
+        any |= (counters->fds[i] >= 0);
+    }
+    return any;
+}
+
+/**
+ * Close the performance counters.
+ *
+ * @param counters the counters
+ */
+void closePerfCounters(PerfCounters *counters) {
+    for (int i = 0; i < perfNumCounters; i++) {
+        if (counters->fds[i] >= 0) {
+            close(counters->fds[i]);
+            counters->fds[i] = -1;
+        }
+    }
+}
+
+/**
+ * Apply an ioctl to every available counter.
+ *
+ * @param counters the counters
+ * @param request the PERF_EVENT_IOC_* request
+ */
+static void ioctlPerfCounters(PerfCounters *counters, unsigned long request) {
+    for (int i = 0; i < perfNumCounters; i++) {
+        if (counters->fds[i] >= 0) {
+            ioctl(counters->fds[i], request, 0);
+        }
+    }
+}
+
+/**
+ * Reset the available counters to zero.
+ *
+ * @param counters the counters
+ */
+void resetPerfCounters(PerfCounters *counters) {
+    ioctlPerfCounters(counters, PERF_EVENT_IOC_RESET);
+}
+
+/**
+ * Start counting events.
+ *
+ * @param counters the counters
+ */
+void startPerfCounters(PerfCounters *counters) {
+    ioctlPerfCounters(counters, PERF_EVENT_IOC_ENABLE);
+}
+
+/**
+ * Stop counting events.
+ *
+ * @param counters the counters
+ */
+void stopPerfCounters(PerfCounters *counters) {
+    ioctlPerfCounters(counters, PERF_EVENT_IOC_DISABLE);
+}
+
+/**
+ * Read the counts since the last reset.
+ *
+ * @param counters the counters
+ * @param counts result parameter for the count of each counter;
+ *   0 for unavailable counters
+ */
+void readPerfCounters(PerfCounters *counters, uint64_t counts[perfNumCounters]) {
+    for (int i = 0; i < perfNumCounters; i++) {
+        counts[i] = 0;
+        PerfReading reading;
+        if (counters->fds[i] >= 0
+            && read(counters->fds[i], &reading, sizeof(reading)) == sizeof(reading)
+            && reading.timeRunning > 0) {
+            // scale up if the kernel multiplexed the counter
+            counts[i] = (uint64_t)((double)reading.value
+                                   * reading.timeEnabled / reading.timeRunning);
+        }
+    }
+}
+
+#else
+
+/**
+ * Open the performance counters; not supported on this system.
+ *
+ * @param counters the counters to open
+ * @return false
+ */
+bool openPerfCounters(PerfCounters *counters) {
+    for (int i = 0; i < perfNumCounters; i++) {
+        counters->fds[i] = -1;
+    }
+    return false;
+}
+
+/**
+ * Close the performance counters.
+ *
+ * @param counters the counters
+ */
+void closePerfCounters(PerfCounters *counters) {
+}
+
+/**
+ * Reset the available counters to zero.
+ *
+ * @param counters the counters
+ */
+void resetPerfCounters(PerfCounters *counters) {
+}
+
+/**
+ * Start counting events.
+ *
+ * @param counters the counters
+ */
+void startPerfCounters(PerfCounters *counters) {
+}
+
+/**
+ * Stop counting events.
+ *
+ * @param counters the counters
+ */
+void stopPerfCounters(PerfCounters *counters) {
+}
+
+/**
+ * Read the counts since the last reset.
+ *
+ * @param counters the counters
+ * @param counts result parameter for the count of each counter; all 0
+ */
+void readPerfCounters(PerfCounters *counters, uint64_t counts[perfNumCounters]) {
+    for (int i = 0; i < perfNumCounters; i++) {
+        counts[i] = 0;
+    }
+}
+
+#endif
+
+/**
+ * Determines whether a counter is available.
+ *
+ * @param counters the counters
+ * @param counter the counter
+ * @return true if the counter is available
+ */
+bool isPerfCounterAvailable(PerfCounters *counters, PerfCounter counter) {
+    return counters->fds[counter] >= 0;
+}
+
+/**
+ * Returns the name of a counter.
+ *
+ * @param counter the counter
+ * @return the name
+ */
+const char *perfCounterName(PerfCounter counter) {
+    return perfCounterNames[counter];
+}
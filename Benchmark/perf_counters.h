@@ -0,0 +1,104 @@
+/**
+ * @file perf_counters.h
+ *
+ * Declarations for hardware performance counters.
+ *
+ * On Linux the counters are opened with perf_event_open for the
+ * calling thread, counting user-mode events only. Each counter is
+ * opened on its own so that a counter the CPU or kernel does not
+ * support is simply marked unavailable; if the kernel multiplexes
+ * counters, counts are scaled by the fraction of time counted.
+ * On other systems, or when perf_event_paranoid forbids access,
+ * openPerfCounters returns false and no counter is available.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef PERF_COUNTERS_H_
+#define PERF_COUNTERS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** The hardware counters */
+typedef enum {
+    perfCycles,
+    perfInstructions,
+    perfL1dMisses,
+    perfLlcMisses,
+    perfBranchMisses,
+    perfDtlbMisses,
+    perfNumCounters
+} PerfCounter;
+
+/** A set of open performance counters */
+typedef struct {
+    /** counter file descriptors; -1 if unavailable */
+    int fds[perfNumCounters];
+} PerfCounters;
+
+/**
+ * Open the performance counters for the calling thread. The
+ * counters start disabled and at zero.
+ *
+ * @param counters the counters to open
+ * @return true if at least one counter is available
+ */
+bool openPerfCounters(PerfCounters *counters);
+
+/**
+ * Close the performance counters.
+ *
+ * @param counters the counters
+ */
+void closePerfCounters(PerfCounters *counters);
+
+/**
+ * Determines whether a counter is available.
+ *
+ * @param counters the counters
+ * @param counter the counter
+ * @return true if the counter is available
+ */
+bool isPerfCounterAvailable(PerfCounters *counters, PerfCounter counter);
+
+/**
+ * Reset the available counters to zero.
+ *
+ * @param counters the counters
+ */
+void resetPerfCounters(PerfCounters *counters);
+
+/**
+ * Start counting events.
+ *
+ * @param counters the counters
+ */
+void startPerfCounters(PerfCounters *counters);
+
+/**
+ * Stop counting events.
+ *
+ * @param counters the counters
+ */
+void stopPerfCounters(PerfCounters *counters);
+
+/**
+ * Read the counts since the last reset.
+ *
+ * @param counters the counters
+ * @param counts result parameter for the count of each counter;
+ *   0 for unavailable counters
+ */
+void readPerfCounters(PerfCounters *counters, uint64_t counts[perfNumCounters]);
+
+/**
+ * Returns the name of a counter.
+ *
+ * @param counter the counter
+ * @return the name
+ */
+const char *perfCounterName(PerfCounter counter);
+
+#endif /* PERF_COUNTERS_H_ */
@@ -0,0 +1,248 @@
+/**
+ * @file trace.c
+ *
+ * Implementation for container operation traces.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace.h"
+
+/** Operation names */
+static const char *traceOpNames[traceNumOps] = {
+    "enqueue", "dequeue", "push", "pop", "peek",
+    "pokehead", "poketop", "drophead", "droptop", "swap", "dup", "clear"
+};
+
+/** The trace recorder hook */
+static TraceRecorder traceRecorder;
+
+/** The context passed to the trace recorder hook */
+static void *traceRecorderCtx;
+
+/** The file written by the trace file recorder */
+static FILE *traceFile;
+
+/** The container recorded by the trace file recorder */
+static const void *traceContainer;
+
+/**
+ * Ensure the trace has room for another operation.
+ *
+ * @param trace the trace
+ * @return false if out of memory
+ */
+static bool ensureTraceCapacity(Trace *trace) {
+    if (trace->size == trace->capacity) {
+        size_t newCapacity = (trace->capacity == 0) ? 1024 : trace->capacity * 2;
+        TraceOp *newOps = realloc(trace->ops, newCapacity * sizeof(TraceOp));
+        if (newOps == NULL) {
+            return false;
+        }
+        trace->ops = newOps;
+        trace->capacity = newCapacity;
+    }
+    return true;
+}
+
+/**
+ * Parse one trace line.
+ *
+ * @param line the line without its newline
+ * @param op result parameter for the operation
+ * @return false if the line is invalid
+ */
+static bool parseTraceOp(char *line, TraceOp *op) {
+    // split off the operation name
+    char *rest = strchr(line, ' ');
+    if (rest != NULL) {
+        *rest++ = '\0';
+    }
+    for (TraceOpCode code = traceEnqueue; code < traceNumOps; code++) {
+        if (strcmp(line, traceOpNames[code]) != 0) {
+            continue;
+        }
+        op->code = code;
+        op->priority = 0;
+        op->val = NULL;
+        if (!traceOpHasVal(code)) {
+            return rest == NULL;
+        }
+
+        // priority followed by value
+        if (rest == NULL) {
+            return false;
+        }
+        char *end;
+        op->priority = (int)strtol(rest, &end, 10);
+        if (end == rest || *end != ' ') {
+            return false;
+        }
+        op->val = strdup(end + 1);  // must copy input string
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Read a trace.
+ *
+ * @param in the file to read
+ * @param trace result parameter for the trace; must be deleted
+ *   with deleteTrace even if reading fails
+ * @param lineNum result parameter for the line number of the
+ *   first invalid line
+ * @return false if a line is invalid
+ */
+bool readTrace(FILE *in, Trace *trace, size_t *lineNum) {
+    *trace = (Trace){NULL, 0, 0};
+    *lineNum = 0;
+
+    char *line = NULL;
+    size_t lineCapacity = 0;
+    ssize_t len;
+    bool ok = true;
+    while (ok && (len = getline(&line, &lineCapacity, in)) >= 0) {
+        ++*lineNum;
+        if (len > 0 && line[len-1] == '\n') {
+            line[--len] = '\0';
+        }
+        if (len == 0 || line[0] == '#') {
+            continue;
+        }
+        ok = ensureTraceCapacity(trace) && parseTraceOp(line, &trace->ops[trace->size]);
+        if (ok) {
+            trace->size++;
+        }
+    }
+    free(line);
+    return ok;
+}
+
+/**
+ * Delete the operations of a trace.
+ *
+ * @param trace the trace
+ */
+void deleteTrace(Trace *trace) {
+    for (size_t i = 0; i < trace->size; i++) {
+        free(trace->ops[i].val);
+    }
+    free(trace->ops);
+
+    // set fields to safe values
+    *trace = (Trace){NULL, 0, 0};
+}
+
+/**
+ * Write one operation to a trace file.
+ *
+ * @param out the file to write
+ * @param code the operation
+ * @param priority the priority for enqueue, push and poke
+ * @param val the value for enqueue, push and poke; newlines are
+ *   written as spaces
+ */
+void writeTraceOp(FILE *out, TraceOpCode code, int priority, const char *val) {
+    fputs(traceOpNames[code], out);
+    if (traceOpHasVal(code)) {
+        fprintf(out, " %d ", priority);
+        for (const char *p = val; *p != '\0'; p++) {
+            fputc((*p == '\n' || *p == '\r') ? ' ' : *p, out);
+        }
+    }
+    fputc('\n', out);
+}
+
+/**
+ * Determines whether an operation has a priority and value.
+ *
+ * @param code the operation
+ * @return true for enqueue, push and poke
+ */
+bool traceOpHasVal(TraceOpCode code) {
+    return code == traceEnqueue || code == tracePush
+        || code == tracePokeHead || code == tracePokeTop;
+}
+
+/**
+ * Returns the name of an operation.
+ *
+ * @param code the operation
+ * @return the name
+ */
+const char *traceOpName(TraceOpCode code) {
+    return traceOpNames[code];
+}
+
+/**
+ * Set the trace recorder hook that containers report operations to.
+ *
+ * @param recorder the hook, or NULL to stop recording
+ * @param ctx the context passed to the hook
+ */
+void setTraceRecorder(TraceRecorder recorder, void *ctx) {
+    traceRecorder = recorder;
+    traceRecorderCtx = ctx;
+}
+
+/**
+ * Report an operation to the trace recorder hook, if any.
+ *
+ * @param container the container
+ * @param code the operation
+ * @param priority the priority for enqueue, push and poke
+ * @param val the value for enqueue, push and poke, otherwise NULL
+ */
+void recordTraceOp(const void *container, TraceOpCode code, int priority, const char *val) {
+    if (traceRecorder != NULL) {
+        traceRecorder(traceRecorderCtx, container, code, priority, val);
+    }
+}
+
+/**
+ * Trace recorder hook that writes operations on the recorded
+ * container to the trace file.
+ *
+ * @param ctx unused
+ * @param container the container
+ * @param code the operation
+ * @param priority the priority for enqueue, push and poke
+ * @param val the value for enqueue, push and poke, otherwise NULL
+ */
+static void fileTraceRecorder(void *ctx, const void *container,
+                              TraceOpCode code, int priority, const char *val) {
+    if (container == traceContainer) {
+        writeTraceOp(traceFile, code, priority, val);
+    }
+}
+
+/**
+ * Start recording the operations on one container to a trace file.
+ * Operations on other containers, including containers used inside
+ * the recorded one, are ignored.
+ *
+ * @param out the file to write
+ * @param container the container to record
+ */
+void startTraceRecording(FILE *out, const void *container) {
+    traceFile = out;
+    traceContainer = container;
+    setTraceRecorder(fileTraceRecorder, NULL);
+}
+
+/**
+ * Stop recording operations.
+ */
+void stopTraceRecording(void) {
+    setTraceRecorder(NULL, NULL);
+    if (traceFile != NULL) {
+        fflush(traceFile);
+    }
+    traceFile = NULL;
+    traceContainer = NULL;
+}
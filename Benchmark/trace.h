@@ -0,0 +1,173 @@
+/**
+ * @file trace.h
+ *
+ * Declarations for container operation traces.
+ *
+ * A trace is a text file with one operation per line:
+ *
+ *     enqueue <priority> <value>
+ *     push <priority> <value>
+ *     pokehead <priority> <value>
+ *     poketop <priority> <value>
+ *     dequeue
+ *     pop
+ *     peek
+ *     drophead
+ *     droptop
+ *     swap
+ *     dup
+ *     clear
+ *
+ * The value is the rest of the line and may contain spaces; the
+ * priority is used only by priority queues. Blank lines and lines
+ * starting with '#' are ignored. The head is the end a queue
+ * dequeues from, and the top is the end a stack pops from; swap
+ * and dup act on the top.
+ *
+ * Containers compiled with -DCONTAINER_TRACE report each operation
+ * to the trace recorder hook once, including operations such as
+ * swap and dup that are built from others; otherwise TRACE_OP
+ * expands to nothing. ArrayDeque reports its first and last
+ * operations as the head and top operations, except addFirst,
+ * which has no stack or queue counterpart and is not reported.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** The traced operations */
+typedef enum {
+    traceEnqueue,
+    traceDequeue,
+    tracePush,
+    tracePop,
+    tracePeek,
+    tracePokeHead,
+    tracePokeTop,
+    traceDropHead,
+    traceDropTop,
+    traceSwap,
+    traceDup,
+    traceClear,
+    traceNumOps
+} TraceOpCode;
+
+/** One traced operation */
+typedef struct {
+    /** the operation */
+    TraceOpCode code;
+    /** the priority for enqueue, push and poke */
+    int priority;
+    /** the value for enqueue, push and poke, otherwise NULL */
+    char *val;
+} TraceOp;
+
+/** A trace of operations */
+typedef struct {
+    /** the operations */
+    TraceOp *ops;
+    /** the number of operations */
+    size_t size;
+    /** capacity of allocated array */
+    size_t capacity;
+} Trace;
+
+/**
+ * Read a trace.
+ *
+ * @param in the file to read
+ * @param trace result parameter for the trace; must be deleted
+ *   with deleteTrace even if reading fails
+ * @param lineNum result parameter for the line number of the
+ *   first invalid line
+ * @return false if a line is invalid
+ */
+bool readTrace(FILE *in, Trace *trace, size_t *lineNum);
+
+/**
+ * Delete the operations of a trace.
+ *
+ * @param trace the trace
+ */
+void deleteTrace(Trace *trace);
+
+/**
+ * Write one operation to a trace file.
+ *
+ * @param out the file to write
+ * @param code the operation
+ * @param priority the priority for enqueue, push and poke
+ * @param val the value for enqueue, push and poke; newlines are
+ *   written as spaces
+ */
+void writeTraceOp(FILE *out, TraceOpCode code, int priority, const char *val);
+
+/**
+ * Determines whether an operation has a priority and value.
+ *
+ * @param code the operation
+ * @return true for enqueue, push and poke
+ */
+bool traceOpHasVal(TraceOpCode code);
+
+/**
+ * Returns the name of an operation.
+ *
+ * @param code the operation
+ * @return the name
+ */
+const char *traceOpName(TraceOpCode code);
+
+/** Trace recorder hook */
+typedef void (*TraceRecorder)(void *ctx, const void *container,
+                              TraceOpCode code, int priority, const char *val);
+
+/**
+ * Set the trace recorder hook that containers report operations to.
+ *
+ * @param recorder the hook, or NULL to stop recording
+ * @param ctx the context passed to the hook
+ */
+void setTraceRecorder(TraceRecorder recorder, void *ctx);
+
+/**
+ * Report an operation to the trace recorder hook, if any.
+ *
+ * @param container the container
+ * @param code the operation
+ * @param priority the priority for enqueue, push and poke
+ * @param val the value for enqueue, push and poke, otherwise NULL
+ */
+void recordTraceOp(const void *container, TraceOpCode code, int priority, const char *val);
+
+/**
+ * Start recording the operations on one container to a trace file.
+ * Operations on other containers, including containers used inside
+ * the recorded one, are ignored.
+ *
+ * @param out the file to write
+ * @param container the container to record
+ */
+void startTraceRecording(FILE *out, const void *container);
+
+/**
+ * Stop recording operations.
+ */
+void stopTraceRecording(void);
+
+#ifdef CONTAINER_TRACE
+/** Report an operation on a container to the trace recorder */
+#define TRACE_OP(container, code, priority, val) \
+    recordTraceOp((container), (code), (priority), (val))
+#else
+#define TRACE_OP(container, code, priority, val) do {} while (0)
+#endif
+
+#endif /* TRACE_H_ */
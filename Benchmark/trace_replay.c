@@ -0,0 +1,491 @@
+/*
+ * @file trace_replay.c
+ *
+ * Replays an operation trace against a container backend, and
+ * reports throughput, per-operation latency percentiles and peak
+ * resident set size as JSON. See trace.h for the trace format.
+ *
+ * The trace is loaded into memory before replaying. It is replayed
+ * twice on fresh containers: once at full speed to measure
+ * throughput, and once reading the clock around each operation to
+ * measure latency. Operations a backend does not support, such as
+ * push on a queue, are skipped and counted.
+ *
+ * With --record, a random workload of n operations is run on the
+ * backend and its trace is written to stdout. This requires the
+ * containers to be compiled with -DCONTAINER_TRACE.
+ *
+ * Usage: trace_replay <backend> [traceFile]
+ *        trace_replay --record <backend> <n>
+ *
+ * Backends: ArrayQueue, ArrayDeque, ArrayStack, LinkedStack, MPQ
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "array_deque.h"
+#include "array_queue.h"
+#include "array_stack.h"
+#include "linked_stack.h"
+#include "messagepriorityqueue.h"
+#include "trace.h"
+
+/** Result of replaying one operation */
+typedef enum {
+    /** the operation was performed */
+    replayDone,
+    /** the operation found the container empty */
+    replayEmpty,
+    /** the backend does not support the operation */
+    replayUnsupported
+} ReplayStatus;
+
+/** A container backend */
+typedef struct {
+    /** the backend name */
+    const char *name;
+    /** creates an empty container */
+    void *(*create)(void);
+    /** replays one operation */
+    ReplayStatus (*replay)(void *container, const TraceOp *op);
+    /** deletes the container */
+    void (*destroy)(void *container);
+} ReplayBackend;
+
+/**
+ * Returns the monotonic clock time in nanoseconds.
+ *
+ * @return the time
+ */
+static uint64_t nowNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/**
+ * Returns the status for an operation that needs a value to act on.
+ *
+ * @param found true if the operation found a value
+ * @return the status
+ */
+static ReplayStatus foundStatus(bool found) {
+    return found ? replayDone : replayEmpty;
+}
+
+/** Create an empty ArrayQueue. */
+static void *createArrayQueue(void) {
+    return newArrayQueue(SIZE_MAX, NULL);
+}
+
+/** Replay one operation on an ArrayQueue. */
+static ReplayStatus replayArrayQueue(void *c, const TraceOp *op) {
+    char *val;
+    const char *peekVal;
+    switch (op->code) {
+    case traceEnqueue:
+        return enqueueArrayQueueVal(c, op->val) ? replayDone : replayUnsupported;
+    case traceDequeue:
+        if (dequeueArrayQueueVal(c, &val)) {
+            free(val);
+            return replayDone;
+        }
+        return replayEmpty;
+    case tracePeek:
+        return foundStatus(peekArrayQueueVal(c, &peekVal));
+    case tracePokeHead:
+        return foundStatus(pokeArrayQueueVal(c, op->val));
+    case traceDropHead:
+        return foundStatus(dropArrayQueueVal(c));
+    case traceClear:
+        dropAllArrayQueueVals(c);
+        return replayDone;
+    default:
+        return replayUnsupported;
+    }
+}
+
+/** Delete an ArrayQueue. */
+static void destroyArrayQueue(void *c) {
+    deleteArrayQueue(c);
+}
+
+/** Create an empty ArrayDeque. */
+static void *createArrayDeque(void) {
+    return newArrayDeque(SIZE_MAX, NULL);
+}
+
+/** Replay one operation on an ArrayDeque. */
+static ReplayStatus replayArrayDeque(void *c, const TraceOp *op) {
+    char *val;
+    const char *peekVal;
+    bool found;
+    switch (op->code) {
+    case traceEnqueue:
+        return enqueueArrayDequeVal(c, op->val) ? replayDone : replayUnsupported;
+    case tracePush:
+        return pushArrayDequeVal(c, op->val) ? replayDone : replayUnsupported;
+    case traceDequeue:
+    case tracePop:
+        found = (op->code == traceDequeue) ? dequeueArrayDequeVal(c, &val)
+                                           : popArrayDequeVal(c, &val);
+        if (found) {
+            free(val);
+        }
+        return foundStatus(found);
+    case tracePeek:
+        return foundStatus(peekHeadArrayDequeVal(c, &peekVal));
+    case tracePokeHead:
+        return foundStatus(pokeHeadArrayDequeVal(c, op->val));
+    case tracePokeTop:
+        return foundStatus(pokeTopArrayDequeVal(c, op->val));
+    case traceDropHead:
+        return foundStatus(dropHeadArrayDequeVal(c));
+    case traceDropTop:
+        return foundStatus(dropTopArrayDequeVal(c));
+    case traceSwap:
+        return foundStatus(swapTopArrayDequeVal(c));
+    case traceDup:
+        return foundStatus(dupTopArrayDequeVal(c));
+    case traceClear:
+        dropAllArrayDequeVals(c);
+        return replayDone;
+    default:
+        return replayUnsupported;
+    }
+}
+
+/** Delete an ArrayDeque. */
+static void destroyArrayDeque(void *c) {
+    deleteArrayDeque(c);
+}
+
+/** Create an empty ArrayStack. */
+static void *createArrayStack(void) {
+    return newArrayStack(SIZE_MAX, NULL);
+}
+
+/** Replay one operation on an ArrayStack. */
+static ReplayStatus replayArrayStack(void *c, const TraceOp *op) {
+    char *val;
+    const char *peekVal;
+    switch (op->code) {
+    case tracePush:
+        return pushArrayStackVal(c, op->val) ? replayDone : replayUnsupported;
+    case tracePop:
+        if (popArrayStackVal(c, &val)) {
+            free(val);
+            return replayDone;
+        }
+        return replayEmpty;
+    case tracePeek:
+        return foundStatus(peekArrayStackVal(c, &peekVal));
+    case tracePokeTop:
+        return foundStatus(pokeArrayStackVal(c, op->val));
+    case traceDropTop:
+        return foundStatus(dropArrayStackVal(c));
+    case traceSwap:
+        return foundStatus(swapArrayStackVal(c));
+    case traceDup:
+        return foundStatus(dupArrayStackVal(c));
+    case traceClear:
+        dropAllArrayStackVals(c);
+        return replayDone;
+    default:
+        return replayUnsupported;
+    }
+}
+
+/** Delete an ArrayStack. */
+static void destroyArrayStack(void *c) {
+    deleteArrayStack(c);
+}
+
+/** Create an empty LinkedStack. */
+static void *createLinkedStack(void) {
+    return newLinkedStack(SIZE_MAX, NULL);
+}
+
+/** Replay one operation on a LinkedStack. */
+static ReplayStatus replayLinkedStack(void *c, const TraceOp *op) {
+    const char *val;
+    switch (op->code) {
+    case tracePush:
+        return pushLinkedStackVal(c, op->val) ? replayDone : replayUnsupported;
+    case tracePop:
+        if (popLinkedStackVal(c, &val)) {
+            free((char*)val);
+            return replayDone;
+        }
+        return replayEmpty;
+    case tracePeek:
+        return foundStatus(peekLinkedStackVal(c, &val));
+    case tracePokeTop:
+        return foundStatus(pokeLinkedStackVal(c, op->val));
+    case traceDropTop:
+        return foundStatus(dropLinkedStackVal(c));
+    case traceSwap:
+        return foundStatus(swapLinkedStackVal(c));
+    case traceDup:
+        return foundStatus(dupLinkedStackVal(c));
+    case traceClear:
+        dropAllLinkedStackVals(c);
+        return replayDone;
+    default:
+        return replayUnsupported;
+    }
+}
+
+/** Delete a LinkedStack. */
+static void destroyLinkedStack(void *c) {
+    deleteLinkedStack(c);
+}
+
+/** Create an empty MessagePriorityQueue. */
+static void *createMPQ(void) {
+    return newMPQ(SIZE_MAX, NULL);
+}
+
+/** Replay one operation on a MessagePriorityQueue. */
+static ReplayStatus replayMPQ(void *c, const TraceOp *op) {
+    char *val;
+    const char *peekVal;
+    switch (op->code) {
+    case traceEnqueue:
+        if (op->priority < highest || op->priority > lowest) {
+            return replayUnsupported;
+        }
+        return enqueueMessageMPQ(c, op->val, op->priority) ? replayDone : replayUnsupported;
+    case traceDequeue:
+        if (dequeueMessageMPQ(c, &val)) {
+            free(val);
+            return replayDone;
+        }
+        return replayEmpty;
+    case tracePeek:
+        return foundStatus(peekMessageMPQ(c, &peekVal));
+    default:
+        return replayUnsupported;
+    }
+}
+
+/** Delete a MessagePriorityQueue. */
+static void destroyMPQ(void *c) {
+    deleteMPQ(c);
+}
+
+/** The replay backends */
+static const ReplayBackend backends[] = {
+    { "ArrayQueue", createArrayQueue, replayArrayQueue, destroyArrayQueue },
+    { "ArrayDeque", createArrayDeque, replayArrayDeque, destroyArrayDeque },
+    { "ArrayStack", createArrayStack, replayArrayStack, destroyArrayStack },
+    { "LinkedStack", createLinkedStack, replayLinkedStack, destroyLinkedStack },
+    { "MPQ", createMPQ, replayMPQ, destroyMPQ },
+};
+
+/**
+ * Find a backend by name.
+ *
+ * @param name the backend name
+ * @return the backend, or NULL if not found
+ */
+static const ReplayBackend *findBackend(const char *name) {
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++) {
+        if (strcmp(name, backends[i].name) == 0) {
+            return &backends[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Returns the peak resident set size of the process.
+ *
+ * @return the peak RSS in kilobytes
+ */
+static long peakRssKb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;  // kilobytes on Linux
+}
+
+/**
+ * Compare latencies for qsort.
+ *
+ * @param a the first latency
+ * @param b the second latency
+ * @return negative, zero or positive as a is less, equal or greater
+ */
+static int compareLatency(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Returns a percentile of sorted latencies.
+ *
+ * @param latencies the sorted latencies
+ * @param n the number of latencies; must be positive
+ * @param percentile the percentile from 0 to 100
+ * @return the latency
+ */
+static uint64_t latencyPercentile(const uint64_t *latencies, size_t n, double percentile) {
+    size_t index = (size_t)(percentile / 100 * (n - 1) + 0.5);
+    return latencies[index];
+}
+
+/**
+ * Replay a trace and print the results as JSON.
+ *
+ * @param backend the backend
+ * @param trace the trace
+ * @return false if out of memory
+ */
+static bool replayTrace(const ReplayBackend *backend, const Trace *trace) {
+    long loadedRssKb = peakRssKb();
+    size_t counts[3] = {0, 0, 0};
+
+    // full-speed replay for throughput
+    void *container = backend->create();
+    uint64_t start = nowNanos();
+    for (size_t i = 0; i < trace->size; i++) {
+        counts[backend->replay(container, &trace->ops[i])]++;
+    }
+    uint64_t elapsed = nowNanos() - start;
+    backend->destroy(container);
+    long replayRssKb = peakRssKb();
+
+    // timed replay for latency
+    uint64_t *latencies = malloc((trace->size + 1) * sizeof(uint64_t));
+    if (latencies == NULL) {
+        return false;
+    }
+    container = backend->create();
+    for (size_t i = 0; i < trace->size; i++) {
+        uint64_t opStart = nowNanos();
+        backend->replay(container, &trace->ops[i]);
+        latencies[i] = nowNanos() - opStart;
+    }
+    backend->destroy(container);
+    qsort(latencies, trace->size, sizeof(uint64_t), compareLatency);
+
+    printf("{\n  \"backend\": \"%s\",\n  \"ops\": %zu,\n", backend->name, trace->size);
+    printf("  \"done\": %zu,\n  \"empty\": %zu,\n  \"unsupported\": %zu,\n",
+           counts[replayDone], counts[replayEmpty], counts[replayUnsupported]);
+    printf("  \"elapsed_ns\": %llu,\n  \"ops_per_sec\": %.1f,\n",
+           (unsigned long long)elapsed,
+           (elapsed == 0) ? 0.0 : trace->size * 1e9 / elapsed);
+    printf("  \"latency_ns\": {");
+    if (trace->size > 0) {
+        printf("\"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"p99.9\": %llu, \"max\": %llu",
+               (unsigned long long)latencyPercentile(latencies, trace->size, 50),
+               (unsigned long long)latencyPercentile(latencies, trace->size, 90),
+               (unsigned long long)latencyPercentile(latencies, trace->size, 99),
+               (unsigned long long)latencyPercentile(latencies, trace->size, 99.9),
+               (unsigned long long)latencies[trace->size - 1]);
+    }
+    printf("},\n");
+    printf("  \"trace_rss_kb\": %ld,\n  \"peak_rss_kb\": %ld\n}\n", loadedRssKb, replayRssKb);
+
+    free(latencies);
+    return true;
+}
+
+/**
+ * Run a random workload on a backend, recording its trace to stdout.
+ *
+ * @param backend the backend
+ * @param n the number of operations
+ * @return false if trace recording is not compiled in
+ */
+static bool recordWorkload(const ReplayBackend *backend, size_t n) {
+#ifdef CONTAINER_TRACE
+    uint64_t rng = 0x9E3779B97F4A7C15u;
+    char buf[32];
+    void *container = backend->create();
+    startTraceRecording(stdout, container);
+    for (size_t i = 0; i < n; i++) {
+        // xorshift64
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+
+        // slightly more adds than removes so the container grows
+        TraceOp op = { traceEnqueue, (int)((rng >> 8) % 4), buf };
+        unsigned choice = rng % 16;
+        if (choice < 7) {
+            op.code = (backend->replay == replayArrayStack
+                       || backend->replay == replayLinkedStack) ? tracePush : traceEnqueue;
+        } else if (choice < 13) {
+            op.code = (backend->replay == replayArrayStack
+                       || backend->replay == replayLinkedStack) ? tracePop : traceDequeue;
+        } else {
+            op.code = tracePeek;
+        }
+        sprintf(buf, "msg%zu", i);
+        backend->replay(container, &op);
+    }
+    stopTraceRecording();
+    backend->destroy(container);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Replay a trace, or record one.
+ */
+int main(int argc, char *argv[]) {
+    if (argc == 4 && strcmp(argv[1], "--record") == 0) {
+        const ReplayBackend *backend = findBackend(argv[2]);
+        if (backend == NULL) {
+            fprintf(stderr, "unknown backend: %s\n", argv[2]);
+            return EXIT_FAILURE;
+        }
+        if (!recordWorkload(backend, strtoull(argv[3], NULL, 10))) {
+            fprintf(stderr, "trace recording requires -DCONTAINER_TRACE\n");
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s <backend> [traceFile]\n"
+                        "       %s --record <backend> <n>\n", argv[0], argv[0]);
+        return EXIT_FAILURE;
+    }
+    const ReplayBackend *backend = findBackend(argv[1]);
+    if (backend == NULL) {
+        fprintf(stderr, "unknown backend: %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    FILE *in = (argc == 3) ? fopen(argv[2], "r") : stdin;
+    if (in == NULL) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+    }
+
+    Trace trace;
+    size_t lineNum;
+    bool ok = readTrace(in, &trace, &lineNum);
+    if (in != stdin) {
+        fclose(in);
+    }
+    if (!ok) {
+        fprintf(stderr, "invalid trace at line %zu\n", lineNum);
+    } else if (!replayTrace(backend, &trace)) {
+        fprintf(stderr, "out of memory\n");
+        ok = false;
+    }
+    deleteTrace(&trace);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,197 @@
+/**
+ * @file blocking_mpq.c
+ *
+ * Implementation for a thread-safe MessagePriorityQueue with
+ * blocking waits.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include "blocking_mpq.h"
+#include "messagepriorityqueue.h"
+#include "wait_event.h"
+
+/**
+ * Create new blocking message priority queue.
+ *
+ * @param maxCapacity the maximum capacity for each priority
+ * @return a new BlockingMPQ
+ */
+BlockingMPQ *newBlockingMPQ(size_t maxCapacity) {
+    BlockingMPQ *queue = malloc(sizeof(BlockingMPQ));
+    queue->queue = newMPQ(maxCapacity);
+    pthread_mutex_init(&queue->lock, NULL);
+    initWaitEvent(&queue->notEmpty);
+    for (Priority p = highest; p <= lowest; p++) {
+        initWaitEvent(&queue->notFull[p]);
+    }
+    return queue;
+}
+
+/**
+ * Deallocate memory for blocking message priority queue. No thread
+ * may be using or waiting on the queue.
+ *
+ * @param queue the BlockingMPQ
+ */
+void deleteBlockingMPQ(BlockingMPQ *queue) {
+    deleteMPQ(queue->queue);
+    for (Priority p = highest; p <= lowest; p++) {
+        destroyWaitEvent(&queue->notFull[p]);
+    }
+    destroyWaitEvent(&queue->notEmpty);
+    pthread_mutex_destroy(&queue->lock);
+    queue->queue = NULL;
+
+    // free the queue itself
+    free(queue);
+}
+
+/**
+ * Enqueue a message with given priority without waiting.
+ *
+ * @param queue the BlockingMPQ
+ * @param message the message to enqueue
+ * @param priority the message priority
+ * @return false if the queue is full for the priority
+ */
+bool enqueueMessageBlockingMPQ(BlockingMPQ *queue, const char *message, Priority priority) {
+    pthread_mutex_lock(&queue->lock);
+    bool enqueued = enqueueMessageMPQ(queue->queue, message, priority);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (enqueued) {
+        notifyWaitEvent(&queue->notEmpty, false);  // no syscall unless waited on
+    }
+    return enqueued;
+}
+
+/**
+ * Enqueue a message with given priority, waiting while the queue
+ * is full for the priority.
+ *
+ * @param queue the BlockingMPQ
+ * @param message the message to enqueue
+ * @param priority the message priority
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still full at the timeout
+ */
+bool enqueueMessageWaitBlockingMPQ(BlockingMPQ *queue, const char *message,
+                                   Priority priority, long timeoutMillis) {
+    // fast path: no waiter bookkeeping if there is room
+    if (enqueueMessageBlockingMPQ(queue, message, priority)) {
+        return true;
+    }
+    if (timeoutMillis == 0) {
+        return false;
+    }
+
+    struct timespec deadline;
+    if (timeoutMillis > 0) {
+        waitEventDeadline(timeoutMillis, &deadline);
+    }
+    WaitEvent *notFull = &queue->notFull[priority];
+    unsigned seq = beginWaitEvent(notFull);
+    bool enqueued;
+    while (!(enqueued = enqueueMessageBlockingMPQ(queue, message, priority))
+           && awaitWaitEvent(notFull, &seq, (timeoutMillis > 0) ? &deadline : NULL)) {
+        // woken or spurious: try again
+    }
+    if (!enqueued) {
+        // timed out, maybe after taking a wake-up meant for another waiter
+        enqueued = enqueueMessageBlockingMPQ(queue, message, priority);
+    }
+    endWaitEvent(notFull);
+    return enqueued;
+}
+
+/**
+ * Dequeue highest priority message without waiting.
+ *
+ * @param queue the BlockingMPQ
+ * @param val the message to return; must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueMessageBlockingMPQ(BlockingMPQ *queue, char **val) {
+    pthread_mutex_lock(&queue->lock);
+    // find the priority the message comes from to wake its producers
+    Priority priority = highest;
+    while (priority < lowest && isEmptyForPriorityMPQ(queue->queue, priority)) {
+        priority++;
+    }
+    bool dequeued = dequeueMessageMPQ(queue->queue, val);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (dequeued) {
+        notifyWaitEvent(&queue->notFull[priority], false);  // no syscall unless waited on
+    }
+    return dequeued;
+}
+
+/**
+ * Dequeue highest priority message, waiting while the queue
+ * is empty.
+ *
+ * @param queue the BlockingMPQ
+ * @param val the message to return; must be freed
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still empty at the timeout
+ */
+bool dequeueMessageWaitBlockingMPQ(BlockingMPQ *queue, char **val, long timeoutMillis) {
+    // fast path: no waiter bookkeeping if there is a message
+    if (dequeueMessageBlockingMPQ(queue, val)) {
+        return true;
+    }
+    if (timeoutMillis == 0) {
+        return false;
+    }
+
+    struct timespec deadline;
+    if (timeoutMillis > 0) {
+        waitEventDeadline(timeoutMillis, &deadline);
+    }
+    unsigned seq = beginWaitEvent(&queue->notEmpty);
+    bool dequeued;
+    while (!(dequeued = dequeueMessageBlockingMPQ(queue, val))
+           && awaitWaitEvent(&queue->notEmpty, &seq, (timeoutMillis > 0) ? &deadline : NULL)) {
+        // woken or spurious: try again
+    }
+    if (!dequeued) {
+        // timed out, maybe after taking a wake-up meant for another waiter
+        dequeued = dequeueMessageBlockingMPQ(queue, val);
+    }
+    endWaitEvent(&queue->notEmpty);
+    return dequeued;
+}
+
+/**
+ * Get total number of messages in the blocking priority queue.
+ *
+ * @param queue the BlockingMPQ
+ * @return total number of messages
+ */
+size_t messageSizeBlockingMPQ(BlockingMPQ *queue) {
+    pthread_mutex_lock(&queue->lock);
+    size_t size = messageSizeMPQ(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+/**
+ * Determines whether blocking priority queue is empty.
+ *
+ * @param queue the BlockingMPQ
+ * @return true if queue is empty, false otherwise
+ */
+bool isEmptyBlockingMPQ(BlockingMPQ *queue) {
+    pthread_mutex_lock(&queue->lock);
+    bool empty = isEmptyMPQ(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return empty;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file blocking_mpq.h
+ *
+ * Declarations for a thread-safe MessagePriorityQueue whose
+ * consumers can sleep until a message arrives and whose producers
+ * can sleep until there is room for their priority, instead of
+ * polling isEmptyMPQ.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef BLOCKING_MPQ_H_
+#define BLOCKING_MPQ_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "blocking_queue.h"
+#include "messagepriorityqueue.h"
+#include "wait_event.h"
+
+/** blocking message priority queue data structure */
+typedef struct {
+    /** Uses MessagePriorityQueue as backing store */
+    MessagePriorityQueue *queue;
+    /** Protects queue */
+    pthread_mutex_t lock;
+    /** Notified when a message is enqueued */
+    WaitEvent notEmpty;
+    /** Notified when a message of each priority is dequeued */
+    WaitEvent notFull[lowest + 1];
+} BlockingMPQ;
+
+/**
+ * Create new blocking message priority queue.
+ *
+ * @param maxCapacity the maximum capacity for each priority
+ * @return a new BlockingMPQ
+ */
+BlockingMPQ *newBlockingMPQ(size_t maxCapacity);
+
+/**
+ * Deallocate memory for blocking message priority queue. No thread
+ * may be using or waiting on the queue.
+ *
+ * @param queue the BlockingMPQ
+ */
+void deleteBlockingMPQ(BlockingMPQ *queue);
+
+/**
+ * Enqueue a message with given priority without waiting.
+ *
+ * @param queue the BlockingMPQ
+ * @param message the message to enqueue
+ * @param priority the message priority
+ * @return false if the queue is full for the priority
+ */
+bool enqueueMessageBlockingMPQ(BlockingMPQ *queue, const char *message, Priority priority);
+
+/**
+ * Enqueue a message with given priority, waiting while the queue
+ * is full for the priority.
+ *
+ * @param queue the BlockingMPQ
+ * @param message the message to enqueue
+ * @param priority the message priority
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still full at the timeout
+ */
+bool enqueueMessageWaitBlockingMPQ(BlockingMPQ *queue, const char *message,
+                                   Priority priority, long timeoutMillis);
+
+/**
+ * Dequeue highest priority message without waiting.
+ *
+ * @param queue the BlockingMPQ
+ * @param val the message to return; must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueMessageBlockingMPQ(BlockingMPQ *queue, char **val);
+
+/**
+ * Dequeue highest priority message, waiting while the queue
+ * is empty.
+ *
+ * @param queue the BlockingMPQ
+ * @param val the message to return; must be freed
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still empty at the timeout
+ */
+bool dequeueMessageWaitBlockingMPQ(BlockingMPQ *queue, char **val, long timeoutMillis);
+
+/**
+ * Get total number of messages in the blocking priority queue.
+ *
+ * @param queue the BlockingMPQ
+ * @return total number of messages
+ */
+size_t messageSizeBlockingMPQ(BlockingMPQ *queue);
+
+/**
+ * Determines whether blocking priority queue is empty.
+ *
+ * @param queue the BlockingMPQ
+ * @return true if queue is empty, false otherwise
+ */
+bool isEmptyBlockingMPQ(BlockingMPQ *queue);
+
+#endif /* BLOCKING_MPQ_H_ */
@@ -0,0 +1,197 @@
+/**
+ * @file blocking_queue.c
+ *
+ * Implementation for a thread-safe ArrayQueue with blocking waits.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include "array_queue.h"
+#include "blocking_queue.h"
+#include "wait_event.h"
+
+/**
+ * Create a blocking queue with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of BlockingQueue.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated blocking queue
+ */
+BlockingQueue *newBlockingQueue(size_t maxCapacity) {
+    BlockingQueue *queue = malloc(sizeof(BlockingQueue));
+    queue->queue = newArrayQueue(maxCapacity);
+    pthread_mutex_init(&queue->lock, NULL);
+    initWaitEvent(&queue->notEmpty);
+    initWaitEvent(&queue->notFull);
+    return queue;
+}
+
+/**
+ * Enqueue value onto the queue without waiting.
+ *
+ * @param queue the BlockingQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full
+ */
+bool enqueueBlockingQueueVal(BlockingQueue *queue, const char *val) {
+    pthread_mutex_lock(&queue->lock);
+    bool enqueued = enqueueArrayQueueVal(queue->queue, val);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (enqueued) {
+        notifyWaitEvent(&queue->notEmpty, false);  // no syscall unless waited on
+    }
+    return enqueued;
+}
+
+/**
+ * Enqueue value onto the queue, waiting while the queue is full.
+ *
+ * @param queue the BlockingQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still full at the timeout
+ */
+bool enqueueWaitBlockingQueueVal(BlockingQueue *queue, const char *val, long timeoutMillis) {
+    // fast path: no waiter bookkeeping if there is room
+    if (enqueueBlockingQueueVal(queue, val)) {
+        return true;
+    }
+    if (timeoutMillis == 0) {
+        return false;
+    }
+
+    struct timespec deadline;
+    if (timeoutMillis > 0) {
+        waitEventDeadline(timeoutMillis, &deadline);
+    }
+    unsigned seq = beginWaitEvent(&queue->notFull);
+    bool enqueued;
+    while (!(enqueued = enqueueBlockingQueueVal(queue, val))
+           && awaitWaitEvent(&queue->notFull, &seq, (timeoutMillis > 0) ? &deadline : NULL)) {
+        // woken or spurious: try again
+    }
+    if (!enqueued) {
+        // timed out, maybe after taking a wake-up meant for another waiter
+        enqueued = enqueueBlockingQueueVal(queue, val);
+    }
+    endWaitEvent(&queue->notFull);
+    return enqueued;
+}
+
+/**
+ * Dequeue the head queue value without waiting.
+ *
+ * @param queue the BlockingQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueBlockingQueueVal(BlockingQueue *queue, char **val) {
+    pthread_mutex_lock(&queue->lock);
+    bool dequeued = dequeueArrayQueueVal(queue->queue, val);
+    pthread_mutex_unlock(&queue->lock);
+
+    if (dequeued) {
+        notifyWaitEvent(&queue->notFull, false);  // no syscall unless waited on
+    }
+    return dequeued;
+}
+
+/**
+ * Dequeue the head queue value, waiting while the queue is empty.
+ *
+ * @param queue the BlockingQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still empty at the timeout
+ */
+bool dequeueWaitBlockingQueueVal(BlockingQueue *queue, char **val, long timeoutMillis) {
+    // fast path: no waiter bookkeeping if there is a value
+    if (dequeueBlockingQueueVal(queue, val)) {
+        return true;
+    }
+    if (timeoutMillis == 0) {
+        return false;
+    }
+
+    struct timespec deadline;
+    if (timeoutMillis > 0) {
+        waitEventDeadline(timeoutMillis, &deadline);
+    }
+    unsigned seq = beginWaitEvent(&queue->notEmpty);
+    bool dequeued;
+    while (!(dequeued = dequeueBlockingQueueVal(queue, val))
+           && awaitWaitEvent(&queue->notEmpty, &seq, (timeoutMillis > 0) ? &deadline : NULL)) {
+        // woken or spurious: try again
+    }
+    if (!dequeued) {
+        // timed out, maybe after taking a wake-up meant for another waiter
+        dequeued = dequeueBlockingQueueVal(queue, val);
+    }
+    endWaitEvent(&queue->notEmpty);
+    return dequeued;
+}
+
+/**
+ * Returns number of items in the blocking queue.
+ *
+ * @param queue the BlockingQueue
+ * @return the number of items in the blocking queue
+ */
+size_t blockingQueueSize(BlockingQueue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    size_t size = arrayQueueSize(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return size;
+}
+
+/**
+ * Determines whether blocking queue is empty.
+ *
+ * @param queue the BlockingQueue
+ * @return true if blocking queue is empty, false otherwise
+ */
+bool isBlockingQueueEmpty(BlockingQueue *queue) {
+    return blockingQueueSize(queue) == 0;
+}
+
+/**
+ * Delete the blocking queue. Frees copies of all strings, then
+ * the array queue, and finally the queue itself. No thread may be
+ * using or waiting on the queue.
+ *
+ * @param queue the BlockingQueue
+ */
+void deleteBlockingQueue(BlockingQueue *queue) {
+    deleteArrayQueue(queue->queue);
+    destroyWaitEvent(&queue->notFull);
+    destroyWaitEvent(&queue->notEmpty);
+    pthread_mutex_destroy(&queue->lock);
+
+    // set fields to safe values
+    queue->queue = NULL;
+
+    // free the queue itself
+    free(queue);
+}
+
+/**
+ * Print blocking queue for diagnostic purposes.
+ *
+ * @param queue the BlockingQueue
+ */
+void printBlockingQueue(BlockingQueue *queue) {
+    pthread_mutex_lock(&queue->lock);
+    printArrayQueue(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+}
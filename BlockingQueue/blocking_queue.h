@@ -0,0 +1,126 @@
+/**
+ * @file blocking_queue.h
+ *
+ * Declarations for a thread-safe ArrayQueue whose consumers can
+ * sleep until a value arrives and whose producers can sleep until
+ * there is room, instead of polling isArrayQueueEmpty.
+ *
+ * Operations take a mutex around the ArrayQueue. A waiting thread
+ * sleeps on a WaitEvent; an operation that makes room or adds a
+ * value notifies the event, which costs no system call unless some
+ * thread is actually waiting.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef BLOCKING_QUEUE_H_
+#define BLOCKING_QUEUE_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "array_queue.h"
+#include "wait_event.h"
+
+/** Timeout that waits forever */
+#define WAIT_FOREVER -1L
+
+/** blocking queue data structure */
+typedef struct {
+    /** Uses ArrayQueue as backing store */
+    ArrayQueue *queue;
+    /** Protects queue */
+    pthread_mutex_t lock;
+    /** Notified when a value is enqueued */
+    WaitEvent notEmpty;
+    /** Notified when a value is dequeued */
+    WaitEvent notFull;
+} BlockingQueue;
+
+/**
+ * Create a blocking queue with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of BlockingQueue.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated blocking queue
+ */
+BlockingQueue *newBlockingQueue(size_t maxCapacity);
+
+/**
+ * Enqueue value onto the queue without waiting.
+ *
+ * @param queue the BlockingQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full
+ */
+bool enqueueBlockingQueueVal(BlockingQueue *queue, const char *val);
+
+/**
+ * Enqueue value onto the queue, waiting while the queue is full.
+ *
+ * @param queue the BlockingQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still full at the timeout
+ */
+bool enqueueWaitBlockingQueueVal(BlockingQueue *queue, const char *val, long timeoutMillis);
+
+/**
+ * Dequeue the head queue value without waiting.
+ *
+ * @param queue the BlockingQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueBlockingQueueVal(BlockingQueue *queue, char **val);
+
+/**
+ * Dequeue the head queue value, waiting while the queue is empty.
+ *
+ * @param queue the BlockingQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @param timeoutMillis the most time to wait in milliseconds;
+ *     0 to not wait, or WAIT_FOREVER
+ * @return false if the queue was still empty at the timeout
+ */
+bool dequeueWaitBlockingQueueVal(BlockingQueue *queue, char **val, long timeoutMillis);
+
+/**
+ * Returns number of items in the blocking queue.
+ *
+ * @param queue the BlockingQueue
+ * @return the number of items in the blocking queue
+ */
+size_t blockingQueueSize(BlockingQueue *queue);
+
+/**
+ * Determines whether blocking queue is empty.
+ *
+ * @param queue the BlockingQueue
+ * @return true if blocking queue is empty, false otherwise
+ */
+bool isBlockingQueueEmpty(BlockingQueue *queue);
+
+/**
+ * Delete the blocking queue. Frees copies of all strings, then
+ * the array queue, and finally the queue itself. No thread may be
+ * using or waiting on the queue.
+ *
+ * @param queue the BlockingQueue
+ */
+void deleteBlockingQueue(BlockingQueue *queue);
+
+/**
+ * Print blocking queue for diagnostic purposes.
+ *
+ * @param queue the BlockingQueue
+ */
+void printBlockingQueue(BlockingQueue *queue);
+
+#endif /* BLOCKING_QUEUE_H_ */
@@ -0,0 +1,187 @@
+/*
+ * @file blocking_queue_main.c
+ *
+ * Test program for BlockingQueue and BlockingMPQ. Shows that waits
+ * time out, that a waiting consumer uses no CPU, and that bounded
+ * producers and consumers hand off every message.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "blocking_mpq.h"
+#include "blocking_queue.h"
+
+/** Number of messages per producer */
+#define MESSAGES 20000
+
+/** Number of producer and of consumer threads */
+#define THREADS 3
+
+/** Total number of messages received by consumers */
+static atomic_size_t receivedCount;
+
+/**
+ * Returns milliseconds elapsed on a clock since a start time.
+ *
+ * @param clock the clock
+ * @param start the start time
+ * @return the milliseconds elapsed
+ */
+static double millisSince(clockid_t clock, const struct timespec *start) {
+    struct timespec now;
+    clock_gettime(clock, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+/**
+ * Consumer that waits for one message and reports the CPU time it
+ * used while waiting.
+ *
+ * @param arg the BlockingQueue
+ * @return NULL
+ */
+static void *idleConsumer(void *arg) {
+    BlockingQueue *queue = arg;
+    struct timespec start, cpuStart;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuStart);
+    char *val;
+    dequeueWaitBlockingQueueVal(queue, &val, WAIT_FOREVER);
+    printf("consumer got \"%s\" after %.0f ms, using %.2f ms of CPU\n", val,
+           millisSince(CLOCK_MONOTONIC, &start), millisSince(CLOCK_THREAD_CPUTIME_ID, &cpuStart));
+    free(val);
+    return NULL;
+}
+
+/**
+ * Producer that enqueues MESSAGES messages, waiting while full.
+ *
+ * @param arg the BlockingQueue
+ * @return NULL
+ */
+static void *producer(void *arg) {
+    BlockingQueue *queue = arg;
+    char buf[24];
+    for (int i = 0; i < MESSAGES; i++) {
+        sprintf(buf, "message %d", i);
+        enqueueWaitBlockingQueueVal(queue, buf, WAIT_FOREVER);
+    }
+    return NULL;
+}
+
+/**
+ * Consumer that dequeues until the "stop" message.
+ *
+ * @param arg the BlockingQueue
+ * @return NULL
+ */
+static void *consumer(void *arg) {
+    BlockingQueue *queue = arg;
+    char *val;
+    for (;;) {
+        dequeueWaitBlockingQueueVal(queue, &val, WAIT_FOREVER);
+        bool stop = strcmp(val, "stop") == 0;
+        free(val);
+        if (stop) {
+            return NULL;
+        }
+        atomic_fetch_add(&receivedCount, 1);
+    }
+}
+
+/**
+ * Consumer that waits for one priority message.
+ *
+ * @param arg the BlockingMPQ
+ * @return NULL
+ */
+static void *mpqConsumer(void *arg) {
+    BlockingMPQ *queue = arg;
+    char *val;
+    if (dequeueMessageWaitBlockingMPQ(queue, &val, 1000)) {
+        printf("MPQ consumer got \"%s\"\n", val);
+        free(val);
+    }
+    return NULL;
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Timeouts\n");
+    BlockingQueue *queue = newBlockingQueue(2);
+    struct timespec start;
+    char *val;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    bool ok = dequeueWaitBlockingQueueVal(queue, &val, 100);
+    printf("dequeue from empty queue: %s after %.0f ms\n",
+           ok ? "true" : "false", millisSince(CLOCK_MONOTONIC, &start));
+    enqueueBlockingQueueVal(queue, "A");
+    enqueueBlockingQueueVal(queue, "B");
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ok = enqueueWaitBlockingQueueVal(queue, "C", 100);
+    printf("enqueue onto full queue: %s after %.0f ms\n",
+           ok ? "true" : "false", millisSince(CLOCK_MONOTONIC, &start));
+    printBlockingQueue(queue);
+    while (dequeueBlockingQueueVal(queue, &val)) {
+        free(val);
+    }
+
+    printf("\nIdle consumer\n");
+    pthread_t threads[2 * THREADS];
+    pthread_create(&threads[0], NULL, idleConsumer, queue);
+    struct timespec delay = { 0, 200000000 };
+    nanosleep(&delay, NULL);
+    enqueueBlockingQueueVal(queue, "wake up");
+    pthread_join(threads[0], NULL);
+
+    printf("\n%d producers and %d consumers, capacity 2\n", THREADS, THREADS);
+    for (int t = 0; t < THREADS; t++) {
+        pthread_create(&threads[t], NULL, producer, queue);
+        pthread_create(&threads[THREADS + t], NULL, consumer, queue);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        enqueueWaitBlockingQueueVal(queue, "stop", WAIT_FOREVER);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(threads[THREADS + t], NULL);
+    }
+    printf("received %zu of %d messages\n", atomic_load(&receivedCount), THREADS * MESSAGES);
+    printf("queue empty? %s\n", isBlockingQueueEmpty(queue) ? "true" : "false");
+    deleteBlockingQueue(queue);
+
+    printf("\nBlocking message priority queue\n");
+    BlockingMPQ *mpq = newBlockingMPQ(1);
+    enqueueMessageBlockingMPQ(mpq, "low message", low);
+    ok = enqueueMessageWaitBlockingMPQ(mpq, "another low message", low, 50);
+    printf("enqueue onto full priority: %s\n", ok ? "true" : "false");
+    ok = enqueueMessageWaitBlockingMPQ(mpq, "high message", high, 50);
+    printf("enqueue onto other priority: %s\n", ok ? "true" : "false");
+    dequeueMessageWaitBlockingMPQ(mpq, &val, WAIT_FOREVER);
+    printf("dequeue: %s\n", val);
+    free(val);
+    dequeueMessageWaitBlockingMPQ(mpq, &val, WAIT_FOREVER);
+    printf("dequeue: %s\n", val);
+    free(val);
+    pthread_create(&threads[0], NULL, mpqConsumer, mpq);
+    nanosleep(&delay, NULL);
+    enqueueMessageBlockingMPQ(mpq, "highest message", highest);
+    pthread_join(threads[0], NULL);
+    printf("MPQ empty? %s\n", isEmptyBlockingMPQ(mpq) ? "true" : "false");
+    deleteBlockingMPQ(mpq);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
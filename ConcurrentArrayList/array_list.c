@@ -0,0 +1,485 @@
+/**
+ * @file array_list.c
+ *
+ * Implementation for variable-size array list with lock-free readers.
+ *
+ * Writers hold the write lock and change the published array only
+ * so that every non-NULL value a reader can load is a live string:
+ * values are shifted one position at a time, and a replaced string
+ * is retired only after the last position holding it is overwritten.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list.h"
+#include "epoch.h"
+
+/**
+ * Allocate an array of values.
+ *
+ * @param capacity the capacity of the array
+ * @return the array with all values NULL
+ */
+static ArrayListVals *newArrayListVals(size_t capacity) {
+    ArrayListVals *vals = malloc(sizeof(ArrayListVals) + capacity * sizeof(char*));
+    if (vals != NULL) {
+        vals->capacity = capacity;
+        for (size_t i = 0; i < capacity; i++) {
+            atomic_init(&vals->vals[i], NULL);
+        }
+    }
+    return vals;
+}
+
+/**
+ * Returns the value at index in the array; used only by writers.
+ *
+ * @param vals the array
+ * @param index the index
+ * @return the value
+ */
+static inline char *loadVal(ArrayListVals *vals, size_t index) {
+    return atomic_load_explicit(&vals->vals[index], memory_order_relaxed);
+}
+
+/**
+ * Publish the value at index in the array to readers.
+ *
+ * @param vals the array
+ * @param index the index
+ * @param val the value
+ */
+static inline void storeVal(ArrayListVals *vals, size_t index, char *val) {
+    atomic_store_explicit(&vals->vals[index], val, memory_order_release);
+}
+
+/**
+ * Ensure array has sufficient capacity to add a new element. If
+ * it currently does not, publish a larger copy of the array and
+ * retire the old array. Called with the write lock held.
+ *
+ * @param list the array list
+ * @return true if list has sufficient size for a new element,
+ *   false if at maximum capacity or there is no room to grow it
+ */
+static bool ensureArrayCapacity(ArrayList *list) {
+    ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_relaxed);
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+
+    // need to grow array if size is at capacity
+    if (size == vals->capacity) {
+        // done if already at maxCapacity
+        if (vals->capacity == list->maxCapacity) {
+            return false;
+        }
+
+        // if over, use maxCapacity
+        size_t newCapacity;
+        if (list->maxCapacity - vals->capacity < vals->capacity) {
+            // no room to double: set to maxCapacity
+            newCapacity = list->maxCapacity;
+        } else {
+            // double current capacity
+            newCapacity = vals->capacity * 2;
+        }
+
+        // cannot realloc: readers may still be using the old array
+        ArrayListVals *newVals = newArrayListVals(newCapacity);
+        if (newVals == NULL) { // not enough memory to allocate
+            return false;
+        }
+        for (size_t i = 0; i < size; i++) {
+            atomic_init(&newVals->vals[i], loadVal(vals, i));
+        }
+
+        // publish new array, then free old array after readers finish
+        atomic_store_explicit(&list->vals, newVals, memory_order_release);
+        retireEpochPtr(vals, free);
+    }
+    return true;
+}
+
+/**
+ * Create an array list with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the ArrayList.
+ * @return the allocated array list
+ */
+ArrayList *newArrayList(size_t maxCapacity) {
+    ArrayList *list = malloc(sizeof(ArrayList));
+    size_t capacity = (maxCapacity < 2) ? maxCapacity : 2;  // small power of 2
+    atomic_init(&list->vals, newArrayListVals(capacity));
+    atomic_init(&list->size, 0);
+    list->maxCapacity = maxCapacity;
+    pthread_mutex_init(&list->writeLock, NULL);
+
+    return list;
+}
+
+/**
+ * Begin reading the list. Values returned by get functions remain
+ * valid until the matching endArrayListRead. Reads may be nested.
+ *
+ * The read section belongs to the calling thread, not to the list:
+ * while it is open, no value of any ArrayList that the thread gets
+ * is freed, and reading several lists needs only one section.
+ *
+ * @param list the ArrayList; unused
+ */
+void beginArrayListRead(ArrayList *list) {
+    (void)list;  // epochs are per thread and shared by all lists
+    enterEpoch();
+}
+
+/**
+ * End reading the list, closing the calling thread's read section.
+ *
+ * @param list the ArrayList; unused
+ */
+void endArrayListRead(ArrayList *list) {
+    (void)list;  // epochs are per thread and shared by all lists
+    exitEpoch();
+}
+
+/**
+ * Add value to list at index. Called with the write lock held.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds max capacity
+ */
+static bool addValAtLocked(ArrayList *list, size_t index, const char *val) {
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+
+    // cannot add NULL or beyond end of list
+    if (val == NULL || index > size) {
+        return false;
+    }
+
+    // ensure that list has sufficient capacity to add an element
+    if (!ensureArrayCapacity(list)) {
+        return false;
+    }
+
+    // move elements down to make room for new element at index position;
+    // readers may briefly see a value twice, but never a freed value
+    ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_relaxed);
+    for (size_t i = size; i > index; i--) {
+        storeVal(vals, i, loadVal(vals, i-1));
+    }
+    storeVal(vals, index, strdup(val));  // must copy input string
+    atomic_store_explicit(&list->size, size+1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * Add value to list at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds max capacity
+ */
+bool addArrayListValAt(ArrayList *list, size_t index, const char *val) {
+    pthread_mutex_lock(&list->writeLock);
+    bool status = addValAtLocked(list, index, val);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Add value to start of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds or exceeds max capacity
+ */
+bool addFirstArrayListVal(ArrayList *list, const char *val) {
+    return addArrayListValAt(list, 0, val);
+}
+
+/**
+ * Add value to end of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds or exceeds max capacity
+ */
+bool addLastArrayListVal(ArrayList *list, const char *val) {
+    pthread_mutex_lock(&list->writeLock);
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+    bool status = addValAtLocked(list, size, val);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Get value at index. Must be called between beginArrayListRead
+ * and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListValAt(ArrayList *list, size_t index, const char **val) {
+    // the array loaded after the size has room for at least size values
+    if (index < atomic_load_explicit(&list->size, memory_order_acquire)) {
+        ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_acquire);
+        char *v = atomic_load_explicit(&vals->vals[index], memory_order_acquire);
+        if (v != NULL) {  // NULL if a delete is in progress
+            *val = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Get value at first index. Must be called between
+ * beginArrayListRead and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getFirstArrayListVal(ArrayList *list, const char **val) {
+    return getArrayListValAt(list, 0, val);
+}
+
+/**
+ * Get value at last index. Must be called between
+ * beginArrayListRead and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getLastArrayListVal(ArrayList *list, const char **val) {
+    size_t size = atomic_load_explicit(&list->size, memory_order_acquire);
+    if (size == 0) { // prevent negative size_t index
+        return false;
+    }
+    return getArrayListValAt(list, size-1, val);
+}
+
+/**
+ * Set value at index. Called with the write lock held.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+static bool setValAtLocked(ArrayList *list, size_t index, const char *val) {
+    if (val != NULL && index < atomic_load_explicit(&list->size, memory_order_relaxed)) {
+        ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_relaxed);
+        char *oldVal = loadVal(vals, index);
+        storeVal(vals, index, strdup(val));  // must copy input string
+        retireEpochPtr(oldVal, free);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Set value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setArrayListValAt(ArrayList *list, size_t index, const char *val) {
+    pthread_mutex_lock(&list->writeLock);
+    bool status = setValAtLocked(list, index, val);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Set value at first index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setFirstArrayListVal(ArrayList *list, const char *val) {
+    return setArrayListValAt(list, 0, val);
+}
+
+/**
+ * Set value at last index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setLastArrayListVal(ArrayList *list, const char *val) {
+    pthread_mutex_lock(&list->writeLock);
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+    // prevent negative size_t index
+    bool status = (size > 0) && setValAtLocked(list, size-1, val);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Returns number of items in the array list.
+ *
+ * @param list the ArrayList
+ * @return the number of items in the array list.
+ */
+size_t arrayListSize(ArrayList *list) {
+    return atomic_load_explicit(&list->size, memory_order_acquire);
+}
+
+/**
+ * Determines whether array list is empty.
+ *
+ * @param list the ArrayList
+ * @return true if array list is empty, false otherwise
+ */
+bool isArrayListEmpty(ArrayList *list) {
+    return arrayListSize(list) == 0;
+}
+
+/**
+ * Delete the array list value at the specified index. Called
+ * with the write lock held.
+ *
+ * @param list the ArrayList
+ * @param index the index
+ * @return false if index out of bounds
+ */
+static bool deleteValAtLocked(ArrayList *list, size_t index) {
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+    if (index >= size) {
+        return false;
+    }
+
+    // move elements down, overwriting the deleted value
+    ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_relaxed);
+    char *oldVal = loadVal(vals, index);
+    for (size_t i = index; i < size-1; i++) {
+        storeVal(vals, i, loadVal(vals, i+1));
+    }
+
+    // shrink size before clearing last pointer so readers see it as NULL
+    atomic_store_explicit(&list->size, size-1, memory_order_release);
+    storeVal(vals, size-1, NULL);
+
+    // free value after readers finish
+    retireEpochPtr(oldVal, free);
+
+    return true;
+}
+
+/**
+ * Delete the array list value at the specified index.
+ *
+ * @param list the ArrayList
+ * @param index the index
+ * @return false if index out of bounds
+ */
+bool deleteArrayListValAt(ArrayList *list, size_t index) {
+    pthread_mutex_lock(&list->writeLock);
+    bool status = deleteValAtLocked(list, index);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Delete the first array list value.
+ *
+ * @param list the ArrayList
+ * @return false if list is empty
+ */
+bool deleteFirstArrayListVal(ArrayList *list) {
+    return deleteArrayListValAt(list, 0);
+}
+
+/**
+ * Delete the last array list value.
+ *
+ * @param list the ArrayList
+ * @return false if list is empty
+ */
+bool deleteLastArrayListVal(ArrayList *list) {
+    pthread_mutex_lock(&list->writeLock);
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+    bool status = (size > 0) && deleteValAtLocked(list, size-1);
+    pthread_mutex_unlock(&list->writeLock);
+    return status;
+}
+
+/**
+ * Deletes all array list values.
+ *
+ * @param list the ArrayList
+ */
+void deleteAllArrayListVals(ArrayList *list) {
+    pthread_mutex_lock(&list->writeLock);
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+    atomic_store_explicit(&list->size, 0, memory_order_release);
+
+    // clear pointers, then free values after readers finish
+    ArrayListVals *vals = atomic_load_explicit(&list->vals, memory_order_relaxed);
+    for (size_t i = 0; i < size; i++) {
+        char *oldVal = loadVal(vals, i);
+        storeVal(vals, i, NULL);
+        retireEpochPtr(oldVal, free);
+    }
+    pthread_mutex_unlock(&list->writeLock);
+}
+
+/**
+ * Delete the array list. No other thread may be using the list.
+ *
+ * @param list the ArrayList
+ */
+void deleteArrayList(ArrayList *list) {
+    // free the list values
+    ArrayListVals *vals = atomic_load(&list->vals);
+    size_t size = atomic_load(&list->size);
+    for (size_t i = 0; i < size; i++) {
+        free(loadVal(vals, i));
+    }
+    free(vals);
+
+    // set fields to safe values
+    atomic_store(&list->vals, NULL);
+    atomic_store(&list->size, 0);
+    list->maxCapacity = 0;
+    pthread_mutex_destroy(&list->writeLock);
+
+    // free the list itself
+    free(list);
+}
+
+/**
+ * Print the array list.
+ *
+ * @param list the ArrayList
+ */
+void printArrayList(ArrayList *list) {
+    beginArrayListRead(list);
+    printf("( ");
+    const char *val;
+    for (size_t i = 0; getArrayListValAt(list, i, &val); i++) {
+        printf("\"%s\" ", val);
+    }
+    printf(")\n");
+    endArrayListRead(list);
+}
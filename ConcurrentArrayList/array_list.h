@@ -0,0 +1,224 @@
+/**
+ * @file array_list.h
+ *
+ * Declarations for variable-size array list with lock-free readers.
+ *
+ * Readers call get functions without taking locks, between calls to
+ * beginArrayListRead and endArrayListRead. Writers are serialized by
+ * a mutex. When the array grows, the writer publishes the new array
+ * atomically; replaced arrays and strings are freed through
+ * epoch-based reclamation once no reader can still be using them.
+ *
+ * Each get returns a value that was in the list at some time during
+ * the call; a sequence of gets is not a consistent view of the list
+ * while a writer is changing it.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ARRAY_LIST_H_
+#define ARRAY_LIST_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Array of values published to readers */
+typedef struct {
+    /** Capacity of the array */
+    size_t capacity;
+    /** Array storage; unused values are NULL */
+    _Atomic(char*) vals[];
+} ArrayListVals;
+
+/** Array List data structure */
+typedef struct {
+    /** Currently published array */
+    _Atomic(ArrayListVals*) vals;
+    /** The current size */
+    atomic_size_t size;
+    /** Maximum capacity of array storage */
+    size_t maxCapacity;
+    /** Serializes writers */
+    pthread_mutex_t writeLock;
+} ArrayList;
+
+/**
+ * Create an array list with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the ArrayList.
+ * @return the allocated array list
+ */
+ArrayList *newArrayList(size_t maxCapacity);
+
+/**
+ * Begin reading the list. Values returned by get functions remain
+ * valid until the matching endArrayListRead. Reads may be nested.
+ *
+ * The read section belongs to the calling thread, not to the list:
+ * while it is open, no value of any ArrayList that the thread gets
+ * is freed, and reading several lists needs only one section.
+ *
+ * @param list the ArrayList; unused
+ */
+void beginArrayListRead(ArrayList *list);
+
+/**
+ * End reading the list, closing the calling thread's read section.
+ *
+ * @param list the ArrayList; unused
+ */
+void endArrayListRead(ArrayList *list);
+
+/**
+ * Add value to list at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds capacity
+ */
+bool addArrayListValAt(ArrayList *list, size_t index, const char *val);
+
+/**
+ * Add value to start of list. Cannot add NULL string to the list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addFirstArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Add value to end of list.
+ *
+ * @param list the ArrayList
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addLastArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Get value at index. Must be called between beginArrayListRead
+ * and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getArrayListValAt(ArrayList *list, size_t index, const char **val);
+
+/**
+ * Get value at first index. Must be called between
+ * beginArrayListRead and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getFirstArrayListVal(ArrayList *list, const char **val);
+
+/**
+ * Get value at last index. Must be called between
+ * beginArrayListRead and endArrayListRead.
+ *
+ * @param list the ArrayList
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if list is empty
+ */
+bool getLastArrayListVal(ArrayList *list, const char **val);
+
+/**
+ * Set value at index.
+ *
+ * @param list the ArrayList
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setArrayListValAt(ArrayList *list, size_t index, const char *val);
+
+/**
+ * Set value at first index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setFirstArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Set value at last index.
+ *
+ * @param list the ArrayList
+ * @param val the value to set
+ * @return false if list is empty
+ */
+bool setLastArrayListVal(ArrayList *list, const char *val);
+
+/**
+ * Returns number of items in the array list.
+ * @param list the ArrayList
+ * @return the number of items in the array list.
+ */
+size_t arrayListSize(ArrayList *list);
+
+/**
+ * Determines whether array list is empty.
+ *
+ * @param list the ArrayList
+ * @return true if array list is empty, false otherwise
+ */
+bool isArrayListEmpty(ArrayList *list);
+
+/**
+ * Delete the array list value at the specified index.
+ *
+ * @param list the ArrayList
+ * @param index the index
+ * @return if index out of bounds
+ */
+bool deleteArrayListValAt(ArrayList *list, size_t index);
+
+/**
+ * Delete the fist array list value.
+ * @param list the ArrayList
+ * @return if list is empty
+ */
+bool deleteFirstArrayListVal(ArrayList *list);
+
+/**
+ * Delete the last array list value.
+ *
+ * @param list the ArrayList
+ * @return if list is empty
+ */
+bool deleteLastArrayListVal(ArrayList *list);
+
+/**
+ * Deletes all array list values.
+ *
+ * @param list the ArrayList
+ */
+void deleteAllArrayListVals(ArrayList *list) ;
+
+/**
+ * Delete the array list. No other thread may be using the list.
+ *
+ * @param list the ArrayList
+ */
+void deleteArrayList(ArrayList *list);
+
+/**
+ * Print the array list.
+ * @param list the ArrayList
+ */
+void printArrayList(ArrayList *list);
+
+#endif /* ARRAY_LIST_H_ */
@@ -0,0 +1,198 @@
+/*
+ * @file array_list_bench.c
+ *
+ * Benchmark of read throughput with many readers and one writer,
+ * comparing lock-free reads with reads under a global mutex. The
+ * writer sets, adds and deletes values at random indexes for the
+ * whole run.
+ *
+ * Usage: array_list_bench [millis [maxReaders [size]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "array_list.h"
+#include "epoch.h"
+
+/** The number of gets per read section */
+#define READS_PER_SECTION 64
+
+/** State shared by the benchmark threads */
+typedef struct {
+    /** the list */
+    ArrayList *list;
+    /** true to use the global mutex instead of lock-free reads */
+    bool useMutex;
+    /** set to stop the threads */
+    atomic_bool stop;
+    /** total gets by all readers */
+    atomic_size_t reads;
+    /** total writes by the writer */
+    atomic_size_t writes;
+} BenchState;
+
+/** The global mutex used by the baseline */
+static pthread_mutex_t globalLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Receives checksums so the compiler keeps the gets */
+static atomic_size_t checksumSink;
+
+/**
+ * Returns the next pseudo-random number (xorshift64).
+ *
+ * @param state the generator state; must not be 0
+ * @return the next number
+ */
+static uint64_t nextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+ * Reader thread that gets values at random indexes until stopped.
+ *
+ * @param arg the benchmark state
+ * @return NULL
+ */
+static void *benchReader(void *arg) {
+    BenchState *bs = arg;
+    uint64_t state = 0x9E3779B97F4A7C15u ^ (uintptr_t)&state;
+    size_t reads = 0;
+    size_t checksum = 0;
+    const char *val;
+    while (!atomic_load_explicit(&bs->stop, memory_order_relaxed)) {
+        if (bs->useMutex) {
+            pthread_mutex_lock(&globalLock);
+        } else {
+            beginArrayListRead(bs->list);
+        }
+        size_t size = arrayListSize(bs->list) + 1;  // never 0
+        for (int i = 0; i < READS_PER_SECTION; i++) {
+            if (getArrayListValAt(bs->list, nextRandom(&state) % size, &val)) {
+                checksum += val[0];
+            }
+        }
+        if (bs->useMutex) {
+            pthread_mutex_unlock(&globalLock);
+        } else {
+            endArrayListRead(bs->list);
+        }
+        reads += READS_PER_SECTION;
+    }
+    atomic_fetch_add(&bs->reads, reads);
+    atomic_fetch_add_explicit(&checksumSink, checksum, memory_order_relaxed);
+    exitEpochThread();
+    return NULL;
+}
+
+/**
+ * Writer thread that sets, adds and deletes values at random
+ * indexes until stopped, keeping the list size about constant.
+ *
+ * @param arg the benchmark state
+ * @return NULL
+ */
+static void *benchWriter(void *arg) {
+    BenchState *bs = arg;
+    uint64_t state = 0x2545F4914F6CDD1Du;
+    size_t writes = 0;
+    while (!atomic_load_explicit(&bs->stop, memory_order_relaxed)) {
+        uint64_t r = nextRandom(&state);
+        if (bs->useMutex) {
+            pthread_mutex_lock(&globalLock);
+        }
+        size_t index = (r >> 8) % (arrayListSize(bs->list) + 1);
+        switch (r % 4) {
+        case 0:
+            addArrayListValAt(bs->list, index, "added");
+            break;
+        case 1:
+            deleteArrayListValAt(bs->list, index);
+            break;
+        default:
+            setArrayListValAt(bs->list, index, "set");
+            break;
+        }
+        if (bs->useMutex) {
+            pthread_mutex_unlock(&globalLock);
+        }
+        writes++;
+    }
+    atomic_fetch_add(&bs->writes, writes);
+    exitEpochThread();
+    return NULL;
+}
+
+/**
+ * Run readers and one writer for a time and report throughput.
+ *
+ * @param useMutex true to use the global mutex
+ * @param numReaders the number of reader threads
+ * @param size the initial list size
+ * @param millis the run time in milliseconds
+ */
+static void runBench(bool useMutex, int numReaders, size_t size, long millis) {
+    BenchState bs;
+    bs.list = newArrayList(SIZE_MAX);
+    bs.useMutex = useMutex;
+    atomic_init(&bs.stop, false);
+    atomic_init(&bs.reads, 0);
+    atomic_init(&bs.writes, 0);
+    char buf[24];
+    for (size_t i = 0; i < size; i++) {
+        sprintf(buf, "%zu", i);
+        addLastArrayListVal(bs.list, buf);
+    }
+
+    pthread_t writer;
+    pthread_t *readers = malloc(numReaders * sizeof(pthread_t));
+    pthread_create(&writer, NULL, benchWriter, &bs);
+    for (int r = 0; r < numReaders; r++) {
+        pthread_create(&readers[r], NULL, benchReader, &bs);
+    }
+
+    struct timespec ts = { millis / 1000, (millis % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+    atomic_store(&bs.stop, true);
+
+    pthread_join(writer, NULL);
+    for (int r = 0; r < numReaders; r++) {
+        pthread_join(readers[r], NULL);
+    }
+    free(readers);
+
+    double seconds = millis / 1000.0;
+    printf("%-10s %8d %16.2f %16.2f\n", useMutex ? "mutex" : "lock-free", numReaders,
+           atomic_load(&bs.reads) / seconds / 1e6, atomic_load(&bs.writes) / seconds / 1e6);
+    deleteArrayList(bs.list);
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    long millis = (argc > 1) ? strtol(argv[1], NULL, 10) : 500;
+    int maxReaders = (argc > 2) ? atoi(argv[2]) : 16;
+    size_t size = (argc > 3) ? strtoul(argv[3], NULL, 10) : 10000;
+
+    printf("%-10s %8s %16s %16s\n", "reads", "readers", "reads (M/s)", "writes (M/s)");
+    for (int readers = 1; readers <= maxReaders; readers *= 2) {
+        runBench(true, readers, size, millis);
+        runBench(false, readers, size, millis);
+        fflush(stdout);
+    }
+    exitEpochThread();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*
+ * @file array_list_main.c
+ *
+ * Test program for concurrent ArrayList functions.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list.h"
+#include "epoch.h"
+
+/** The number of reader threads */
+#define NUM_READERS 4
+
+/** Set when the writer is done */
+static atomic_bool writerDone = false;
+
+/**
+ * Reader thread that checks every value it reads is a
+ * value the writer could have stored.
+ *
+ * @param arg the list
+ * @return the number of bad values read
+ */
+static void *readList(void *arg) {
+    ArrayList *list = arg;
+    size_t bad = 0;
+    while (!atomic_load(&writerDone)) {
+        beginArrayListRead(list);
+        const char *val;
+        for (size_t i = 0; getArrayListValAt(list, i, &val); i++) {
+            if (val[0] != 'v') {
+                bad++;
+            }
+        }
+        endArrayListRead(list);
+    }
+    exitEpochThread();
+    return (void*)bad;
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating array list\n");
+    ArrayList *list = newArrayList(SIZE_MAX);
+    bool empty = isArrayListEmpty(list);
+    printf("list empty? %s\n", empty ? "true" : "false");
+
+    printf("\nadding 5 values\n");
+    addLastArrayListVal(list, "B");
+    addLastArrayListVal(list, "D");
+    addFirstArrayListVal(list, "A");
+    addArrayListValAt(list, 2, "C");
+    addLastArrayListVal(list, "E");
+    printf("list size: %ld\n", arrayListSize(list));
+    printArrayList(list);
+
+    const char *val;
+    beginArrayListRead(list);
+    if (getFirstArrayListVal(list, &val)) {
+        printf("list first: %s\n", val);
+    }
+    if (getLastArrayListVal(list, &val)) {
+        printf("list last: %s\n", val);
+    }
+    endArrayListRead(list);
+
+    printf("\nsetting list[2] to \"Z\", deleting first and last\n");
+    setArrayListValAt(list, 2, "Z");
+    deleteFirstArrayListVal(list);
+    deleteLastArrayListVal(list);
+    printArrayList(list);
+
+    printf("\ndeleting all array list values\n");
+    deleteAllArrayListVals(list);
+    printArrayList(list);
+
+    printf("\nchanging list while %d readers read it\n", NUM_READERS);
+    pthread_t readers[NUM_READERS];
+    for (int r = 0; r < NUM_READERS; r++) {
+        pthread_create(&readers[r], NULL, readList, list);
+    }
+    char buf[16];
+    for (int i = 0; i < 20000; i++) {
+        sprintf(buf, "v%d", i);
+        switch (i % 4) {
+        case 0:
+        case 1:
+            addArrayListValAt(list, arrayListSize(list)/2, buf);
+            break;
+        case 2:
+            setFirstArrayListVal(list, buf);
+            break;
+        case 3:
+            deleteArrayListValAt(list, arrayListSize(list)/3);
+            break;
+        }
+    }
+    atomic_store(&writerDone, true);
+    size_t bad = 0;
+    for (int r = 0; r < NUM_READERS; r++) {
+        void *result;
+        pthread_join(readers[r], &result);
+        bad += (size_t)result;
+    }
+    printf("list size: %ld, bad values read: %ld\n", arrayListSize(list), bad);
+
+    printf("\ndeleting array list\n");
+    deleteArrayList(list);
+    exitEpochThread();
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file epoch.c
+ *
+ * Implementation for epoch-based memory reclamation.
+ *
+ * A thread in a critical section announces the global epoch that
+ * it observed on entry. The global epoch advances only when every
+ * active thread has announced the current epoch, so once it has
+ * advanced twice past the epoch in which memory was retired, no
+ * thread can still hold a reference to that memory.
+ *
+ * Each thread keeps retired memory in three bags, one for each of
+ * the epochs that can still be in use.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "epoch.h"
+
+/** The number of retire bags per thread */
+#define EPOCH_BAGS 3
+
+/** The number of retires between attempts to reclaim memory */
+#define EPOCH_RECLAIM_INTERVAL 64
+
+/** Retired memory and its free function */
+typedef struct {
+    /** the retired memory */
+    void *ptr;
+    /** the function that frees the memory */
+    EpochFreeFn freeFn;
+} RetiredPtr;
+
+/** Memory retired by a thread in one epoch */
+typedef struct {
+    /** the epoch in which the memory was retired */
+    size_t epoch;
+    /** the number of retired pointers */
+    size_t size;
+    /** the capacity of the pointer array */
+    size_t capacity;
+    /** the retired pointers */
+    RetiredPtr *ptrs;
+} RetireBag;
+
+/** Per-thread epoch state */
+typedef struct EpochRecord {
+    /** (epoch << 1) | 1 while in a critical section, 0 otherwise */
+    atomic_size_t state;
+    /** true while the record belongs to a thread */
+    atomic_bool inUse;
+    /** critical section nesting depth */
+    size_t nesting;
+    /** retires since last attempt to reclaim memory */
+    size_t sinceReclaim;
+    /** retired memory by epoch */
+    RetireBag bags[EPOCH_BAGS];
+    /** the next record */
+    struct EpochRecord *next;
+} EpochRecord;
+
+/** The global epoch */
+static atomic_size_t globalEpoch = 0;
+
+/** All records; records are reused but never freed */
+static _Atomic(EpochRecord*) epochRecords = NULL;
+
+/** The record of this thread */
+static _Thread_local EpochRecord *threadRecord = NULL;
+
+/**
+ * Returns the record of this thread, reusing a released record
+ * or adding a new one on first use.
+ *
+ * @return the record
+ */
+static EpochRecord *getEpochRecord(void) {
+    if (threadRecord != NULL) {
+        return threadRecord;
+    }
+
+    // reuse a released record if possible
+    for (EpochRecord *rec = atomic_load(&epochRecords); rec != NULL; rec = rec->next) {
+        bool inUse = false;
+        if (!atomic_load(&rec->inUse)
+            && atomic_compare_exchange_strong(&rec->inUse, &inUse, true)) {
+            threadRecord = rec;
+            return rec;
+        }
+    }
+
+    // otherwise push a new record
+    EpochRecord *rec = calloc(1, sizeof(EpochRecord));
+    atomic_init(&rec->state, 0);
+    atomic_init(&rec->inUse, true);
+    rec->next = atomic_load(&epochRecords);
+    while (!atomic_compare_exchange_weak(&epochRecords, &rec->next, rec)) {
+    }
+    threadRecord = rec;
+    return rec;
+}
+
+/**
+ * Free the memory in a bag.
+ *
+ * @param bag the bag
+ */
+static void freeRetireBag(RetireBag *bag) {
+    for (size_t i = 0; i < bag->size; i++) {
+        bag->ptrs[i].freeFn(bag->ptrs[i].ptr);
+    }
+    bag->size = 0;
+}
+
+/**
+ * Free the memory in bags of a record that were retired at least
+ * two epochs before the global epoch.
+ *
+ * @param rec the record
+ */
+static void reclaimEpochRecord(EpochRecord *rec) {
+    size_t epoch = atomic_load(&globalEpoch);
+    for (size_t b = 0; b < EPOCH_BAGS; b++) {
+        if (rec->bags[b].size > 0 && rec->bags[b].epoch + 2 <= epoch) {
+            freeRetireBag(&rec->bags[b]);
+        }
+    }
+}
+
+/**
+ * Enter a read-side critical section. Memory read from a shared
+ * structure remains valid until the matching exitEpoch. Critical
+ * sections may be nested.
+ */
+void enterEpoch(void) {
+    EpochRecord *rec = getEpochRecord();
+    if (rec->nesting++ == 0) {
+        size_t epoch = atomic_load(&globalEpoch);
+        atomic_store(&rec->state, (epoch << 1) | 1);
+        // announcement must be visible before any shared reads
+        atomic_thread_fence(memory_order_seq_cst);
+    }
+}
+
+/**
+ * Exit a read-side critical section.
+ */
+void exitEpoch(void) {
+    EpochRecord *rec = threadRecord;
+    if (--rec->nesting == 0) {
+        atomic_store_explicit(&rec->state, 0, memory_order_release);
+    }
+}
+
+/**
+ * Retire memory that has been unlinked from a shared structure.
+ * The memory is freed once no thread can still be reading it.
+ *
+ * @param ptr the memory to retire
+ * @param freeFn the function that frees the memory
+ */
+void retireEpochPtr(void *ptr, EpochFreeFn freeFn) {
+    EpochRecord *rec = getEpochRecord();
+    size_t epoch = atomic_load(&globalEpoch);
+    RetireBag *bag = &rec->bags[epoch % EPOCH_BAGS];
+    if (bag->epoch != epoch) {
+        // bag holds memory from at least three epochs ago
+        freeRetireBag(bag);
+        bag->epoch = epoch;
+    }
+
+    // grow bag if full
+    if (bag->size == bag->capacity) {
+        size_t newCapacity = (bag->capacity == 0) ? 16 : bag->capacity * 2;
+        RetiredPtr *newPtrs = realloc(bag->ptrs, newCapacity * sizeof(RetiredPtr));
+        if (newPtrs == NULL) { // not enough memory: wait for readers
+            synchronizeEpoch();
+            freeFn(ptr);
+            return;
+        }
+        bag->ptrs = newPtrs;
+        bag->capacity = newCapacity;
+    }
+    bag->ptrs[bag->size].ptr = ptr;
+    bag->ptrs[bag->size].freeFn = freeFn;
+    bag->size++;
+
+    // periodically try to free older bags
+    if (++rec->sinceReclaim >= EPOCH_RECLAIM_INTERVAL) {
+        rec->sinceReclaim = 0;
+        advanceEpoch();
+        reclaimEpochRecord(rec);
+    }
+}
+
+/**
+ * Try to advance the global epoch. Fails if a thread is still in
+ * a critical section of an earlier epoch.
+ *
+ * @return true if the global epoch advanced
+ */
+bool advanceEpoch(void) {
+    size_t epoch = atomic_load(&globalEpoch);
+    for (EpochRecord *rec = atomic_load(&epochRecords); rec != NULL; rec = rec->next) {
+        size_t state = atomic_load(&rec->state);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    return atomic_compare_exchange_strong(&globalEpoch, &epoch, epoch + 1);
+}
+
+/**
+ * Wait until all memory retired by this thread can be freed, then
+ * free it. Must not be called from within a critical section.
+ */
+void synchronizeEpoch(void) {
+    EpochRecord *rec = getEpochRecord();
+    size_t epoch = atomic_load(&globalEpoch);
+    while (atomic_load(&globalEpoch) < epoch + 2) {
+        if (!advanceEpoch()) {
+            sched_yield();
+        }
+    }
+    for (size_t b = 0; b < EPOCH_BAGS; b++) {
+        freeRetireBag(&rec->bags[b]);
+    }
+    rec->sinceReclaim = 0;
+}
+
+/**
+ * Free the memory retired by this thread and release its epoch
+ * record for use by another thread. Must not be called from within
+ * a critical section.
+ */
+void exitEpochThread(void) {
+    EpochRecord *rec = threadRecord;
+    if (rec == NULL) {
+        return;
+    }
+    synchronizeEpoch();
+
+    // free the bag arrays
+    for (size_t b = 0; b < EPOCH_BAGS; b++) {
+        free(rec->bags[b].ptrs);
+        rec->bags[b].ptrs = NULL;
+        rec->bags[b].capacity = 0;
+    }
+
+    threadRecord = NULL;
+    atomic_store_explicit(&rec->inUse, false, memory_order_release);
+}
@@ -0,0 +1,188 @@
+/**
+ * @file concurrent_stack.c
+ *
+ * Implementation for a lock-free linked stack.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "concurrent_stack.h"
+#include "epoch.h"
+
+/** Largest backoff after a failed CAS, in spins */
+#define STACK_MAX_BACKOFF 1024
+
+/**
+ * Create a concurrent stack with a max capacity.
+ *
+ * @param maxCapacity the maximum capacity of the stack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated concurrent stack
+ */
+ConcurrentStack *newConcurrentStack(size_t maxCapacity) {
+    ConcurrentStack *stack = malloc(sizeof(ConcurrentStack));
+    atomic_init(&stack->head, NULL);
+    atomic_init(&stack->size, 0);
+    stack->maxCapacity = maxCapacity;
+    return stack;
+}
+
+/**
+ * Wait after a failed CAS so contending threads spread out.
+ *
+ * @param spins the current backoff; doubled for next time
+ */
+static void backoff(unsigned *spins) {
+    for (unsigned i = 0; i < *spins; i++) {
+        atomic_signal_fence(memory_order_seq_cst);  // keep the loop
+    }
+    if (*spins < STACK_MAX_BACKOFF) {
+        *spins *= 2;
+    }
+}
+
+/**
+ * Push value onto the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if exceeds max capacity
+ */
+bool pushConcurrentStackVal(ConcurrentStack *stack, const char *val) {
+    // reserve room first so the capacity is never exceeded
+    if (atomic_fetch_add_explicit(&stack->size, 1, memory_order_relaxed) >= stack->maxCapacity) {
+        atomic_fetch_sub_explicit(&stack->size, 1, memory_order_relaxed);
+        return false;
+    }
+
+    size_t len = strlen(val);
+    ConcurrentStackNode *node = malloc(sizeof(ConcurrentStackNode) + len + 1);
+    memcpy(node->val, val, len + 1);  // must copy input string
+
+    // a new node is private until the CAS, so push needs no epoch
+    node->next = atomic_load_explicit(&stack->head, memory_order_relaxed);
+    unsigned spins = 1;
+    // release: publish node and its value with the new head
+    while (!atomic_compare_exchange_weak_explicit(&stack->head, &node->next, node,
+                                                  memory_order_release,
+                                                  memory_order_relaxed)) {
+        backoff(&spins);
+    }
+    return true;
+}
+
+/**
+ * Get a copy of the top stack value without removing it.
+ *
+ * @param stack the ConcurrentStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool peekConcurrentStackVal(ConcurrentStack *stack, char **val) {
+    enterEpoch();
+    ConcurrentStackNode *top = atomic_load_explicit(&stack->head, memory_order_acquire);
+    if (top != NULL) {
+        // copy inside the epoch because a popper may retire top
+        *val = strdup(top->val);
+    }
+    exitEpoch();
+    return top != NULL;
+}
+
+/**
+ * Pop the top stack value.
+ *
+ * @param stack the ConcurrentStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool popConcurrentStackVal(ConcurrentStack *stack, char **val) {
+    // the epoch keeps top from being freed, and so from being
+    // reused at the same address, while we read top->next
+    enterEpoch();
+    ConcurrentStackNode *top = atomic_load_explicit(&stack->head, memory_order_acquire);
+    unsigned spins = 1;
+    while (top != NULL
+           && !atomic_compare_exchange_weak_explicit(&stack->head, &top, top->next,
+                                                     memory_order_acquire,
+                                                     memory_order_acquire)) {
+        backoff(&spins);
+    }
+    exitEpoch();
+    if (top == NULL) {
+        return false;
+    }
+
+    // top is unlinked and ours; copy the value out and retire the
+    // node, which peekers may still be reading
+    *val = strdup(top->val);
+    retireEpochPtr(top, free);
+    atomic_fetch_sub_explicit(&stack->size, 1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Returns number of items in the stack. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @return the number of items in the stack
+ */
+size_t concurrentStackSize(ConcurrentStack *stack) {
+    return atomic_load_explicit(&stack->size, memory_order_relaxed);
+}
+
+/**
+ * Determines whether stack is empty. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @return true if stack is empty, false otherwise
+ */
+bool isConcurrentStackEmpty(ConcurrentStack *stack) {
+    return atomic_load(&stack->head) == NULL;
+}
+
+/**
+ * Delete the stack. Frees copies of all strings, the nodes, and
+ * finally the stack itself. No thread may be using the stack.
+ *
+ * @param stack the ConcurrentStack
+ */
+void deleteConcurrentStack(ConcurrentStack *stack) {
+    ConcurrentStackNode *node = atomic_load(&stack->head);
+    while (node != NULL) {
+        ConcurrentStackNode *next = node->next;
+        free(node);
+        node = next;
+    }
+
+    // set fields to safe values
+    atomic_store(&stack->head, NULL);
+    atomic_store(&stack->size, 0);
+
+    // free the stack itself
+    free(stack);
+}
+
+/**
+ * Print stack for diagnostic purposes. No thread may be
+ * changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ */
+void printConcurrentStack(ConcurrentStack *stack) {
+    printf("( ");
+    for (ConcurrentStackNode *node = atomic_load(&stack->head); node != NULL; node = node->next) {
+        printf("\"%s\" ", node->val);
+    }
+    printf(")\n");
+}
@@ -0,0 +1,131 @@
+/*
+ * @file concurrent_stack_bench.c
+ *
+ * Benchmark of stack throughput with many threads, comparing the
+ * lock-free ConcurrentStack with a LinkedStack behind a global
+ * mutex. Each thread pushes a value and then pops one, over and
+ * over.
+ *
+ * Usage: concurrent_stack_bench [millis [maxThreads]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "concurrent_stack.h"
+#include "epoch.h"
+#include "linked_stack.h"
+
+/** State shared by the benchmark threads */
+typedef struct {
+    /** the lock-free stack, or NULL to use linkedStack */
+    ConcurrentStack *concurrentStack;
+    /** the mutex-guarded stack */
+    LinkedStack *linkedStack;
+    /** set to stop the threads */
+    atomic_bool stop;
+    /** total pushes and pops by all threads */
+    atomic_size_t ops;
+} BenchState;
+
+/** The global mutex used by the baseline */
+static pthread_mutex_t globalLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Benchmark thread that pushes and pops until stopped.
+ *
+ * @param arg the benchmark state
+ * @return NULL
+ */
+static void *benchThread(void *arg) {
+    BenchState *bs = arg;
+    size_t ops = 0;
+    while (!atomic_load_explicit(&bs->stop, memory_order_relaxed)) {
+        if (bs->concurrentStack != NULL) {
+            char *val;
+            pushConcurrentStackVal(bs->concurrentStack, "value");
+            if (popConcurrentStackVal(bs->concurrentStack, &val)) {
+                free(val);
+            }
+        } else {
+            const char *val;
+            pthread_mutex_lock(&globalLock);
+            pushLinkedStackVal(bs->linkedStack, "value");
+            pthread_mutex_unlock(&globalLock);
+            pthread_mutex_lock(&globalLock);
+            bool popped = popLinkedStackVal(bs->linkedStack, &val);
+            pthread_mutex_unlock(&globalLock);
+            if (popped) {
+                free((char*)val);
+            }
+        }
+        ops += 2;
+    }
+    atomic_fetch_add(&bs->ops, ops);
+    exitEpochThread();
+    return NULL;
+}
+
+/**
+ * Run threads for a time and report throughput.
+ *
+ * @param useMutex true to use the mutex-guarded LinkedStack
+ * @param numThreads the number of threads
+ * @param millis the run time in milliseconds
+ * @return the throughput in millions of operations per second
+ */
+static double runBench(bool useMutex, int numThreads, long millis) {
+    BenchState bs;
+    bs.concurrentStack = useMutex ? NULL : newConcurrentStack(SIZE_MAX);
+    bs.linkedStack = useMutex ? newLinkedStack(SIZE_MAX) : NULL;
+    atomic_init(&bs.stop, false);
+    atomic_init(&bs.ops, 0);
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+    for (int t = 0; t < numThreads; t++) {
+        pthread_create(&threads[t], NULL, benchThread, &bs);
+    }
+
+    struct timespec ts = { millis / 1000, (millis % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+    atomic_store(&bs.stop, true);
+
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+
+    if (useMutex) {
+        deleteLinkedStack(bs.linkedStack);
+    } else {
+        deleteConcurrentStack(bs.concurrentStack);
+    }
+    return atomic_load(&bs.ops) / (millis / 1000.0) / 1e6;
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    long millis = (argc > 1) ? strtol(argv[1], NULL, 10) : 500;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : 32;
+
+    printf("%8s %16s %16s %8s\n", "threads", "mutex (M/s)", "lock-free (M/s)", "speedup");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double mutexRate = runBench(true, threads, millis);
+        double lockFreeRate = runBench(false, threads, millis);
+        printf("%8d %16.2f %16.2f %8.2f\n", threads, mutexRate, lockFreeRate,
+               lockFreeRate / mutexRate);
+        fflush(stdout);
+    }
+    exitEpochThread();
+
+    return EXIT_SUCCESS;
+}
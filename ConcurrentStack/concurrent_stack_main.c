@@ -0,0 +1,157 @@
+/*
+ * @file concurrent_stack_main.c
+ *
+ * Test program for ConcurrentStack. Several threads push numbered
+ * values and pop values in random order; the program checks that
+ * every value pushed is popped exactly once.
+ *
+ * Usage: concurrent_stack_main [threads [count]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "concurrent_stack.h"
+#include "epoch.h"
+
+/** State shared by the test threads */
+typedef struct {
+    /** the stack */
+    ConcurrentStack *stack;
+    /** values pushed per thread */
+    size_t count;
+    /** total number of values */
+    size_t total;
+    /** number of times each value was popped */
+    atomic_uchar *popped;
+    /** number of invalid values popped */
+    atomic_size_t errors;
+} StackState;
+
+/** Arguments for one test thread */
+typedef struct {
+    /** the shared state */
+    StackState *ss;
+    /** the thread number */
+    int thread;
+} ThreadArg;
+
+/**
+ * Record a popped value.
+ *
+ * @param ss the shared state
+ * @param val the value; freed
+ */
+static void recordPopped(StackState *ss, char *val) {
+    size_t n;
+    if (sscanf(val, "%zu", &n) != 1 || n >= ss->total) {
+        atomic_fetch_add(&ss->errors, 1);
+    } else {
+        atomic_fetch_add(&ss->popped[n], 1);
+    }
+    free(val);
+}
+
+/**
+ * Test thread that pushes its values and pops about as many,
+ * choosing at random.
+ *
+ * @param arg the thread argument
+ * @return NULL
+ */
+static void *stackThread(void *arg) {
+    ThreadArg *ta = arg;
+    StackState *ss = ta->ss;
+    uint64_t state = 0x9E3779B97F4A7C15u * (ta->thread + 1);
+    char buf[24];
+    char *val;
+    size_t next = ta->thread * ss->count;
+    size_t end = next + ss->count;
+    while (next < end) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        if (state % 3 != 0) {
+            sprintf(buf, "%zu", next++);
+            pushConcurrentStackVal(ss->stack, buf);
+        } else if (popConcurrentStackVal(ss->stack, &val)) {
+            recordPopped(ss, val);
+        }
+    }
+    exitEpochThread();
+    return NULL;
+}
+
+/**
+ * Test functions.
+ */
+int main(int argc, char *argv[]) {
+    int threads = (argc > 1) ? atoi(argv[1]) : 8;
+    size_t count = (argc > 2) ? strtoul(argv[2], NULL, 10) : 100000;
+
+    printf("Single-threaded operations\n");
+    ConcurrentStack *stack = newConcurrentStack(3);
+    const char *vals[] = { "A", "B", "C", "D" };
+    for (int i = 0; i < 4; i++) {
+        printf("push %s: %s\n", vals[i], pushConcurrentStackVal(stack, vals[i]) ? "true" : "false");
+    }
+    printConcurrentStack(stack);
+    char *val;
+    if (peekConcurrentStackVal(stack, &val)) {
+        printf("peek: %s\n", val);
+        free(val);
+    }
+    popConcurrentStackVal(stack, &val);
+    printf("pop: %s\n", val);
+    free(val);
+    printf("size: %zu\n", concurrentStackSize(stack));
+    deleteConcurrentStack(stack);
+
+    printf("\n%d threads, %zu values each\n", threads, count);
+    StackState ss;
+    ss.stack = newConcurrentStack(SIZE_MAX);
+    ss.count = count;
+    ss.total = threads * count;
+    ss.popped = calloc(ss.total, sizeof(atomic_uchar));
+    atomic_init(&ss.errors, 0);
+
+    pthread_t *tids = malloc(threads * sizeof(pthread_t));
+    ThreadArg *args = malloc(threads * sizeof(ThreadArg));
+    for (int t = 0; t < threads; t++) {
+        args[t] = (ThreadArg){ &ss, t };
+        pthread_create(&tids[t], NULL, stackThread, &args[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    size_t left = concurrentStackSize(ss.stack);
+    while (popConcurrentStackVal(ss.stack, &val)) {
+        recordPopped(&ss, val);
+    }
+
+    size_t missing = 0;
+    for (size_t i = 0; i < ss.total; i++) {
+        if (atomic_load(&ss.popped[i]) != 1) {
+            missing++;
+        }
+    }
+    printf("left after threads: %zu\n", left);
+    printf("invalid: %zu, missing or duplicated: %zu\n", atomic_load(&ss.errors), missing);
+    printf("stack empty? %s\n", isConcurrentStackEmpty(ss.stack) ? "true" : "false");
+
+    free(args);
+    free(tids);
+    free(ss.popped);
+    deleteConcurrentStack(ss.stack);
+    exitEpochThread();
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file epoch.h
+ *
+ * Declarations for epoch-based memory reclamation.
+ *
+ * Readers bracket their access to shared memory with enterEpoch
+ * and exitEpoch. A writer that unlinks memory from a shared
+ * structure retires it rather than freeing it; retired memory is
+ * freed once every thread that could still be reading it has
+ * exited its critical section.
+ *
+ * Each thread is registered automatically on first use, and must
+ * call exitEpochThread before it ends.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef EPOCH_H_
+#define EPOCH_H_
+
+#include <stdbool.h>
+
+/** Function that frees retired memory */
+typedef void (*EpochFreeFn)(void *ptr);
+
+/**
+ * Enter a read-side critical section. Memory read from a shared
+ * structure remains valid until the matching exitEpoch. Critical
+ * sections may be nested.
+ */
+void enterEpoch(void);
+
+/**
+ * Exit a read-side critical section.
+ */
+void exitEpoch(void);
+
+/**
+ * Retire memory that has been unlinked from a shared structure.
+ * The memory is freed once no thread can still be reading it.
+ *
+ * @param ptr the memory to retire
+ * @param freeFn the function that frees the memory
+ */
+void retireEpochPtr(void *ptr, EpochFreeFn freeFn);
+
+/**
+ * Try to advance the global epoch. Fails if a thread is still in
+ * a critical section of an earlier epoch.
+ *
+ * @return true if the global epoch advanced
+ */
+bool advanceEpoch(void);
+
+/**
+ * Wait until all memory retired by this thread can be freed, then
+ * free it. Must not be called from within a critical section.
+ */
+void synchronizeEpoch(void);
+
+/**
+ * Free the memory retired by this thread and release its epoch
+ * record for use by another thread. Must not be called from within
+ * a critical section.
+ */
+void exitEpochThread(void);
+
+#endif /* EPOCH_H_ */
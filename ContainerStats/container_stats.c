@@ -0,0 +1,59 @@
+/**
+ * @file container_stats.c
+ *
+ * Implementation for optional container instrumentation counters.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "container_stats.h"
+
+/**
+ * Copy a string, counting the allocation and the bytes copied.
+ *
+ * @param stats the stats block; may be NULL
+ * @param str the string to copy
+ * @return the copy
+ */
+char *statsStrdup(ContainerStats *stats, const char *str) {
+    size_t len = strlen(str) + 1;
+    COUNT_STAT(stats, allocs, 1);
+    COUNT_STAT(stats, bytesCopied, len);
+    char *copy = malloc(len);
+    memcpy(copy, str, len);
+    return copy;
+}
+
+/**
+ * Add the counts of one stats block to another.
+ *
+ * @param sum the stats block to add to
+ * @param stats the stats block to add
+ */
+void addContainerStats(ContainerStats *sum, const ContainerStats *stats) {
+    sum->allocs += stats->allocs;
+    sum->frees += stats->frees;
+    sum->reallocs += stats->reallocs;
+    sum->bytesCopied += stats->bytesCopied;
+    sum->elementsShifted += stats->elementsShifted;
+    sum->nodesTraversed += stats->nodesTraversed;
+}
+
+/**
+ * Print stats block for diagnostic purposes.
+ *
+ * @param name the container name to print
+ * @param stats the stats block
+ */
+void printContainerStats(const char *name, const ContainerStats *stats) {
+    printf("%s stats:\n", name);
+    printf("  allocs:           %zu\n", stats->allocs);
+    printf("  frees:            %zu\n", stats->frees);
+    printf("  reallocs:         %zu\n", stats->reallocs);
+    printf("  bytes copied:     %zu\n", stats->bytesCopied);
+    printf("  elements shifted: %zu\n", stats->elementsShifted);
+    printf("  nodes traversed:  %zu\n", stats->nodesTraversed);
+}
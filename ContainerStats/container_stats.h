@@ -0,0 +1,75 @@
+/**
+ * @file container_stats.h
+ *
+ * Declarations for optional container instrumentation counters.
+ *
+ * Containers carry a ContainerStats block only when compiled with
+ * -DCONTAINER_STATS. Otherwise the block is left out of the
+ * container structs and COUNT_STAT expands to nothing, so the
+ * counters cost nothing. The get*Stats functions are always
+ * available; they return false and zero the counts when stats
+ * are compiled out.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef CONTAINER_STATS_H_
+#define CONTAINER_STATS_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Instrumentation counters for a container */
+typedef struct {
+    /** number of blocks allocated */
+    size_t allocs;
+    /** number of blocks freed */
+    size_t frees;
+    /** number of array reallocs when growing capacity */
+    size_t reallocs;
+    /** bytes copied when duplicating strings */
+    size_t bytesCopied;
+    /** elements moved to open or close a gap on add or delete */
+    size_t elementsShifted;
+    /** nodes visited while locating a node by index */
+    size_t nodesTraversed;
+} ContainerStats;
+
+#ifdef CONTAINER_STATS
+/** Add n to a counter of a stats block; stats may be NULL */
+#define COUNT_STAT(stats, field, n) \
+    do { if ((stats) != NULL) { (stats)->field += (n); } } while (0)
+/** Pointer to the stats block of a container */
+#define CONTAINER_STATS_OF(container) (&(container)->stats)
+#else
+#define COUNT_STAT(stats, field, n) do {} while (0)
+#define CONTAINER_STATS_OF(container) ((ContainerStats*)NULL)
+#endif
+
+/**
+ * Copy a string, counting the allocation and the bytes copied.
+ *
+ * @param stats the stats block; may be NULL
+ * @param str the string to copy
+ * @return the copy
+ */
+char *statsStrdup(ContainerStats *stats, const char *str);
+
+/**
+ * Add the counts of one stats block to another.
+ *
+ * @param sum the stats block to add to
+ * @param stats the stats block to add
+ */
+void addContainerStats(ContainerStats *sum, const ContainerStats *stats);
+
+/**
+ * Print stats block for diagnostic purposes.
+ *
+ * @param name the container name to print
+ * @param stats the stats block
+ */
+void printContainerStats(const char *name, const ContainerStats *stats);
+
+#endif /* CONTAINER_STATS_H_ */
@@ -0,0 +1,73 @@
+/*
+ * @file container_stats_main.c
+ *
+ * Test program for container instrumentation counters.
+ * Build with -DCONTAINER_STATS to compile the counters in.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "array_list.h"
+#include "linked_list.h"
+#include "messagepriorityqueue.h"
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    char buf[16];
+    const char *val;
+
+    printf("Adding 100 values to front of ArrayList\n");
+    ArrayList *list = newArrayList(SIZE_MAX);
+    for (int i = 0; i < 100; i++) {
+        sprintf(buf, "val%d", i);
+        addFirstArrayListVal(list, buf);
+    }
+    deleteFirstArrayListVal(list);
+    printArrayListStats(list);
+
+    printf("\nResetting and adding 100 values to end of ArrayList\n");
+    deleteAllArrayListVals(list);
+    resetArrayListStats(list);
+    for (int i = 0; i < 100; i++) {
+        sprintf(buf, "val%d", i);
+        addLastArrayListVal(list, buf);
+    }
+    printArrayListStats(list);
+    deleteArrayList(list);
+
+    printf("\nAdding 100 values to end of LinkedList and reading each\n");
+    LinkedList *linked = newLinkedList(SIZE_MAX);
+    for (int i = 0; i < 100; i++) {
+        sprintf(buf, "val%d", i);
+        addLastLinkedListVal(linked, buf);
+    }
+    for (int i = 0; i < 100; i++) {
+        getLinkedListValAt(linked, i, &val);
+    }
+    printLinkedListStats(linked);
+    deleteLinkedList(linked);
+
+    printf("\nEnqueuing and dequeuing 100 messages on MessagePriorityQueue\n");
+    MessagePriorityQueue *mpq = newMPQ(SIZE_MAX);
+    for (int i = 0; i < 100; i++) {
+        sprintf(buf, "msg%d", i);
+        enqueueMessageMPQ(mpq, buf, i % 4);
+    }
+    char *msg;
+    while (dequeueMessageMPQ(mpq, &msg)) {
+        free(msg);
+    }
+    printf("mpq empty? %s\n", isEmptyMPQ(mpq) ? "true" : "false");
+    printMPQStats(mpq);
+    deleteMPQ(mpq);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
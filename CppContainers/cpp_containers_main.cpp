@@ -0,0 +1,106 @@
+/*
+ * @file cpp_containers_main.cpp
+ *
+ * Test program for the C++ container templates.
+ *
+ * Build with:
+ *   gcc -c array_list.c
+ *   g++ -std=c++17 cpp_containers_main.cpp array_list.o -ltbb
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#if __has_include(<execution>)
+#include <execution>
+#endif
+#include "ds_array_list.hpp"
+#include "ds_linked_list.hpp"
+#include "ds_string_array_list.hpp"
+
+/**
+ * Test functions.
+ */
+int main() {
+    printf("Creating array list of move-only values\n");
+    ds::ArrayList<std::unique_ptr<int>> ptrs;
+    for (int i : {5, 3, 8, 1, 4}) {
+        ptrs.emplaceLastVal(new int(i));
+    }
+    ptrs.addFirstVal(std::make_unique<int>(9));
+    std::sort(ptrs.begin(), ptrs.end(),
+              [](const auto &a, const auto &b) { return *a < *b; });
+    printf("sorted: ");
+    for (const auto &p : ptrs) {
+        printf("%d ", *p);
+    }
+    printf("\n");
+    ptrs.deleteFirstVal();
+    printf("first after delete: %d, size: %zu\n", **ptrs.getFirstVal(), ptrs.size());
+
+    printf("\nCreating array list of strings\n");
+    ds::ArrayList<std::string> strs;
+    strs.emplaceLastVal("pear");
+    strs.emplaceLastVal(3, 'z');   // constructs "zzz" in place
+    strs.emplaceValAt(1, "apple");
+    strs.addLastVal(std::string("fig"));
+    std::sort(strs.begin(), strs.end());
+    for (const auto &s : strs) {
+        printf("\"%s\" ", s.c_str());
+    }
+    printf("\n");
+    auto it = std::lower_bound(strs.begin(), strs.end(), "fig");
+    printf("lower_bound(\"fig\") at index %td\n", it - strs.begin());
+
+    printf("\nSorting 1000000 values\n");
+    ds::ArrayList<long> nums;
+    for (long i = 0; i < 1000000; i++) {
+        nums.addLastVal((i * 7919) % 1000003);
+    }
+#ifdef __cpp_lib_parallel_algorithm
+    std::sort(std::execution::par, nums.begin(), nums.end());
+    long sum = std::reduce(std::execution::par, nums.begin(), nums.end(), 0L);
+    printf("parallel sort: sorted? %s, sum: %ld\n",
+           std::is_sorted(nums.begin(), nums.end()) ? "true" : "false", sum);
+#else
+    std::sort(nums.begin(), nums.end());
+    printf("sort: sorted? %s\n", std::is_sorted(nums.begin(), nums.end()) ? "true" : "false");
+#endif
+
+    printf("\nCreating linked list of move-only values\n");
+    ds::LinkedList<std::unique_ptr<std::string>> linked;
+    linked.emplaceLastVal(new std::string("B"));
+    linked.addFirstVal(std::make_unique<std::string>("A"));
+    linked.emplaceLastVal(new std::string("C"));
+    linked.setValAt(1, std::make_unique<std::string>("Z"));
+    auto found = std::find_if(linked.begin(), linked.end(),
+                              [](const auto &p) { return *p == "Z"; });
+    printf("found \"Z\"? %s\n", (found != linked.end()) ? "true" : "false");
+    for (const auto &p : linked) {
+        printf("\"%s\" ", p->c_str());
+    }
+    printf("\n");
+    linked.deleteLastVal();
+    printf("linked size: %zu\n", linked.size());
+
+    printf("\nCreating C array list wrapper\n");
+    ds::StringArrayList clist;
+    for (const char *s : {"delta", "alpha", "charlie", "bravo"}) {
+        clist.addLastVal(s);
+    }
+    std::sort(clist.begin(), clist.end(),
+              [](const char *a, const char *b) { return strcmp(a, b) < 0; });
+    clist.print();
+    auto cit = std::lower_bound(clist.begin(), clist.end(), "charlie",
+              [](const char *a, const char *b) { return strcmp(a, b) < 0; });
+    printf("lower_bound(\"charlie\") at index %td\n", cit - clist.begin());
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,405 @@
+/**
+ * @file ds_array_list.hpp
+ *
+ * Header-only C++ array list of values of type T.
+ *
+ * ds::ArrayList follows the C ArrayList: values are stored in one
+ * allocated array that doubles up to a maximum capacity, and the
+ * functions mirror the C functions. Values are stored inline and
+ * moved rather than copied, so T may be move-only, and the emplace
+ * functions construct a value in place without a temporary.
+ *
+ * The iterators are pointers into the array storage, so the list
+ * works directly with std::sort, std::lower_bound and the parallel
+ * std::execution algorithms.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef DS_ARRAY_LIST_HPP_
+#define DS_ARRAY_LIST_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace ds {
+
+/** Array List data structure */
+template <typename T, typename Alloc = std::allocator<T>>
+class ArrayList {
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /**
+     * Create an array list with a maximum capacity.
+     *
+     * @param maxCapacity maximum capacity of the ArrayList
+     * @param alloc the allocator for the array storage
+     */
+    explicit ArrayList(size_t maxCapacity = SIZE_MAX, const Alloc &alloc = Alloc())
+        : alloc(alloc), maxCapacity(maxCapacity) {
+        capacity = (maxCapacity < 2) ? maxCapacity : 2;  // small power of 2
+        vals = (capacity > 0) ? Traits::allocate(this->alloc, capacity) : nullptr;
+    }
+
+    /** Copying is disabled; move the list instead */
+    ArrayList(const ArrayList&) = delete;
+    ArrayList &operator=(const ArrayList&) = delete;
+
+    /**
+     * Move a list, leaving the source empty with no storage.
+     *
+     * @param other the list to move
+     */
+    ArrayList(ArrayList &&other) noexcept
+        : alloc(std::move(other.alloc)), vals(other.vals), size_(other.size_),
+          capacity(other.capacity), maxCapacity(other.maxCapacity) {
+        other.vals = nullptr;
+        other.size_ = 0;
+        other.capacity = 0;
+    }
+
+    /**
+     * Move-assign a list, leaving the source empty with no storage.
+     *
+     * @param other the list to move
+     * @return this list
+     */
+    ArrayList &operator=(ArrayList &&other) noexcept {
+        if (this != &other) {
+            deleteStorage();
+            alloc = std::move(other.alloc);
+            vals = other.vals;
+            size_ = other.size_;
+            capacity = other.capacity;
+            maxCapacity = other.maxCapacity;
+            other.vals = nullptr;
+            other.size_ = 0;
+            other.capacity = 0;
+        }
+        return *this;
+    }
+
+    /** Delete the array list and its values */
+    ~ArrayList() {
+        deleteStorage();
+    }
+
+    /**
+     * Construct value in place at index.
+     *
+     * @param index the index for the new value
+     * @param args the constructor arguments for the new value
+     * @return false if index out of bounds, exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceValAt(size_t index, Args&&... args) {
+        if (index > size_ || size_ == maxCapacity) {
+            return false;
+        }
+        if (index == size_ && size_ < capacity) {
+            // nothing moves, so args may refer to a list element
+            Traits::construct(alloc, vals + size_, std::forward<Args>(args)...);
+            size_++;
+            return true;
+        }
+
+        // args may refer to a list element that growing the array or
+        // moving elements down would invalidate: construct value first
+        T val(std::forward<Args>(args)...);
+        if (!ensureArrayCapacity()) {
+            return false;
+        }
+        if (index == size_) {
+            Traits::construct(alloc, vals + size_, std::move(val));
+            size_++;
+            return true;
+        }
+
+        // move elements down to make room for new element at index position
+        Traits::construct(alloc, vals + size_, std::move(vals[size_-1]));
+        size_++;
+        for (size_t i = size_-2; i > index; i--) {
+            vals[i] = std::move(vals[i-1]);
+        }
+
+        // move new element into the moved-from slot
+        Traits::destroy(alloc, vals + index);
+        try {
+            Traits::construct(alloc, vals + index, std::move(val));
+        } catch (...) {
+            // close the gap before passing on the exception
+            Traits::construct(alloc, vals + index, std::move(vals[index+1]));
+            for (size_t i = index+1; i < size_-1; i++) {
+                vals[i] = std::move(vals[i+1]);
+            }
+            Traits::destroy(alloc, vals + --size_);
+            throw;
+        }
+        return true;
+    }
+
+    /**
+     * Construct value in place at start of list.
+     *
+     * @param args the constructor arguments for the new value
+     * @return false if exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceFirstVal(Args&&... args) {
+        return emplaceValAt(0, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Construct value in place at end of list.
+     *
+     * @param args the constructor arguments for the new value
+     * @return false if exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceLastVal(Args&&... args) {
+        return emplaceValAt(size_, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Add value to list at index.
+     *
+     * @param index the index for the new value
+     * @param val the value to insert; value will be moved to store
+     * @return false if index out of bounds, exceeds max capacity
+     */
+    bool addValAt(size_t index, T val) {
+        return emplaceValAt(index, std::move(val));
+    }
+
+    /**
+     * Add value to start of list.
+     *
+     * @param val the value to insert; value will be moved to store
+     * @return false if exceeds max capacity
+     */
+    bool addFirstVal(T val) {
+        return emplaceValAt(0, std::move(val));
+    }
+
+    /**
+     * Add value to end of list.
+     *
+     * @param val the value to insert; value will be moved to store
+     * @return false if exceeds max capacity
+     */
+    bool addLastVal(T val) {
+        return emplaceValAt(size_, std::move(val));
+    }
+
+    /**
+     * Get value at index.
+     *
+     * @param index the index of the value
+     * @return pointer to the value, or nullptr if index out of bounds
+     */
+    T *getValAt(size_t index) {
+        return (index < size_) ? vals + index : nullptr;
+    }
+
+    /**
+     * Get value at first index.
+     *
+     * @return pointer to the value, or nullptr if list is empty
+     */
+    T *getFirstVal() {
+        return getValAt(0);
+    }
+
+    /**
+     * Get value at last index.
+     *
+     * @return pointer to the value, or nullptr if list is empty
+     */
+    T *getLastVal() {
+        return (size_ > 0) ? getValAt(size_-1) : nullptr;
+    }
+
+    /**
+     * Set value at index.
+     *
+     * @param index the index for the value
+     * @param val the value to set; value will be moved to store
+     * @return false if index out of bounds
+     */
+    bool setValAt(size_t index, T val) {
+        if (index < size_) {
+            vals[index] = std::move(val);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Delete the array list value at the specified index.
+     *
+     * @param index the index
+     * @return false if index out of bounds
+     */
+    bool deleteValAt(size_t index) {
+        if (index >= size_) {
+            return false;
+        }
+        // move elements up over the deleted element
+        for (size_t i = index; i < size_-1; i++) {
+            vals[i] = std::move(vals[i+1]);
+        }
+        Traits::destroy(alloc, vals + --size_);
+        return true;
+    }
+
+    /**
+     * Delete the first array list value.
+     *
+     * @return false if list is empty
+     */
+    bool deleteFirstVal() {
+        return deleteValAt(0);
+    }
+
+    /**
+     * Delete the last array list value.
+     *
+     * @return false if list is empty
+     */
+    bool deleteLastVal() {
+        return (size_ > 0) && deleteValAt(size_-1);
+    }
+
+    /**
+     * Deletes all array list values.
+     */
+    void deleteAllVals() {
+        for (size_t i = 0; i < size_; i++) {
+            Traits::destroy(alloc, vals + i);
+        }
+        size_ = 0;
+    }
+
+    /** Returns number of items in the array list. */
+    size_t size() const noexcept { return size_; }
+
+    /** Determines whether array list is empty. */
+    bool empty() const noexcept { return size_ == 0; }
+
+    /** Returns the maximum capacity of the array list. */
+    size_t max_size() const noexcept { return maxCapacity; }
+
+    /** Returns the array storage. */
+    T *data() noexcept { return vals; }
+    const T *data() const noexcept { return vals; }
+
+    /** Returns the value at index without bounds checking. */
+    T &operator[](size_t index) noexcept { return vals[index]; }
+    const T &operator[](size_t index) const noexcept { return vals[index]; }
+
+    /** Returns iterators over the array storage. */
+    iterator begin() noexcept { return vals; }
+    iterator end() noexcept { return vals + size_; }
+    const_iterator begin() const noexcept { return vals; }
+    const_iterator end() const noexcept { return vals + size_; }
+    const_iterator cbegin() const noexcept { return vals; }
+    const_iterator cend() const noexcept { return vals + size_; }
+
+    /** Returns the allocator. */
+    allocator_type get_allocator() const { return alloc; }
+
+private:
+    using Traits = std::allocator_traits<Alloc>;
+
+    /**
+     * Ensure array has sufficient capacity to add a new element. If
+     * it currently does not, grow the array so that it does, up to
+     * the maximum capacity.
+     *
+     * @return true if list has sufficient size for a new element,
+     *   false if at maximum capacity
+     */
+    bool ensureArrayCapacity() {
+        // need to grow array if size is at capacity
+        if (size_ == capacity) {
+            // done if already at maxCapacity
+            if (capacity == maxCapacity) {
+                return false;
+            }
+
+            size_t newCapacity;
+            if (maxCapacity - capacity < capacity) {
+                // no room to double: set to maxCapacity
+                newCapacity = maxCapacity;
+            } else {
+                // double current capacity
+                newCapacity = capacity * 2;
+            }
+
+            // move elements to new storage; copy if move may throw
+            T *newVals = Traits::allocate(alloc, newCapacity);
+            size_t i = 0;
+            try {
+                for (; i < size_; i++) {
+                    Traits::construct(alloc, newVals + i, std::move_if_noexcept(vals[i]));
+                }
+            } catch (...) {
+                // leave list unchanged
+                while (i > 0) {
+                    Traits::destroy(alloc, newVals + --i);
+                }
+                Traits::deallocate(alloc, newVals, newCapacity);
+                throw;
+            }
+            for (i = 0; i < size_; i++) {
+                Traits::destroy(alloc, vals + i);
+            }
+            if (vals != nullptr) {
+                Traits::deallocate(alloc, vals, capacity);
+            }
+            vals = newVals;
+            capacity = newCapacity;
+        }
+        return true;
+    }
+
+    /** Delete the values and free the array storage. */
+    void deleteStorage() {
+        deleteAllVals();
+        if (vals != nullptr) {
+            Traits::deallocate(alloc, vals, capacity);
+        }
+        // set fields to safe values
+        vals = nullptr;
+        capacity = 0;
+    }
+
+    /** Allocator for array storage */
+    Alloc alloc;
+    /** Allocated array storage */
+    T *vals = nullptr;
+    /** The current size */
+    size_t size_ = 0;
+    /** Capacity of allocated array */
+    size_t capacity = 0;
+    /** Maximum capacity of allocated array */
+    size_t maxCapacity;
+};
+
+} // namespace ds
+
+#endif /* DS_ARRAY_LIST_HPP_ */
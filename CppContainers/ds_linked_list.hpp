@@ -0,0 +1,351 @@
+/**
+ * @file ds_linked_list.hpp
+ *
+ * Header-only C++ linked list of values of type T.
+ *
+ * ds::LinkedList follows the C LinkedList: a singly-linked chain of
+ * nodes after a dummy head node, with functions that mirror the C
+ * functions. Each node stores its value inline and values are moved
+ * rather than copied, so T may be move-only, and the emplace
+ * functions construct a value in its node without a temporary.
+ *
+ * The iterators are forward iterators, so the list works with
+ * algorithms such as std::find_if and std::accumulate.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef DS_LINKED_LIST_HPP_
+#define DS_LINKED_LIST_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ds {
+
+/** Linked List data structure */
+template <typename T>
+class LinkedList {
+    /** Node link; the dummy head node has no value */
+    struct NodeBase {
+        /** The next node */
+        NodeBase *next = nullptr;
+    };
+
+    /** Node with a value */
+    struct Node : NodeBase {
+        /** The node value */
+        T val;
+
+        template <typename... Args>
+        explicit Node(Args&&... args) : val(std::forward<Args>(args)...) {}
+    };
+
+    /** Forward iterator over the list values */
+    template <typename V>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        Iterator() = default;
+        explicit Iterator(NodeBase *node) : node(node) {}
+
+        /** Allow conversion from iterator to const_iterator */
+        template <typename U, typename = std::enable_if_t<std::is_same_v<const U, V>>>
+        Iterator(const Iterator<U> &other) : node(other.getNode()) {}
+
+        /** Returns the current node */
+        NodeBase *getNode() const { return node; }
+
+        reference operator*() const { return static_cast<Node*>(node)->val; }
+        pointer operator->() const { return &static_cast<Node*>(node)->val; }
+        Iterator &operator++() { node = node->next; return *this; }
+        Iterator operator++(int) { Iterator it = *this; node = node->next; return it; }
+        bool operator==(const Iterator &other) const { return node == other.node; }
+        bool operator!=(const Iterator &other) const { return node != other.node; }
+
+    private:
+        /** The current node */
+        NodeBase *node = nullptr;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    /**
+     * Create and initialize a new linked list.
+     *
+     * @param maxCapacity the maximum capacity of the list
+     */
+    explicit LinkedList(size_t maxCapacity = SIZE_MAX) : maxCapacity(maxCapacity) {}
+
+    /** Copying is disabled; move the list instead */
+    LinkedList(const LinkedList&) = delete;
+    LinkedList &operator=(const LinkedList&) = delete;
+
+    /**
+     * Move a list, leaving the source empty.
+     *
+     * @param other the list to move
+     */
+    LinkedList(LinkedList &&other) noexcept
+        : size_(other.size_), maxCapacity(other.maxCapacity) {
+        head.next = other.head.next;
+        other.head.next = nullptr;
+        other.size_ = 0;
+    }
+
+    /**
+     * Move-assign a list, leaving the source empty.
+     *
+     * @param other the list to move
+     * @return this list
+     */
+    LinkedList &operator=(LinkedList &&other) noexcept {
+        if (this != &other) {
+            deleteAllVals();
+            head.next = other.head.next;
+            size_ = other.size_;
+            maxCapacity = other.maxCapacity;
+            other.head.next = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /** Delete the linked list and its values */
+    ~LinkedList() {
+        deleteAllVals();
+    }
+
+    /**
+     * Construct value in place at index.
+     *
+     * @param index the index for the new value
+     * @param args the constructor arguments for the new value
+     * @return false if index out of bounds or exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceValAt(size_t index, Args&&... args) {
+        if (size_ == maxCapacity || index > size_) {
+            return false;
+        }
+        // find node to insert after
+        NodeBase *node = getLinkedNodeAt(&head, index);
+
+        // create and add new node
+        Node *newNode = new Node(std::forward<Args>(args)...);
+        newNode->next = node->next;
+        node->next = newNode;
+        size_++;
+        return true;
+    }
+
+    /**
+     * Construct value in place at start of list.
+     *
+     * @param args the constructor arguments for the new value
+     * @return false if exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceFirstVal(Args&&... args) {
+        return emplaceValAt(0, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Construct value in place at end of list.
+     *
+     * @param args the constructor arguments for the new value
+     * @return false if exceeds max capacity
+     */
+    template <typename... Args>
+    bool emplaceLastVal(Args&&... args) {
+        return emplaceValAt(size_, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Add value to list at index.
+     *
+     * @param index the index for the new value
+     * @param val the value to insert; value will be moved to store
+     * @return false if index out of bounds or exceeds max capacity
+     */
+    bool addValAt(size_t index, T val) {
+        return emplaceValAt(index, std::move(val));
+    }
+
+    /**
+     * Add value to start of list.
+     *
+     * @param val the value to insert; value will be moved to store
+     * @return false if exceeds max capacity
+     */
+    bool addFirstVal(T val) {
+        return emplaceValAt(0, std::move(val));
+    }
+
+    /**
+     * Add value to end of list.
+     *
+     * @param val the value to insert; value will be moved to store
+     * @return false if exceeds max capacity
+     */
+    bool addLastVal(T val) {
+        return emplaceValAt(size_, std::move(val));
+    }
+
+    /**
+     * Get value at index.
+     *
+     * @param index the index of the value
+     * @return pointer to the value, or nullptr if index out of bounds
+     */
+    T *getValAt(size_t index) {
+        if (index < size_) {
+            return &static_cast<Node*>(getLinkedNodeAt(head.next, index))->val;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Get value at first index.
+     *
+     * @return pointer to the value, or nullptr if list is empty
+     */
+    T *getFirstVal() {
+        return getValAt(0);
+    }
+
+    /**
+     * Get value at last index.
+     *
+     * @return pointer to the value, or nullptr if list is empty
+     */
+    T *getLastVal() {
+        return (size_ > 0) ? getValAt(size_-1) : nullptr;
+    }
+
+    /**
+     * Set value at index.
+     *
+     * @param index the index for the value
+     * @param val the value to set; value will be moved to store
+     * @return false if index out of bounds
+     */
+    bool setValAt(size_t index, T val) {
+        T *loc = getValAt(index);
+        if (loc != nullptr) {
+            *loc = std::move(val);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Delete the linked list value at the specified index.
+     *
+     * @param index the index
+     * @return false if index out of bounds
+     */
+    bool deleteValAt(size_t index) {
+        if (index >= size_) {
+            return false;
+        }
+        // find node before the one to delete
+        NodeBase *node = getLinkedNodeAt(&head, index);
+        Node *oldNode = static_cast<Node*>(node->next);
+        node->next = oldNode->next;
+        delete oldNode;
+        size_--;
+        return true;
+    }
+
+    /**
+     * Delete the first linked list value.
+     *
+     * @return false if list is empty
+     */
+    bool deleteFirstVal() {
+        return deleteValAt(0);
+    }
+
+    /**
+     * Delete the last linked list value.
+     *
+     * @return false if list is empty
+     */
+    bool deleteLastVal() {
+        return (size_ > 0) && deleteValAt(size_-1);
+    }
+
+    /**
+     * Deletes all linked list values.
+     */
+    void deleteAllVals() {
+        NodeBase *node = head.next;
+        while (node != nullptr) {
+            NodeBase *next = node->next;
+            delete static_cast<Node*>(node);
+            node = next;
+        }
+        head.next = nullptr;
+        size_ = 0;
+    }
+
+    /** Returns number of items in the linked list. */
+    size_t size() const noexcept { return size_; }
+
+    /** Determines whether linked list is empty. */
+    bool empty() const noexcept { return size_ == 0; }
+
+    /** Returns the maximum capacity of the linked list. */
+    size_t max_size() const noexcept { return maxCapacity; }
+
+    /** Returns iterators over the list values. */
+    iterator begin() noexcept { return iterator(head.next); }
+    iterator end() noexcept { return iterator(); }
+    const_iterator begin() const noexcept { return const_iterator(head.next); }
+    const_iterator end() const noexcept { return const_iterator(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+private:
+    /**
+     * Returns the node k nodes after node.
+     *
+     * @param node the starting node
+     * @param k the number of nodes to advance
+     * @return the node, or nullptr if there is none
+     */
+    static NodeBase *getLinkedNodeAt(NodeBase *node, size_t k) {
+        for (; node != nullptr && k > 0; k--) {
+            node = node->next;
+        }
+        return node;
+    }
+
+    /** The dummy head node of the linked node chain */
+    NodeBase head;
+    /** The size of the linked list */
+    size_t size_ = 0;
+    /** The maximum capacity of the linked list */
+    size_t maxCapacity;
+};
+
+} // namespace ds
+
+#endif /* DS_LINKED_LIST_HPP_ */
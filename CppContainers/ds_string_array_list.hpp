@@ -0,0 +1,179 @@
+/**
+ * @file ds_string_array_list.hpp
+ *
+ * Header-only C++ wrapper of the C ArrayList of strings.
+ *
+ * ds::StringArrayList owns a C ArrayList and deletes it when it is
+ * destroyed; it can be moved but not copied. Values are still copied
+ * in by the C functions, but the iterators are pointers into the C
+ * array storage, so std::sort and the other algorithms rearrange the
+ * string pointers in place without copying the strings.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef DS_STRING_ARRAY_LIST_HPP_
+#define DS_STRING_ARRAY_LIST_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+extern "C" {
+#include "array_list.h"
+}
+
+namespace ds {
+
+/** Array List of strings backed by the C ArrayList */
+class StringArrayList {
+public:
+    using value_type = char*;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = char**;
+    using const_iterator = char* const*;
+
+    /**
+     * Create an array list with a maximum capacity.
+     *
+     * @param maxCapacity maximum capacity of the ArrayList
+     */
+    explicit StringArrayList(size_t maxCapacity = SIZE_MAX)
+        : list(newArrayList(maxCapacity)) {}
+
+    /** Copying is disabled; move the list instead */
+    StringArrayList(const StringArrayList&) = delete;
+    StringArrayList &operator=(const StringArrayList&) = delete;
+
+    /**
+     * Move a list, leaving the source with no C list.
+     *
+     * @param other the list to move
+     */
+    StringArrayList(StringArrayList &&other) noexcept
+        : list(std::exchange(other.list, nullptr)) {}
+
+    /**
+     * Move-assign a list, leaving the source with no C list.
+     *
+     * @param other the list to move
+     * @return this list
+     */
+    StringArrayList &operator=(StringArrayList &&other) noexcept {
+        if (this != &other) {
+            if (list != nullptr) {
+                deleteArrayList(list);
+            }
+            list = std::exchange(other.list, nullptr);
+        }
+        return *this;
+    }
+
+    /** Delete the C array list and its values */
+    ~StringArrayList() {
+        if (list != nullptr) {
+            deleteArrayList(list);
+        }
+    }
+
+    /** Returns the C array list */
+    ::ArrayList *get() noexcept { return list; }
+
+    /**
+     * Add value to list at index.
+     *
+     * @param index the index for the new value
+     * @param val the value to insert; value will be copied to store
+     * @return false if index out of bounds, exceeds max capacity
+     */
+    bool addValAt(size_t index, const char *val) {
+        return addArrayListValAt(list, index, val);
+    }
+
+    /**
+     * Add value to start of list.
+     *
+     * @param val the value to insert; value will be copied to store
+     * @return false if exceeds max capacity
+     */
+    bool addFirstVal(const char *val) {
+        return addFirstArrayListVal(list, val);
+    }
+
+    /**
+     * Add value to end of list.
+     *
+     * @param val the value to insert; value will be copied to store
+     * @return false if exceeds max capacity
+     */
+    bool addLastVal(const char *val) {
+        return addLastArrayListVal(list, val);
+    }
+
+    /**
+     * Get value at index.
+     *
+     * @param index the index of the value
+     * @return the value, or nullptr if index out of bounds
+     */
+    const char *getValAt(size_t index) {
+        const char *val;
+        return getArrayListValAt(list, index, &val) ? val : nullptr;
+    }
+
+    /**
+     * Set value at index.
+     *
+     * @param index the index for the value
+     * @param val the value to set; value will be copied to store
+     * @return false if index out of bounds
+     */
+    bool setValAt(size_t index, const char *val) {
+        return setArrayListValAt(list, index, val);
+    }
+
+    /**
+     * Delete the array list value at the specified index.
+     *
+     * @param index the index
+     * @return false if index out of bounds
+     */
+    bool deleteValAt(size_t index) {
+        return deleteArrayListValAt(list, index);
+    }
+
+    /**
+     * Deletes all array list values.
+     */
+    void deleteAllVals() {
+        deleteAllArrayListVals(list);
+    }
+
+    /** Returns number of items in the array list. */
+    size_t size() const noexcept { return list->size; }
+
+    /** Determines whether array list is empty. */
+    bool empty() const noexcept { return list->size == 0; }
+
+    /** Returns the value at index without bounds checking. */
+    const char *operator[](size_t index) const noexcept { return list->vals[index]; }
+
+    /** Returns iterators over the C array storage. */
+    iterator begin() noexcept { return list->vals; }
+    iterator end() noexcept { return list->vals + list->size; }
+    const_iterator begin() const noexcept { return list->vals; }
+    const_iterator end() const noexcept { return list->vals + list->size; }
+
+    /** Print the array list. */
+    void print() const { printArrayList(list); }
+
+private:
+    /** The C array list */
+    ::ArrayList *list;
+};
+
+} // namespace ds
+
+#endif /* DS_STRING_ARRAY_LIST_HPP_ */
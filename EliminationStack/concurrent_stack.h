@@ -0,0 +1,119 @@
+/**
+ * @file concurrent_stack.h
+ *
+ * Declarations for a lock-free linked stack that can be shared by
+ * many threads (a Treiber stack).
+ *
+ * Push and pop swing the head pointer with compare-and-swap. Popped
+ * nodes are retired through epoch-based reclamation rather than
+ * freed, so a node that another popper has read as the head cannot
+ * be freed, and its address cannot be reused for a new node, while
+ * that popper is still in its critical section. This both makes
+ * reading head->next safe and rules out the ABA problem: a CAS that
+ * finds the same head pointer has found the same node.
+ *
+ * Threads that pop must call exitEpochThread before they end.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef CONCURRENT_STACK_H_
+#define CONCURRENT_STACK_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Concurrent stack node */
+typedef struct ConcurrentStackNode {
+    /** The node below this one */
+    struct ConcurrentStackNode *next;
+    /** The value, stored inline so a node is one allocation */
+    char val[];
+} ConcurrentStackNode;
+
+/** Concurrent stack data structure */
+typedef struct {
+    /** The top node */
+    _Atomic(ConcurrentStackNode*) head;
+    /** Number of values, including pushes in progress */
+    atomic_size_t size;
+    /** Maximum number of values */
+    size_t maxCapacity;
+} ConcurrentStack;
+
+/**
+ * Create a concurrent stack with a max capacity.
+ *
+ * @param maxCapacity the maximum capacity of the stack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated concurrent stack
+ */
+ConcurrentStack *newConcurrentStack(size_t maxCapacity);
+
+/**
+ * Push value onto the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if exceeds max capacity
+ */
+bool pushConcurrentStackVal(ConcurrentStack *stack, const char *val);
+
+/**
+ * Get a copy of the top stack value without removing it.
+ *
+ * @param stack the ConcurrentStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool peekConcurrentStackVal(ConcurrentStack *stack, char **val);
+
+/**
+ * Pop the top stack value.
+ *
+ * @param stack the ConcurrentStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool popConcurrentStackVal(ConcurrentStack *stack, char **val);
+
+/**
+ * Returns number of items in the stack. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @return the number of items in the stack
+ */
+size_t concurrentStackSize(ConcurrentStack *stack);
+
+/**
+ * Determines whether stack is empty. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ * @return true if stack is empty, false otherwise
+ */
+bool isConcurrentStackEmpty(ConcurrentStack *stack);
+
+/**
+ * Delete the stack. Frees copies of all strings, the nodes, and
+ * finally the stack itself. No thread may be using the stack.
+ *
+ * @param stack the ConcurrentStack
+ */
+void deleteConcurrentStack(ConcurrentStack *stack);
+
+/**
+ * Print stack for diagnostic purposes. No thread may be
+ * changing the stack.
+ *
+ * @param stack the ConcurrentStack
+ */
+void printConcurrentStack(ConcurrentStack *stack);
+
+#endif /* CONCURRENT_STACK_H_ */
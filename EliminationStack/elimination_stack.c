@@ -0,0 +1,286 @@
+/**
+ * @file elimination_stack.c
+ *
+ * Implementation for a lock-free stack with an elimination array.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "elimination_stack.h"
+#include "epoch.h"
+
+/** Number of times a push checks its offer before withdrawing it */
+#define ELIMINATION_WAIT_SPINS 256
+
+/** Random state of this thread; never 0 */
+static _Thread_local uint64_t randomState = 0;
+
+/** Index of this thread's slot range in each stack */
+static _Thread_local unsigned threadRange = 0;
+
+/** Index of the slot range for the next thread */
+static atomic_uint nextThreadRange = 0;
+
+/**
+ * Create an elimination stack.
+ *
+ * @return the allocated elimination stack
+ */
+EliminationStack *newEliminationStack(void) {
+    // aligned so the head and each slot are on their own cache lines
+    EliminationStack *stack = aligned_alloc(ELIMINATION_CACHE_LINE, sizeof(EliminationStack));
+    if (stack == NULL) {
+        return NULL;
+    }
+    atomic_init(&stack->head, NULL);
+    for (int i = 0; i < ELIMINATION_SLOTS; i++) {
+        atomic_init(&stack->slots[i].offer, NULL);
+    }
+    for (int i = 0; i < ELIMINATION_RANGES; i++) {
+        atomic_init(&stack->ranges[i].range, ELIMINATION_SLOTS);
+    }
+    return stack;
+}
+
+/**
+ * Choose a random slot within this thread's range.
+ *
+ * @param stack the EliminationStack
+ * @return the slot
+ */
+static EliminationSlot *randomSlot(EliminationStack *stack) {
+    if (randomState == 0) {
+        randomState = 0x9E3779B97F4A7C15u ^ (uintptr_t)&randomState;
+        threadRange = atomic_fetch_add_explicit(&nextThreadRange, 1, memory_order_relaxed)
+                    % ELIMINATION_RANGES;
+    }
+    // xorshift64
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    unsigned range = atomic_load_explicit(&stack->ranges[threadRange].range, memory_order_relaxed);
+    return &stack->slots[randomState % range];
+}
+
+/**
+ * Offer a node to a pop through the elimination array.
+ *
+ * @param stack the EliminationStack
+ * @param node the node to push
+ * @return true if a pop took the node, false to retry the head
+ */
+static bool offerPush(EliminationStack *stack, EliminationNode *node) {
+    EliminationSlot *slot = randomSlot(stack);
+    // shared only with threads beyond ELIMINATION_RANGES
+    atomic_uint *range = &stack->ranges[threadRange].range;
+    unsigned oldRange = atomic_load_explicit(range, memory_order_relaxed);
+    EliminationNode *empty = NULL;
+    // release: a pop that takes the node sees its value
+    if (!atomic_compare_exchange_strong_explicit(&slot->offer, &empty, node,
+                                                 memory_order_release,
+                                                 memory_order_relaxed)) {
+        // slot busy: spread out over more slots
+        if (oldRange < ELIMINATION_SLOTS) {
+            atomic_store_explicit(range, oldRange * 2, memory_order_relaxed);
+        }
+        return false;
+    }
+
+    for (int i = 0; i < ELIMINATION_WAIT_SPINS; i++) {
+        if (atomic_load_explicit(&slot->offer, memory_order_relaxed) != node) {
+            return true;  // a pop took it
+        }
+    }
+
+    // withdraw the offer unless a pop takes it first
+    EliminationNode *offered = node;
+    if (atomic_compare_exchange_strong_explicit(&slot->offer, &offered, NULL,
+                                                memory_order_relaxed,
+                                                memory_order_relaxed)) {
+        // no partner: gather into fewer slots
+        if (oldRange > 1) {
+            atomic_store_explicit(range, oldRange / 2, memory_order_relaxed);
+        }
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Take a node offered by a push through the elimination array.
+ *
+ * @param stack the EliminationStack
+ * @return the node, or NULL if none was taken
+ */
+static EliminationNode *takeOffer(EliminationStack *stack) {
+    EliminationSlot *slot = randomSlot(stack);
+    EliminationNode *node = atomic_load_explicit(&slot->offer, memory_order_relaxed);
+    // acquire: see the value the push wrote
+    if (node != NULL
+        && atomic_compare_exchange_strong_explicit(&slot->offer, &node, NULL,
+                                                   memory_order_acquire,
+                                                   memory_order_relaxed)) {
+        return node;
+    }
+    return NULL;
+}
+
+/**
+ * Push value onto the stack.
+ *
+ * @param stack the EliminationStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if out of memory
+ */
+bool pushEliminationStackVal(EliminationStack *stack, const char *val) {
+    size_t len = strlen(val);
+    EliminationNode *node = malloc(sizeof(EliminationNode) + len + 1);
+    if (node == NULL) {
+        return false;
+    }
+    memcpy(node->val, val, len + 1);  // must copy input string
+
+    // the epoch keeps an offered node from being freed and reused
+    // at the same address while we watch the slot for it
+    enterEpoch();
+    node->next = atomic_load_explicit(&stack->head, memory_order_relaxed);
+    // release: publish node and its value with the new head
+    while (!atomic_compare_exchange_weak_explicit(&stack->head, &node->next, node,
+                                                  memory_order_release,
+                                                  memory_order_relaxed)) {
+        // contention on the head: try to meet a pop instead
+        if (offerPush(stack, node)) {
+            break;
+        }
+        node->next = atomic_load_explicit(&stack->head, memory_order_relaxed);
+    }
+    exitEpoch();
+    return true;
+}
+
+/**
+ * Get a copy of the top stack value without removing it.
+ *
+ * @param stack the EliminationStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool peekEliminationStackVal(EliminationStack *stack, char **val) {
+    enterEpoch();
+    EliminationNode *top = atomic_load_explicit(&stack->head, memory_order_acquire);
+    if (top != NULL) {
+        // copy inside the epoch because a popper may retire top
+        *val = strdup(top->val);
+    }
+    exitEpoch();
+    return top != NULL;
+}
+
+/**
+ * Pop the top stack value.
+ *
+ * @param stack the EliminationStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool popEliminationStackVal(EliminationStack *stack, char **val) {
+    // the epoch keeps top from being freed, and so from being
+    // reused at the same address, while we read top->next
+    enterEpoch();
+    EliminationNode *top = atomic_load_explicit(&stack->head, memory_order_acquire);
+    while (top != NULL
+           && !atomic_compare_exchange_weak_explicit(&stack->head, &top, top->next,
+                                                     memory_order_acquire,
+                                                     memory_order_acquire)) {
+        // contention on the head: try to meet a push instead
+        EliminationNode *offered = takeOffer(stack);
+        if (offered != NULL) {
+            top = offered;
+            break;
+        }
+        top = atomic_load_explicit(&stack->head, memory_order_acquire);
+    }
+    exitEpoch();
+    if (top == NULL) {
+        return false;
+    }
+
+    // top is ours; copy the value out and retire the node, which
+    // peekers or its pusher may still be reading
+    *val = strdup(top->val);
+    retireEpochPtr(top, free);
+    return true;
+}
+
+/**
+ * Returns number of items in the stack by counting them. The result
+ * may be out of date if other threads are changing the stack.
+ *
+ * @param stack the EliminationStack
+ * @return the number of items in the stack
+ */
+size_t eliminationStackSize(EliminationStack *stack) {
+    size_t size = 0;
+    enterEpoch();
+    for (EliminationNode *node = atomic_load_explicit(&stack->head, memory_order_acquire);
+         node != NULL; node = node->next) {
+        size++;
+    }
+    exitEpoch();
+    return size;
+}
+
+/**
+ * Determines whether stack is empty. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the EliminationStack
+ * @return true if stack is empty, false otherwise
+ */
+bool isEliminationStackEmpty(EliminationStack *stack) {
+    return atomic_load(&stack->head) == NULL;
+}
+
+/**
+ * Delete the stack. Frees copies of all strings, the nodes, and
+ * finally the stack itself. No thread may be using the stack.
+ *
+ * @param stack the EliminationStack
+ */
+void deleteEliminationStack(EliminationStack *stack) {
+    EliminationNode *node = atomic_load(&stack->head);
+    while (node != NULL) {
+        EliminationNode *next = node->next;
+        free(node);
+        node = next;
+    }
+
+    // set fields to safe values
+    atomic_store(&stack->head, NULL);
+
+    // free the stack itself
+    free(stack);
+}
+
+/**
+ * Print stack for diagnostic purposes. No thread may be
+ * changing the stack.
+ *
+ * @param stack the EliminationStack
+ */
+void printEliminationStack(EliminationStack *stack) {
+    printf("( ");
+    for (EliminationNode *node = atomic_load(&stack->head); node != NULL; node = node->next) {
+        printf("\"%s\" ", node->val);
+    }
+    printf(")\n");
+}
@@ -0,0 +1,145 @@
+/**
+ * @file elimination_stack.h
+ *
+ * Declarations for a lock-free stack with an elimination array,
+ * for push and pop traffic too heavy for a single head pointer.
+ *
+ * Each operation first tries a compare-and-swap on the head, as in
+ * ConcurrentStack. If the CAS fails because of contention, a push
+ * offers its node in a randomly chosen slot of the elimination
+ * array and waits briefly, and a pop looks in a random slot for an
+ * offered node. A pop that takes an offer completes both operations
+ * without touching the head: the push is linearized just before the
+ * pop. Threads adapt the range of slots they use, narrowing it when
+ * offers time out and widening it when slots are busy. Each stack
+ * keeps its own range for each thread, so contention on one stack
+ * does not change how threads use the slots of another.
+ *
+ * Nodes are reclaimed with epoch-based reclamation. Threads must
+ * call exitEpochThread before they end.
+ *
+ * The stack is unbounded: a shared size counter would serialize the
+ * threads that the elimination array spreads out.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ELIMINATION_STACK_H_
+#define ELIMINATION_STACK_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Size of a cache line */
+#define ELIMINATION_CACHE_LINE 64
+
+/** Number of slots in the elimination array */
+#define ELIMINATION_SLOTS 16
+
+/** Number of per-thread slot ranges; further threads share them */
+#define ELIMINATION_RANGES 32
+
+/** Elimination stack node */
+typedef struct EliminationNode {
+    /** The node below this one */
+    struct EliminationNode *next;
+    /** The value, stored inline so a node is one allocation */
+    char val[];
+} EliminationNode;
+
+/** Elimination array slot, on its own cache line */
+typedef struct {
+    /** Node offered by a waiting push, or NULL */
+    _Alignas(ELIMINATION_CACHE_LINE) _Atomic(EliminationNode*) offer;
+} EliminationSlot;
+
+/** Range of slots a thread uses, on its own cache line */
+typedef struct {
+    /** Number of slots the thread chooses among */
+    _Alignas(ELIMINATION_CACHE_LINE) atomic_uint range;
+} EliminationRange;
+
+/** Elimination stack data structure */
+typedef struct {
+    /** The top node */
+    _Alignas(ELIMINATION_CACHE_LINE) _Atomic(EliminationNode*) head;
+    /** The elimination array */
+    EliminationSlot slots[ELIMINATION_SLOTS];
+    /** The slot range of each thread, indexed by thread number */
+    EliminationRange ranges[ELIMINATION_RANGES];
+} EliminationStack;
+
+/**
+ * Create an elimination stack.
+ *
+ * @return the allocated elimination stack
+ */
+EliminationStack *newEliminationStack(void);
+
+/**
+ * Push value onto the stack.
+ *
+ * @param stack the EliminationStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if out of memory
+ */
+bool pushEliminationStackVal(EliminationStack *stack, const char *val);
+
+/**
+ * Get a copy of the top stack value without removing it.
+ *
+ * @param stack the EliminationStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool peekEliminationStackVal(EliminationStack *stack, char **val);
+
+/**
+ * Pop the top stack value.
+ *
+ * @param stack the EliminationStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the stack is empty
+ */
+bool popEliminationStackVal(EliminationStack *stack, char **val);
+
+/**
+ * Returns number of items in the stack by counting them. The result
+ * may be out of date if other threads are changing the stack.
+ *
+ * @param stack the EliminationStack
+ * @return the number of items in the stack
+ */
+size_t eliminationStackSize(EliminationStack *stack);
+
+/**
+ * Determines whether stack is empty. The result may be out of
+ * date if other threads are changing the stack.
+ *
+ * @param stack the EliminationStack
+ * @return true if stack is empty, false otherwise
+ */
+bool isEliminationStackEmpty(EliminationStack *stack);
+
+/**
+ * Delete the stack. Frees copies of all strings, the nodes, and
+ * finally the stack itself. No thread may be using the stack.
+ *
+ * @param stack the EliminationStack
+ */
+void deleteEliminationStack(EliminationStack *stack);
+
+/**
+ * Print stack for diagnostic purposes. No thread may be
+ * changing the stack.
+ *
+ * @param stack the EliminationStack
+ */
+void printEliminationStack(EliminationStack *stack);
+
+#endif /* ELIMINATION_STACK_H_ */
@@ -0,0 +1,122 @@
+/*
+ * @file elimination_stack_bench.c
+ *
+ * Benchmark of stack throughput with many threads, comparing the
+ * EliminationStack with the plain lock-free ConcurrentStack. Each
+ * thread pushes a value and then pops one, over and over, so pushes
+ * and pops are balanced and can eliminate each other.
+ *
+ * Usage: elimination_stack_bench [millis [maxThreads]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "concurrent_stack.h"
+#include "elimination_stack.h"
+#include "epoch.h"
+
+/** State shared by the benchmark threads */
+typedef struct {
+    /** the elimination stack, or NULL to use concurrentStack */
+    EliminationStack *eliminationStack;
+    /** the plain lock-free stack */
+    ConcurrentStack *concurrentStack;
+    /** set to stop the threads */
+    atomic_bool stop;
+    /** total pushes and pops by all threads */
+    atomic_size_t ops;
+} BenchState;
+
+/**
+ * Benchmark thread that pushes and pops until stopped.
+ *
+ * @param arg the benchmark state
+ * @return NULL
+ */
+static void *benchThread(void *arg) {
+    BenchState *bs = arg;
+    size_t ops = 0;
+    char *val;
+    while (!atomic_load_explicit(&bs->stop, memory_order_relaxed)) {
+        bool popped;
+        if (bs->eliminationStack != NULL) {
+            pushEliminationStackVal(bs->eliminationStack, "value");
+            popped = popEliminationStackVal(bs->eliminationStack, &val);
+        } else {
+            pushConcurrentStackVal(bs->concurrentStack, "value");
+            popped = popConcurrentStackVal(bs->concurrentStack, &val);
+        }
+        if (popped) {
+            free(val);
+        }
+        ops += 2;
+    }
+    atomic_fetch_add(&bs->ops, ops);
+    exitEpochThread();
+    return NULL;
+}
+
+/**
+ * Run threads for a time and report throughput.
+ *
+ * @param useElimination true to use the EliminationStack
+ * @param numThreads the number of threads
+ * @param millis the run time in milliseconds
+ * @return the throughput in millions of operations per second
+ */
+static double runBench(bool useElimination, int numThreads, long millis) {
+    BenchState bs;
+    bs.eliminationStack = useElimination ? newEliminationStack() : NULL;
+    bs.concurrentStack = useElimination ? NULL : newConcurrentStack(SIZE_MAX);
+    atomic_init(&bs.stop, false);
+    atomic_init(&bs.ops, 0);
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+    for (int t = 0; t < numThreads; t++) {
+        pthread_create(&threads[t], NULL, benchThread, &bs);
+    }
+
+    struct timespec ts = { millis / 1000, (millis % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+    atomic_store(&bs.stop, true);
+
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+
+    if (useElimination) {
+        deleteEliminationStack(bs.eliminationStack);
+    } else {
+        deleteConcurrentStack(bs.concurrentStack);
+    }
+    return atomic_load(&bs.ops) / (millis / 1000.0) / 1e6;
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    long millis = (argc > 1) ? strtol(argv[1], NULL, 10) : 500;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : 64;
+
+    printf("%8s %16s %18s %8s\n", "threads", "lock-free (M/s)", "elimination (M/s)", "speedup");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double lockFreeRate = runBench(false, threads, millis);
+        double eliminationRate = runBench(true, threads, millis);
+        printf("%8d %16.2f %18.2f %8.2f\n", threads, lockFreeRate, eliminationRate,
+               eliminationRate / lockFreeRate);
+        fflush(stdout);
+    }
+    exitEpochThread();
+
+    return EXIT_SUCCESS;
+}
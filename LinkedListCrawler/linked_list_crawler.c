@@ -24,6 +24,35 @@ LinkedListCrawler* newLinkedListCrawler(LinkedList* theList, LinkedListCrawlerCa
 	crawler->callback = cb;
 	crawler->itr = newLinkedListIterator(theList);
 	crawler->callbackData = NULL;
+	crawler->batchCallback = NULL;
+	crawler->batchSize = 0;
+	crawler->batch = NULL;
+	return crawler;
+}
+
+/**
+ * Create and initialize new crawler that gathers the values of up
+ * to batchSize nodes and calls the batch callback once per block.
+ *
+ * @param list the LinkedList to crawl
+ * @param cb the batch callback for this crawler
+ * @param batchSize the maximum number of values per batch; 0 for
+ *   LINKED_LIST_CRAWLER_BATCH_SIZE
+ * @return an crawler for the list, or NULL if out of memory
+ */
+LinkedListCrawler* newLinkedListBatchCrawler(LinkedList* theList, LinkedListCrawlerBatchCallback cb,
+                                             size_t batchSize) {
+	if (batchSize == 0) {
+		batchSize = LINKED_LIST_CRAWLER_BATCH_SIZE;
+	}
+	const char **batch = malloc(batchSize * sizeof(const char*));
+	if (batch == NULL) {
+		return NULL;
+	}
+	LinkedListCrawler *crawler = newLinkedListCrawler(theList, NULL);
+	crawler->batchCallback = cb;
+	crawler->batchSize = batchSize;
+	crawler->batch = batch;
 	return crawler;
 }
 
@@ -37,12 +66,52 @@ void deleteLinkedListCrawler(LinkedListCrawler* crawler) {
 	crawler->itr = NULL;
 	crawler->callback = NULL;
 	crawler->callbackData = NULL;
+	crawler->batchCallback = NULL;
+	free(crawler->batch);  // free ok with NULL
+	crawler->batch = NULL;
 
 	free(crawler);
 }
 
 /**
- * Start crawling the LinkedList with the specified data
+ * Crawl the LinkedList in blocks, calling the batch callback once
+ * per block. Walks the nodes directly rather than through the
+ * iterator functions, and advances the iterator to the last node
+ * of each block before calling the callback.
+ *
+ * @param crawler the LinkedListCrawler to start
+ * @return true if crawler ran to completion, false if stopped early
+ */
+static bool startLinkedListBatchCrawler(LinkedListCrawler *crawler) {
+	LinkedListIterator *itr = crawler->itr;
+	const char **batch = crawler->batch;
+	size_t batchSize = crawler->batchSize;
+
+	LinkedNode *node = itr->curNode;
+	while (node->next != NULL) {
+		// gather values of the next block
+		size_t count = 0;
+		do {
+			node = node->next;
+			batch[count++] = node->data;
+		} while (count < batchSize && node->next != NULL);
+
+		itr->curNode = node;
+		itr->count += count;
+		if (!crawler->batchCallback(crawler, batch, count)) {
+			return false;	// function signals early completion
+		}
+		// callback may have reset the crawler
+		node = itr->curNode;
+	}
+	return true;
+}
+
+/**
+ * Start crawling the LinkedList with the specified data. A batch
+ * crawler is positioned at the last value of the current block
+ * while its callback runs, so the block starts at index
+ * getLinkedListCrawlerCount(crawler) - count.
  *
  * @param crawler the LinkedListCrawler to start
  * @param the data for the callback function
@@ -52,6 +121,10 @@ bool startLinkedListCrawler(LinkedListCrawler *crawler, void *data) {
 	// initialize the callback data
 	crawler->callbackData = data;
 
+	if (crawler->batchCallback != NULL) {
+		return startLinkedListBatchCrawler(crawler);
+	}
+
 	// loop until iterator has completed
 	const char *val;
 	while (getNextLinkedListIteratorVal(crawler->itr, &val)) {
@@ -23,6 +23,17 @@ struct LinkedListCrawler;
  */
 typedef bool (*LinkedListCrawlerCallback)(struct LinkedListCrawler *crawler);
 
+/**
+ * LinkedListCrawler batch callback function type. Called once per
+ * block with the values of up to batchSize consecutive nodes.
+ * Returns true to continue crawling, false to stop crawling
+ */
+typedef bool (*LinkedListCrawlerBatchCallback)(struct LinkedListCrawler *crawler,
+                                               const char *const vals[], size_t count);
+
+/** Default number of values passed to a batch callback */
+#define LINKED_LIST_CRAWLER_BATCH_SIZE 64
+
 /**
  * A crawler for a singly-linked list.
  */
@@ -35,6 +46,15 @@ typedef struct LinkedListCrawler{
 
   /** The LinkedListCrawler callback data */
   void *callbackData;
+
+  /** The LinkedListCrawler batch callback, or NULL to call callback per value */
+  LinkedListCrawlerBatchCallback batchCallback;
+
+  /** The maximum number of values per batch */
+  size_t batchSize;
+
+  /** Buffer for the values of the current batch */
+  const char **batch;
 } LinkedListCrawler;
 
 /**
@@ -46,6 +66,19 @@ typedef struct LinkedListCrawler{
  */
 LinkedListCrawler* newLinkedListCrawler(LinkedList* theList, LinkedListCrawlerCallback cb);
 
+/**
+ * Create and initialize new crawler that gathers the values of up
+ * to batchSize nodes and calls the batch callback once per block.
+ *
+ * @param list the LinkedList to crawl
+ * @param cb the batch callback for this crawler
+ * @param batchSize the maximum number of values per batch; 0 for
+ *   LINKED_LIST_CRAWLER_BATCH_SIZE
+ * @return an crawler for the list, or NULL if out of memory
+ */
+LinkedListCrawler* newLinkedListBatchCrawler(LinkedList* theList, LinkedListCrawlerBatchCallback cb,
+                                             size_t batchSize);
+
 /**
  * Delete the crawler by freeing its storage.
  *
@@ -54,7 +87,10 @@ LinkedListCrawler* newLinkedListCrawler(LinkedList* theList, LinkedListCrawlerCa
 void deleteLinkedListCrawler(LinkedListCrawler* crawler);
 
 /**
- * Start crawling the LinkedList with the specified data
+ * Start crawling the LinkedList with the specified data. A batch
+ * crawler is positioned at the last value of the current block
+ * while its callback runs, so the block starts at index
+ * getLinkedListCrawlerCount(crawler) - count.
  */
 bool startLinkedListCrawler(LinkedListCrawler *crawler, void *data);
 
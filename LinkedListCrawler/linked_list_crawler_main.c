@@ -117,6 +117,68 @@ bool translitCallback(LinkedListCrawler *crawler) {
 	return true;
 }
 
+/**
+ * Print each block of list values on its own line.
+ * @param crawler the crawler
+ * @param vals the values in the block
+ * @param count the number of values in the block
+ * @return true to continue crawling
+ */
+bool printBlockCallback(LinkedListCrawler *crawler, const char *const vals[], size_t count) {
+	size_t first = getLinkedListCrawlerCount(crawler) - count;
+	printf("block at %lu: ( ", first);
+	for (size_t i = 0; i < count; i++) {
+		printf("\"%s\" ", vals[i]);
+	}
+	printf(")\n");
+	return true;
+}
+
+/**
+ * Computes the aggregate length of the strings in the list
+ * a block at a time.
+ * @param crawler the crawler
+ * @param vals the values in the block
+ * @param count the number of values in the block
+ * @return true to continue crawling
+ */
+bool getStrLenBatchCallback(LinkedListCrawler *crawler, const char *const vals[], size_t count) {
+	size_t *len = getLinkedListCrawlerCallbackData(crawler);
+	size_t blockLen = 0;
+	for (size_t i = 0; i < count; i++) {
+		blockLen += strlen(vals[i]);
+	}
+	*len += blockLen;
+	return true;
+}
+
+/** Callback data for findStrBatchCallback */
+typedef struct {
+	/** the string to find */
+	const char *val;
+	/** the index where it was found */
+	size_t index;
+} FindStrData;
+
+/**
+ * Finds a string in the list a block at a time, and records the
+ * index where it was found.
+ * @param crawler the crawler
+ * @param vals the values in the block
+ * @param count the number of values in the block
+ * @return true to continue crawling
+ */
+bool findStrBatchCallback(LinkedListCrawler *crawler, const char *const vals[], size_t count) {
+	FindStrData *target = getLinkedListCrawlerCallbackData(crawler);
+	for (size_t i = 0; i < count; i++) {
+		if (strcmp(target->val, vals[i]) == 0) {
+			target->index = getLinkedListCrawlerCount(crawler) - count + i;
+			return false;  // stop if found
+		}
+	}
+	return true;
+}
+
 /**
  * This function tests linked list crawler.
  */
@@ -227,6 +289,37 @@ void testLinkedListCrawler() {
 
 	deleteLinkedListCrawler(crawler);
 
+	// use batch callback to print list in blocks of 2 values
+	printf("\nbatch crawler with printBlockCallback\n");
+	crawler = newLinkedListBatchCrawler(list, printBlockCallback, 2);
+	result = startLinkedListCrawler(crawler, NULL);
+	printf("crawler returned: %s\n", result ? "true" : "false");
+	printf("crawler count: %lu\n", getLinkedListCrawlerCount(crawler));
+	printf("crawler avail: %lu\n", getLinkedListCrawlerAvailable(crawler));
+	deleteLinkedListCrawler(crawler);
+
+	// use batch callback to get the aggregate length of strings in list
+	printf("\nbatch crawler with getStrLenBatchCallback\n");
+	crawler = newLinkedListBatchCrawler(list, getStrLenBatchCallback, 0);
+	count = 0;
+	result = startLinkedListCrawler(crawler, &count);
+	printf("crawler returned: %s\n", result ? "true" : "false");
+	printf("length of list strings: %lu\n", count);
+	printf("crawler count: %lu\n", getLinkedListCrawlerCount(crawler));
+	deleteLinkedListCrawler(crawler);
+
+	// use batch callback to find string in list
+	printf("\nbatch crawler with findStrBatchCallback\n");
+	crawler = newLinkedListBatchCrawler(list, findStrBatchCallback, 2);
+	FindStrData target = { "C", SIZE_MAX };
+	result = startLinkedListCrawler(crawler, &target);
+	printf("crawler returned: %s\n", result ? "true" : "false");
+	printf("index of \"%s\" is: %lu\n", target.val, target.index);
+	printf("crawler count: %lu\n", getLinkedListCrawlerCount(crawler));
+	deleteLinkedListCrawler(crawler);
+
+	deleteLinkedList(list);
+
 	printf("end testLinkedListCrawler\n");
 }
 
@@ -0,0 +1,321 @@
+/**
+ * @file linked_list_parallel_crawler.c
+ *
+ * Implementation for a crawler that runs an associative reduction
+ * over a LinkedList on a TaskPool.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "linked_list_parallel_crawler.h"
+
+/** State shared by the segments of one crawl */
+typedef struct {
+    /** the crawler */
+    LinkedListParallelCrawler *crawler;
+    /** the context passed to the crawler functions */
+    void *ctx;
+    /** set when a map call stops the crawl */
+    atomic_bool stopped;
+    /** the segments */
+    struct SegmentArg *segmentArgs;
+    /** the number of segments */
+    size_t segments;
+    /** the first node of each segment */
+    LinkedNode **splitNodes;
+    /** set if splitNodes is already filled in */
+    bool split;
+} CrawlState;
+
+/** Arguments of a segment task */
+typedef struct SegmentArg {
+    /** the crawl state */
+    CrawlState *state;
+    /** the first node of the segment */
+    LinkedNode *first;
+    /** the list index of the first node */
+    size_t index;
+    /** the number of nodes in the segment */
+    size_t count;
+    /** the accumulator for the segment */
+    void *acc;
+    /** the task that maps the segment */
+    Task task;
+} SegmentArg;
+
+/**
+ * Create and initialize a new parallel crawler.
+ *
+ * @param pool the TaskPool to run on, or NULL for the default pool
+ * @param theList the LinkedList to crawl
+ * @param accSize the size of an accumulator in bytes
+ * @param init the function that initializes an accumulator
+ * @param map the function that folds values into an accumulator
+ * @param combine the function that merges two accumulators
+ * @return the crawler, or NULL if out of memory
+ */
+LinkedListParallelCrawler *newLinkedListParallelCrawler(TaskPool *pool, LinkedList *theList,
+                                                        size_t accSize,
+                                                        ParallelCrawlerInitFn init,
+                                                        ParallelCrawlerMapFn map,
+                                                        ParallelCrawlerCombineFn combine) {
+    if (pool == NULL) {
+        pool = getDefaultTaskPool();
+        if (pool == NULL) {
+            return NULL;
+        }
+    }
+    LinkedListParallelCrawler *crawler = malloc(sizeof(LinkedListParallelCrawler));
+    if (crawler == NULL) {
+        return NULL;
+    }
+    crawler->pool = pool;
+    crawler->list = theList;
+    crawler->accSize = accSize;
+    crawler->init = init;
+    crawler->map = map;
+    crawler->combine = combine;
+    crawler->segments = 0;
+    crawler->lastSegments = 0;
+    crawler->splitNodes = NULL;
+    crawler->splitSegments = 0;
+    crawler->splitModCount = 0;
+    return crawler;
+}
+
+/**
+ * Delete the crawler by freeing its storage. Does not delete the
+ * list or the pool.
+ *
+ * @param crawler the LinkedListParallelCrawler to delete
+ */
+void deleteLinkedListParallelCrawler(LinkedListParallelCrawler *crawler) {
+    // set fields to safe values
+    crawler->pool = NULL;
+    crawler->list = NULL;
+    crawler->init = NULL;
+    crawler->map = NULL;
+    crawler->combine = NULL;
+    free(crawler->splitNodes);  // free ok with NULL
+    crawler->splitNodes = NULL;
+
+    free(crawler);
+}
+
+/**
+ * Set the number of segments the list is split into.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @param segments the number of segments, or 0 to choose one per
+ *   PARALLEL_CRAWLER_MIN_SEGMENT values, up to
+ *   PARALLEL_CRAWLER_SEGMENTS_PER_WORKER per worker, or 1 if the
+ *   pool has one worker
+ */
+void setLinkedListParallelCrawlerSegments(LinkedListParallelCrawler *crawler, size_t segments) {
+    crawler->segments = segments;
+}
+
+/**
+ * Returns the number of segments used by the last crawl.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @return the number of segments
+ */
+size_t getLinkedListParallelCrawlerSegments(LinkedListParallelCrawler *crawler) {
+    return crawler->lastSegments;
+}
+
+/**
+ * Map the values of one segment into its accumulator, a block of
+ * value pointers at a time.
+ *
+ * @param arg the SegmentArg
+ */
+static void mapSegment(void *arg) {
+    SegmentArg *sa = arg;
+    CrawlState *state = sa->state;
+    LinkedListParallelCrawler *crawler = state->crawler;
+    crawler->init(sa->acc, state->ctx);
+
+    const char *block[PARALLEL_CRAWLER_BLOCK_SIZE];
+    LinkedNode *node = sa->first;
+    size_t index = sa->index;
+    size_t remaining = sa->count;
+    while (remaining > 0) {
+        // another segment may have stopped the crawl
+        if (atomic_load_explicit(&state->stopped, memory_order_relaxed)) {
+            return;
+        }
+        size_t count = (remaining < PARALLEL_CRAWLER_BLOCK_SIZE)
+                     ? remaining : PARALLEL_CRAWLER_BLOCK_SIZE;
+        for (size_t i = 0; i < count; i++) {
+            block[i] = node->data;
+            node = node->next;
+        }
+        if (!crawler->map(sa->acc, block, count, index, state->ctx)) {
+            atomic_store_explicit(&state->stopped, true, memory_order_relaxed);
+            return;
+        }
+        index += count;
+        remaining -= count;
+    }
+}
+
+/**
+ * Split the list into segments in one pass, spawning each segment
+ * as soon as its first node is found, then map the last segment and
+ * wait for the others. If the split is already known, every segment
+ * is spawned at once.
+ *
+ * @param arg the CrawlState
+ */
+static void splitTask(void *arg) {
+    CrawlState *state = arg;
+    TaskPool *pool = state->crawler->pool;
+    size_t size = state->crawler->list->size;
+    size_t base = size / state->segments;
+    size_t extra = size % state->segments;
+
+    TaskGroup group;
+    initTaskGroup(&group);
+    LinkedNode *node = state->crawler->list->head->next;
+    size_t index = 0;
+    for (size_t s = 0; s < state->segments; s++) {
+        SegmentArg *sa = &state->segmentArgs[s];
+        if (state->split) {
+            node = state->splitNodes[s];
+        } else {
+            state->splitNodes[s] = node;
+        }
+        sa->first = node;
+        sa->index = index;
+        sa->count = base + (s < extra);  // first segments take the remainder
+        if (s == state->segments - 1) {
+            // no need to walk past the last segment
+            mapSegment(sa);
+            break;
+        }
+        spawnTaskGroup(pool, &group, &sa->task, mapSegment, sa);
+        if (!state->split) {
+            for (size_t i = 0; i < sa->count; i++) {
+                node = node->next;
+            }
+        }
+        index += sa->count;
+    }
+    waitTaskGroup(pool, &group);
+}
+
+/**
+ * Choose the number of segments for a crawl.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @return the number of segments; at least 1
+ */
+static size_t chooseSegments(LinkedListParallelCrawler *crawler) {
+    size_t size = crawler->list->size;
+    size_t segments = crawler->segments;
+    if (segments == 0) {
+        int workers = taskPoolWorkers(crawler->pool);
+        if (workers == 1) {
+            return 1;  // no one to share the work with
+        }
+        segments = (size_t)workers * PARALLEL_CRAWLER_SEGMENTS_PER_WORKER;
+        size_t bySize = (size + PARALLEL_CRAWLER_MIN_SEGMENT - 1) / PARALLEL_CRAWLER_MIN_SEGMENT;
+        if (bySize < segments) {
+            segments = bySize;
+        }
+    }
+    // every segment needs a value
+    if (segments > size) {
+        segments = size;
+    }
+    return (segments == 0) ? 1 : segments;
+}
+
+/**
+ * Crawl the list, mapping each segment into its own accumulator on
+ * the pool, and combine the accumulators into result in list order.
+ * The list must not change during the crawl.
+ *
+ * If a map call returns false, the other segments stop at their
+ * next block, so the result covers only part of the list; use early
+ * stopping only when any match will do.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @param ctx the context passed to the init, map and combine functions
+ * @param result result parameter for the combined accumulator;
+ *   accSize bytes
+ * @return true if crawler ran to completion, false if stopped early
+ *   or out of memory
+ */
+bool startLinkedListParallelCrawler(LinkedListParallelCrawler *crawler, void *ctx, void *result) {
+    CrawlState state;
+    state.crawler = crawler;
+    state.ctx = ctx;
+    atomic_init(&state.stopped, false);
+    state.segments = chooseSegments(crawler);
+    crawler->lastSegments = state.segments;
+
+    if (state.segments == 1) {
+        // too small to split: map directly into the result
+        SegmentArg sa;
+        sa.state = &state;
+        sa.first = crawler->list->head->next;
+        sa.index = 0;
+        sa.count = crawler->list->size;
+        sa.acc = result;
+        mapSegment(&sa);
+        return !atomic_load(&state.stopped);
+    }
+
+    // each accumulator on its own cache lines so segments do not share
+    size_t stride = (crawler->accSize + WS_CACHE_LINE - 1) / WS_CACHE_LINE * WS_CACHE_LINE;
+    if (stride == 0) {
+        stride = WS_CACHE_LINE;
+    }
+    char *accs = aligned_alloc(WS_CACHE_LINE, state.segments * stride);
+    state.segmentArgs = malloc(state.segments * sizeof(SegmentArg));
+    if (accs == NULL || state.segmentArgs == NULL) {
+        free(accs);  // free ok with NULL
+        free(state.segmentArgs);
+        return false;
+    }
+
+    // reuse the last split if no nodes were added or deleted since
+    state.split = (crawler->splitSegments == state.segments
+                   && crawler->splitModCount == crawler->list->modCount);
+    if (!state.split) {
+        LinkedNode **splitNodes = realloc(crawler->splitNodes, state.segments * sizeof(LinkedNode*));
+        if (splitNodes == NULL) {
+            free(accs);
+            free(state.segmentArgs);
+            return false;
+        }
+        crawler->splitNodes = splitNodes;
+        crawler->splitSegments = 0;
+    }
+    state.splitNodes = crawler->splitNodes;
+    for (size_t s = 0; s < state.segments; s++) {
+        state.segmentArgs[s].state = &state;
+        state.segmentArgs[s].acc = accs + s * stride;
+    }
+
+    runTaskPool(crawler->pool, splitTask, &state);
+    crawler->splitSegments = state.segments;
+    crawler->splitModCount = crawler->list->modCount;
+
+    // merge in list order
+    memcpy(result, accs, crawler->accSize);
+    for (size_t s = 1; s < state.segments; s++) {
+        crawler->combine(result, accs + s * stride, ctx);
+    }
+
+    free(accs);
+    free(state.segmentArgs);
+    return !atomic_load(&state.stopped);
+}
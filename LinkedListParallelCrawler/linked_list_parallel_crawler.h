@@ -0,0 +1,150 @@
+/**
+ * @file linked_list_parallel_crawler.h
+ *
+ * Declarations for a crawler that runs an associative reduction over
+ * a LinkedList on a TaskPool.
+ *
+ * One pass down the chain splits the list into segments of about
+ * equal length, and each segment is spawned as a task as soon as
+ * its first node is found, so workers start mapping while the split
+ * pass continues. The crawler keeps the first node of each segment,
+ * and later crawls skip the split pass until the list's modCount
+ * shows that nodes were added or deleted.
+ *
+ * Each segment folds its values into its own accumulator, in blocks
+ * of value pointers. When every segment is done the accumulators are
+ * merged into the result with the combiner, in list order, so the
+ * combiner must be associative but need not be commutative.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef LINKED_LIST_PARALLEL_CRAWLER_H_
+#define LINKED_LIST_PARALLEL_CRAWLER_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "linked_list.h"
+#include "task_pool.h"
+
+/** Largest number of values passed to one call of the map function */
+#define PARALLEL_CRAWLER_BLOCK_SIZE 64
+
+/** Fewest values in a segment when the number of segments is chosen */
+#define PARALLEL_CRAWLER_MIN_SEGMENT 1024
+
+/** Segments per worker when the number of segments is chosen */
+#define PARALLEL_CRAWLER_SEGMENTS_PER_WORKER 4
+
+/**
+ * Initialize an accumulator to the identity of the reduction.
+ * Returns nothing; the accumulator is accSize bytes.
+ */
+typedef void (*ParallelCrawlerInitFn)(void *acc, void *ctx);
+
+/**
+ * Fold a block of consecutive list values into an accumulator. The
+ * first value is at list index index. Returns true to continue
+ * crawling, false to stop the whole crawl.
+ */
+typedef bool (*ParallelCrawlerMapFn)(void *acc, const char *const vals[], size_t count,
+                                     size_t index, void *ctx);
+
+/**
+ * Merge the accumulator of the values that follow into acc.
+ */
+typedef void (*ParallelCrawlerCombineFn)(void *acc, const void *next, void *ctx);
+
+/**
+ * A parallel map/reduce crawler for a singly-linked list.
+ */
+typedef struct {
+    /** The TaskPool the segments run on */
+    TaskPool *pool;
+    /** The LinkedList to crawl */
+    LinkedList *list;
+    /** The size of an accumulator in bytes */
+    size_t accSize;
+    /** Initializes an accumulator */
+    ParallelCrawlerInitFn init;
+    /** Folds values into an accumulator */
+    ParallelCrawlerMapFn map;
+    /** Merges two accumulators */
+    ParallelCrawlerCombineFn combine;
+    /** Number of segments, or 0 to choose from the list size and pool */
+    size_t segments;
+    /** Number of segments used by the last crawl */
+    size_t lastSegments;
+    /** First node of each segment of the last split */
+    LinkedNode **splitNodes;
+    /** Number of segments in splitNodes, or 0 if there is no split */
+    size_t splitSegments;
+    /** The list modCount when splitNodes was filled */
+    size_t splitModCount;
+} LinkedListParallelCrawler;
+
+/**
+ * Create and initialize a new parallel crawler.
+ *
+ * @param pool the TaskPool to run on, or NULL for the default pool
+ * @param theList the LinkedList to crawl
+ * @param accSize the size of an accumulator in bytes
+ * @param init the function that initializes an accumulator
+ * @param map the function that folds values into an accumulator
+ * @param combine the function that merges two accumulators
+ * @return the crawler, or NULL if out of memory
+ */
+LinkedListParallelCrawler *newLinkedListParallelCrawler(TaskPool *pool, LinkedList *theList,
+                                                        size_t accSize,
+                                                        ParallelCrawlerInitFn init,
+                                                        ParallelCrawlerMapFn map,
+                                                        ParallelCrawlerCombineFn combine);
+
+/**
+ * Delete the crawler by freeing its storage. Does not delete the
+ * list or the pool.
+ *
+ * @param crawler the LinkedListParallelCrawler to delete
+ */
+void deleteLinkedListParallelCrawler(LinkedListParallelCrawler *crawler);
+
+/**
+ * Set the number of segments the list is split into.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @param segments the number of segments, or 0 to choose one per
+ *   PARALLEL_CRAWLER_MIN_SEGMENT values, up to
+ *   PARALLEL_CRAWLER_SEGMENTS_PER_WORKER per worker, or 1 if the
+ *   pool has one worker
+ */
+void setLinkedListParallelCrawlerSegments(LinkedListParallelCrawler *crawler, size_t segments);
+
+/**
+ * Returns the number of segments used by the last crawl.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @return the number of segments
+ */
+size_t getLinkedListParallelCrawlerSegments(LinkedListParallelCrawler *crawler);
+
+/**
+ * Crawl the list, mapping each segment into its own accumulator on
+ * the pool, and combine the accumulators into result in list order.
+ * The list must not change during the crawl, and values must be
+ * added or deleted only through the LinkedList functions.
+ *
+ * If a map call returns false, the other segments stop at their
+ * next block, so the result covers only part of the list; use early
+ * stopping only when any match will do.
+ *
+ * @param crawler the LinkedListParallelCrawler
+ * @param ctx the context passed to the init, map and combine functions
+ * @param result result parameter for the combined accumulator;
+ *   accSize bytes
+ * @return true if crawler ran to completion, false if stopped early
+ *   or out of memory
+ */
+bool startLinkedListParallelCrawler(LinkedListParallelCrawler *crawler, void *ctx, void *result);
+
+#endif /* LINKED_LIST_PARALLEL_CRAWLER_H_ */
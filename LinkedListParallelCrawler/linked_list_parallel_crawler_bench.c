@@ -0,0 +1,207 @@
+/*
+ * @file linked_list_parallel_crawler_bench.c
+ *
+ * Benchmark of LinkedListParallelCrawler with increasing numbers of
+ * workers, against a serial walk of the list, for a cheap reduction
+ * (aggregate string length) and a costlier one (largest string).
+ *
+ * Usage: linked_list_parallel_crawler_bench [maxWorkers [values]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "linked_list.h"
+#include "linked_list_parallel_crawler.h"
+#include "task_pool.h"
+
+/**
+ * Returns the current time in milliseconds.
+ *
+ * @return the time
+ */
+static double nowMillis(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * Initialize a string length accumulator.
+ *
+ * @param acc the accumulator
+ * @param ctx unused
+ */
+static void initStrLen(void *acc, void *ctx) {
+    *(size_t*)acc = 0;
+}
+
+/**
+ * Add the lengths of a block of strings.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index unused
+ * @param ctx unused
+ * @return true to continue crawling
+ */
+static bool mapStrLen(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    size_t len = 0;
+    for (size_t i = 0; i < count; i++) {
+        len += strlen(vals[i]);
+    }
+    *(size_t*)acc += len;
+    return true;
+}
+
+/**
+ * Add two string lengths.
+ *
+ * @param acc the accumulator
+ * @param next the accumulator that follows
+ * @param ctx unused
+ */
+static void combineStrLen(void *acc, const void *next, void *ctx) {
+    *(size_t*)acc += *(const size_t*)next;
+}
+
+/**
+ * Initialize a largest string accumulator to no string.
+ *
+ * @param acc the accumulator
+ * @param ctx unused
+ */
+static void initMaxVal(void *acc, void *ctx) {
+    *(const char**)acc = NULL;
+}
+
+/**
+ * Keep the larger of two strings, either of which may be NULL.
+ *
+ * @param maxVal the largest string so far
+ * @param val the string
+ * @return the larger string
+ */
+static const char *maxVal(const char *maxVal, const char *val) {
+    return (maxVal == NULL || (val != NULL && strcmp(val, maxVal) > 0)) ? val : maxVal;
+}
+
+/**
+ * Find the largest string in a block.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index unused
+ * @param ctx unused
+ * @return true to continue crawling
+ */
+static bool mapMaxVal(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    const char **max = acc;
+    for (size_t i = 0; i < count; i++) {
+        *max = maxVal(*max, vals[i]);
+    }
+    return true;
+}
+
+/**
+ * Keep the larger of two largest strings.
+ *
+ * @param acc the accumulator
+ * @param next the accumulator that follows
+ * @param ctx unused
+ */
+static void combineMaxVal(void *acc, const void *next, void *ctx) {
+    *(const char**)acc = maxVal(*(const char**)acc, *(const char* const*)next);
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    int maxWorkers = (argc > 1) ? atoi(argv[1]) : 8;
+    size_t values = (argc > 2) ? strtoul(argv[2], NULL, 10) : 1 << 22;
+
+    LinkedList *list = newLinkedList(SIZE_MAX);
+    uint64_t state = 88172645463325252u;
+    for (size_t i = 0; i < values; i++) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%llu", (unsigned long long)(state % 1000000000));
+        addFirstLinkedListVal(list, buf);
+    }
+
+    // serial walks
+    double start = nowMillis();
+    size_t expectLen = 0;
+    for (LinkedNode *node = list->head->next; node != NULL; node = node->next) {
+        expectLen += strlen(node->data);
+    }
+    double lenSerialMillis = nowMillis() - start;
+
+    start = nowMillis();
+    const char *expectMax = NULL;
+    for (LinkedNode *node = list->head->next; node != NULL; node = node->next) {
+        expectMax = maxVal(expectMax, node->data);
+    }
+    double maxSerialMillis = nowMillis() - start;
+
+    printf("%-6s %8s %9s %12s %8s %12s %8s\n",
+           "work", "workers", "segments", "first (ms)", "speedup", "again (ms)", "speedup");
+    printf("%-6s %8d %9d %12.2f %8.2f\n", "strlen", 0, 1, lenSerialMillis, 1.0);
+    printf("%-6s %8d %9d %12.2f %8.2f\n", "max", 0, 1, maxSerialMillis, 1.0);
+
+    for (int workers = 1; workers <= maxWorkers; workers *= 2) {
+        TaskPool *pool = newTaskPool(workers);
+
+        // the second crawl reuses the split of the first
+        LinkedListParallelCrawler *crawler =
+            newLinkedListParallelCrawler(pool, list, sizeof(size_t), initStrLen, mapStrLen,
+                                         combineStrLen);
+        double millis[2];
+        size_t len;
+        for (int run = 0; run < 2; run++) {
+            start = nowMillis();
+            startLinkedListParallelCrawler(crawler, NULL, &len);
+            millis[run] = nowMillis() - start;
+            if (len != expectLen) {
+                printf("strlen mismatch: %zu != %zu\n", len, expectLen);
+            }
+        }
+        printf("%-6s %8d %9zu %12.2f %8.2f %12.2f %8.2f\n", "strlen", workers,
+               getLinkedListParallelCrawlerSegments(crawler), millis[0], lenSerialMillis / millis[0],
+               millis[1], lenSerialMillis / millis[1]);
+        deleteLinkedListParallelCrawler(crawler);
+
+        crawler = newLinkedListParallelCrawler(pool, list, sizeof(char*), initMaxVal, mapMaxVal,
+                                               combineMaxVal);
+        const char *max;
+        for (int run = 0; run < 2; run++) {
+            start = nowMillis();
+            startLinkedListParallelCrawler(crawler, NULL, &max);
+            millis[run] = nowMillis() - start;
+            if (strcmp(max, expectMax) != 0) {
+                printf("max mismatch: %s != %s\n", max, expectMax);
+            }
+        }
+        printf("%-6s %8d %9zu %12.2f %8.2f %12.2f %8.2f\n", "max", workers,
+               getLinkedListParallelCrawlerSegments(crawler), millis[0], maxSerialMillis / millis[0],
+               millis[1], maxSerialMillis / millis[1]);
+        deleteLinkedListParallelCrawler(crawler);
+
+        deleteTaskPool(pool);
+        fflush(stdout);
+    }
+
+    deleteLinkedList(list);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,282 @@
+/*
+ * @file linked_list_parallel_crawler_main.c
+ *
+ * Test program for LinkedListParallelCrawler. Runs the reductions of
+ * linked_list_crawler_main.c (aggregate string length, largest
+ * string, finding a string) in parallel and checks each against a
+ * serial walk of the list, for several numbers of segments.
+ *
+ * Usage: linked_list_parallel_crawler_main [workers [values]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "linked_list.h"
+#include "linked_list_parallel_crawler.h"
+#include "task_pool.h"
+
+/**
+ * Initialize a string length accumulator.
+ *
+ * @param acc the accumulator
+ * @param ctx unused
+ */
+static void initStrLen(void *acc, void *ctx) {
+    *(size_t*)acc = 0;
+}
+
+/**
+ * Add the lengths of a block of strings.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index unused
+ * @param ctx unused
+ * @return true to continue crawling
+ */
+static bool mapStrLen(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    size_t len = 0;
+    for (size_t i = 0; i < count; i++) {
+        len += strlen(vals[i]);
+    }
+    *(size_t*)acc += len;
+    return true;
+}
+
+/**
+ * Add two string lengths.
+ *
+ * @param acc the accumulator
+ * @param next the accumulator that follows
+ * @param ctx unused
+ */
+static void combineStrLen(void *acc, const void *next, void *ctx) {
+    *(size_t*)acc += *(const size_t*)next;
+}
+
+/**
+ * Initialize a largest string accumulator to no string.
+ *
+ * @param acc the accumulator
+ * @param ctx unused
+ */
+static void initMaxVal(void *acc, void *ctx) {
+    *(const char**)acc = NULL;
+}
+
+/**
+ * Keep the larger of two strings, either of which may be NULL.
+ *
+ * @param maxVal the largest string so far
+ * @param val the string
+ * @return the larger string
+ */
+static const char *maxVal(const char *maxVal, const char *val) {
+    return (maxVal == NULL || (val != NULL && strcmp(val, maxVal) > 0)) ? val : maxVal;
+}
+
+/**
+ * Find the largest string in a block.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index unused
+ * @param ctx unused
+ * @return true to continue crawling
+ */
+static bool mapMaxVal(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    const char **max = acc;
+    for (size_t i = 0; i < count; i++) {
+        *max = maxVal(*max, vals[i]);
+    }
+    return true;
+}
+
+/**
+ * Keep the larger of two largest strings.
+ *
+ * @param acc the accumulator
+ * @param next the accumulator that follows
+ * @param ctx unused
+ */
+static void combineMaxVal(void *acc, const void *next, void *ctx) {
+    *(const char**)acc = maxVal(*(const char**)acc, *(const char* const*)next);
+}
+
+/** Accumulator for finding a string */
+typedef struct {
+    /** the number of occurrences */
+    size_t count;
+    /** the index of the first occurrence, or SIZE_MAX */
+    size_t first;
+} FindStrAcc;
+
+/**
+ * Initialize a find accumulator to not found.
+ *
+ * @param acc the accumulator
+ * @param ctx the string to find
+ */
+static void initFindStr(void *acc, void *ctx) {
+    *(FindStrAcc*)acc = (FindStrAcc){ 0, SIZE_MAX };
+}
+
+/**
+ * Count occurrences of the string in a block and record the first.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index the list index of the first value
+ * @param ctx the string to find
+ * @return true to continue crawling
+ */
+static bool mapFindStr(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    FindStrAcc *find = acc;
+    const char *targetVal = ctx;
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(targetVal, vals[i]) == 0) {
+            if (find->count++ == 0) {
+                find->first = index + i;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Add occurrence counts and keep the earlier first occurrence; the
+ * accumulators arrive in list order.
+ *
+ * @param acc the accumulator
+ * @param next the accumulator that follows
+ * @param ctx the string to find
+ */
+static void combineFindStr(void *acc, const void *next, void *ctx) {
+    FindStrAcc *find = acc;
+    const FindStrAcc *nextFind = next;
+    if (find->count == 0) {
+        find->first = nextFind->first;
+    }
+    find->count += nextFind->count;
+}
+
+/**
+ * Stop the crawl at any occurrence of the string.
+ *
+ * @param acc the accumulator
+ * @param vals the values
+ * @param count the number of values
+ * @param index the list index of the first value
+ * @param ctx the string to find
+ * @return false once found, to stop crawling
+ */
+static bool mapAnyStr(void *acc, const char *const vals[], size_t count, size_t index, void *ctx) {
+    mapFindStr(acc, vals, count, index, ctx);
+    return ((FindStrAcc*)acc)->count == 0;  // continue if not found
+}
+
+/**
+ * Test functions.
+ */
+int main(int argc, char *argv[]) {
+    int workers = (argc > 1) ? atoi(argv[1]) : 4;
+    size_t values = (argc > 2) ? strtoul(argv[2], NULL, 10) : 100000;
+
+    printf("Building list of %zu values\n", values);
+    LinkedList *list = newLinkedList(SIZE_MAX);
+    for (size_t i = 0; i < values; i++) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%zu", (i * 7919) % 1000);  // each value repeats
+        addFirstLinkedListVal(list, buf);
+    }
+
+    // serial results by walking the list
+    size_t expectLen = 0;
+    const char *expectMax = NULL;
+    FindStrAcc expectFind = { 0, SIZE_MAX };
+    const char *lookingFor = "42";
+    size_t index = 0;
+    for (LinkedNode *node = list->head->next; node != NULL; node = node->next, index++) {
+        expectLen += strlen(node->data);
+        expectMax = maxVal(expectMax, node->data);
+        if (strcmp(node->data, lookingFor) == 0 && expectFind.count++ == 0) {
+            expectFind.first = index;
+        }
+    }
+
+    TaskPool *pool = newTaskPool(workers);
+    LinkedListParallelCrawler *lenCrawler =
+        newLinkedListParallelCrawler(pool, list, sizeof(size_t), initStrLen, mapStrLen, combineStrLen);
+    LinkedListParallelCrawler *maxCrawler =
+        newLinkedListParallelCrawler(pool, list, sizeof(char*), initMaxVal, mapMaxVal, combineMaxVal);
+    LinkedListParallelCrawler *findCrawler =
+        newLinkedListParallelCrawler(pool, list, sizeof(FindStrAcc), initFindStr, mapFindStr,
+                                     combineFindStr);
+
+    size_t segmentCounts[] = { 0, 1, 2, 3, 7, 64 };
+    for (size_t i = 0; i < sizeof(segmentCounts) / sizeof(segmentCounts[0]); i++) {
+        setLinkedListParallelCrawlerSegments(lenCrawler, segmentCounts[i]);
+        setLinkedListParallelCrawlerSegments(maxCrawler, segmentCounts[i]);
+        setLinkedListParallelCrawlerSegments(findCrawler, segmentCounts[i]);
+
+        size_t len;
+        bool result = startLinkedListParallelCrawler(lenCrawler, NULL, &len);
+        printf("\n%zu segments\n", getLinkedListParallelCrawlerSegments(lenCrawler));
+        printf("length of list strings: %zu (%s), crawler returned: %s\n",
+               len, (len == expectLen) ? "ok" : "wrong", result ? "true" : "false");
+
+        const char *max;
+        startLinkedListParallelCrawler(maxCrawler, NULL, &max);
+        printf("max value: \"%s\" (%s)\n", max, (strcmp(max, expectMax) == 0) ? "ok" : "wrong");
+
+        FindStrAcc find;
+        startLinkedListParallelCrawler(findCrawler, (void*)lookingFor, &find);
+        printf("\"%s\" found %zu times, first at %zu (%s)\n", lookingFor, find.count, find.first,
+               (find.count == expectFind.count && find.first == expectFind.first) ? "ok" : "wrong");
+    }
+
+    printf("\nCrawl again after adding a value\n");
+    addFirstLinkedListVal(list, lookingFor);
+    FindStrAcc find;
+    startLinkedListParallelCrawler(findCrawler, (void*)lookingFor, &find);
+    printf("\"%s\" found %zu times, first at %zu (%s)\n", lookingFor, find.count, find.first,
+           (find.count == expectFind.count + 1 && find.first == 0) ? "ok" : "wrong");
+
+    printf("\nStop at any occurrence\n");
+    LinkedListParallelCrawler *anyCrawler =
+        newLinkedListParallelCrawler(pool, list, sizeof(FindStrAcc), initFindStr, mapAnyStr,
+                                     combineFindStr);
+    bool result = startLinkedListParallelCrawler(anyCrawler, (void*)lookingFor, &find);
+    printf("crawler returned: %s, found: %s\n", result ? "true" : "false",
+           (find.count > 0) ? "true" : "false");
+    deleteLinkedListParallelCrawler(anyCrawler);
+
+    printf("\nEmpty list\n");
+    LinkedList *empty = newLinkedList(SIZE_MAX);
+    LinkedListParallelCrawler *emptyCrawler =
+        newLinkedListParallelCrawler(pool, empty, sizeof(size_t), initStrLen, mapStrLen, combineStrLen);
+    size_t len;
+    result = startLinkedListParallelCrawler(emptyCrawler, NULL, &len);
+    printf("crawler returned: %s, length: %zu, segments: %zu\n", result ? "true" : "false", len,
+           getLinkedListParallelCrawlerSegments(emptyCrawler));
+    deleteLinkedListParallelCrawler(emptyCrawler);
+    deleteLinkedList(empty);
+
+    deleteLinkedListParallelCrawler(lenCrawler);
+    deleteLinkedListParallelCrawler(maxCrawler);
+    deleteLinkedListParallelCrawler(findCrawler);
+    deleteTaskPool(pool);
+    deleteLinkedList(list);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,588 @@
+/**
+ * @file task_pool.c
+ *
+ * Implementation for a fork-join thread pool built on work-stealing
+ * deques.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "task_pool.h"
+#include "wait_event.h"
+#include "work_stealing_deque.h"
+
+/** Initial capacity of each worker deque */
+#define TASK_DEQUE_CAPACITY 256
+
+/** Rounds without work before a worker or outside waiter parks */
+#define TASK_IDLE_SPINS 64
+
+/** Subranges per worker when parallelForTaskPool chooses the grain */
+#define TASK_RANGES_PER_WORKER 8
+
+/** The worker running on this thread, or NULL */
+static _Thread_local TaskWorker *currentWorker = NULL;
+
+/** Creates the default pool once */
+static pthread_once_t defaultPoolOnce = PTHREAD_ONCE_INIT;
+
+/** The default pool, or NULL */
+static TaskPool *defaultPool = NULL;
+
+/**
+ * Wake waiters on an event if there are any. The fence pairs with
+ * the one a waiter issues after beginWaitEvent: either the waiter
+ * sees the change the caller just made, or the caller sees the
+ * waiter and notifies it.
+ *
+ * @param event the wait event
+ * @param all true to wake all waiters, false to wake one
+ */
+static void wakeWaiters(WaitEvent *event, bool all) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&event->waiters, memory_order_relaxed) > 0) {
+        notifyWaitEvent(event, all);
+    }
+}
+
+/**
+ * Run a task and mark it done.
+ *
+ * @param worker the worker running the task
+ * @param task the task
+ */
+static void runTask(TaskWorker *worker, Task *task) {
+    task->fn(task->arg);
+    atomic_fetch_add_explicit(&worker->executed, 1, memory_order_relaxed);
+
+    // the task may be gone once it is marked done: read it first
+    TaskGroup *group = task->group;
+    bool external = task->external;
+    // release: a waiter that sees done sees the task's results
+    if (group != NULL) {
+        atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+    } else {
+        atomic_store_explicit(&task->done, true, memory_order_release);
+    }
+    if (external) {
+        wakeWaiters(&worker->pool->taskDone, true);
+    }
+}
+
+/**
+ * Take the oldest task from the submission queue.
+ *
+ * @param pool the TaskPool
+ * @return the task, or NULL if there is none
+ */
+static Task *takeSubmittedTask(TaskPool *pool) {
+    // skip the lock when the queue is empty
+    if (atomic_load_explicit(&pool->submitted, memory_order_relaxed) == 0) {
+        return NULL;
+    }
+    pthread_mutex_lock(&pool->submitLock);
+    Task *task = pool->submitHead;
+    if (task != NULL) {
+        pool->submitHead = task->next;
+        if (pool->submitHead == NULL) {
+            pool->submitTail = NULL;
+        }
+        atomic_fetch_sub_explicit(&pool->submitted, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&pool->submitLock);
+    return task;
+}
+
+/**
+ * Find a task for a worker: its own newest task, else the oldest
+ * task of a random other worker, else a submitted task.
+ *
+ * @param worker the worker
+ * @return the task, or NULL if none was found
+ */
+static Task *findTask(TaskWorker *worker) {
+    void *item;
+    if (popWorkStealingDeque(worker->deque, &item)) {
+        return item;
+    }
+
+    TaskPool *pool = worker->pool;
+    for (int attempt = 0; attempt < pool->numWorkers; attempt++) {
+        // xorshift64
+        worker->randomState ^= worker->randomState << 13;
+        worker->randomState ^= worker->randomState >> 7;
+        worker->randomState ^= worker->randomState << 17;
+        TaskWorker *victim = &pool->workers[worker->randomState % pool->numWorkers];
+        if (victim != worker && stealWorkStealingDeque(victim->deque, &item)) {
+            atomic_fetch_add_explicit(&worker->steals, 1, memory_order_relaxed);
+            return item;
+        }
+    }
+    return takeSubmittedTask(pool);
+}
+
+/**
+ * Determines whether any deque or the submission queue holds a task.
+ *
+ * @param pool the TaskPool
+ * @return true if a task is waiting to run
+ */
+static bool hasPendingTask(TaskPool *pool) {
+    if (atomic_load(&pool->submitted) > 0) {
+        return true;
+    }
+    for (int w = 0; w < pool->numWorkers; w++) {
+        if (!isWorkStealingDequeEmpty(pool->workers[w].deque)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Park a worker until a task is spawned or the pool stops.
+ *
+ * @param pool the TaskPool
+ */
+static void parkWorker(TaskPool *pool) {
+    unsigned seq = beginWaitEvent(&pool->workAvailable);
+    atomic_thread_fence(memory_order_seq_cst);  // pairs with wakeWaiters
+    // a random steal can miss work: look at every deque before sleeping
+    if (!hasPendingTask(pool) && !atomic_load(&pool->stop)) {
+        awaitWaitEvent(&pool->workAvailable, &seq, NULL);
+    }
+    endWaitEvent(&pool->workAvailable);
+}
+
+/**
+ * Worker thread that runs tasks until the pool stops. A worker
+ * that finds no task for a while parks.
+ *
+ * @param arg the worker
+ * @return NULL
+ */
+static void *workerThread(void *arg) {
+    TaskWorker *worker = arg;
+    TaskPool *pool = worker->pool;
+    currentWorker = worker;
+    int idle = 0;
+    while (!atomic_load_explicit(&pool->stop, memory_order_relaxed)) {
+        Task *task = findTask(worker);
+        if (task != NULL) {
+            runTask(worker, task);
+            idle = 0;
+        } else if (++idle < TASK_IDLE_SPINS) {
+            sched_yield();
+        } else {
+            parkWorker(pool);
+            idle = 0;
+        }
+    }
+    currentWorker = NULL;
+    return NULL;
+}
+
+/**
+ * Wait until a condition holds. A worker of the pool runs other
+ * tasks while it waits; another thread yields for a while and then
+ * parks until a task it spawned is done.
+ *
+ * @param pool the TaskPool
+ * @param isDone the condition
+ * @param arg the argument to the condition
+ */
+static void waitUntil(TaskPool *pool, bool (*isDone)(void *arg), void *arg) {
+    TaskWorker *worker = currentWorker;
+    if (worker != NULL && worker->pool == pool) {
+        while (!isDone(arg)) {
+            Task *other = findTask(worker);
+            if (other != NULL) {
+                runTask(worker, other);
+            } else {
+                sched_yield();
+            }
+        }
+        return;
+    }
+
+    for (int spin = 0; spin < TASK_IDLE_SPINS; spin++) {
+        if (isDone(arg)) {
+            return;
+        }
+        sched_yield();
+    }
+    unsigned seq = beginWaitEvent(&pool->taskDone);
+    atomic_thread_fence(memory_order_seq_cst);  // pairs with wakeWaiters
+    while (!isDone(arg)) {
+        awaitWaitEvent(&pool->taskDone, &seq, NULL);
+    }
+    endWaitEvent(&pool->taskDone);
+}
+
+/**
+ * Determines whether a task is done.
+ *
+ * @param arg the task
+ * @return true if the task is done
+ */
+static bool isTaskDone(void *arg) {
+    Task *task = arg;
+    // acquire: see the results of the task
+    return atomic_load_explicit(&task->done, memory_order_acquire);
+}
+
+/**
+ * Determines whether every task in a group is done.
+ *
+ * @param arg the TaskGroup
+ * @return true if no task in the group is pending
+ */
+static bool isTaskGroupDone(void *arg) {
+    TaskGroup *group = arg;
+    // acquire: see the results of the tasks
+    return atomic_load_explicit(&group->pending, memory_order_acquire) == 0;
+}
+
+/**
+ * Create a task pool and start its workers.
+ *
+ * @param numWorkers the number of worker threads; 0 or less for
+ *   the TASK_POOL_WORKERS environment variable if set, else one
+ *   per online processor
+ * @return the allocated task pool, or NULL if out of memory
+ */
+TaskPool *newTaskPool(int numWorkers) {
+    if (numWorkers <= 0) {
+        const char *env = getenv("TASK_POOL_WORKERS");
+        numWorkers = (env != NULL) ? atoi(env) : 0;
+    }
+    if (numWorkers <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numWorkers = (cpus > 0) ? (int)cpus : 1;
+    }
+
+    TaskPool *pool = malloc(sizeof(TaskPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+    // aligned so workers do not share cache lines
+    pool->workers = aligned_alloc(WS_CACHE_LINE, numWorkers * sizeof(TaskWorker));
+    if (pool->workers == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pool->numWorkers = numWorkers;
+    pthread_mutex_init(&pool->submitLock, NULL);
+    pool->submitHead = NULL;
+    pool->submitTail = NULL;
+    atomic_init(&pool->submitted, 0);
+    atomic_init(&pool->stop, false);
+    initWaitEvent(&pool->workAvailable);
+    initWaitEvent(&pool->taskDone);
+
+    // create all deques before any worker can steal
+    for (int w = 0; w < numWorkers; w++) {
+        TaskWorker *worker = &pool->workers[w];
+        worker->pool = pool;
+        worker->deque = newWorkStealingDeque(TASK_DEQUE_CAPACITY);
+        if (worker->deque == NULL) {
+            // no worker is running yet: free what was created so far
+            while (w > 0) {
+                deleteWorkStealingDeque(pool->workers[--w].deque);
+            }
+            free(pool->workers);
+            pthread_mutex_destroy(&pool->submitLock);
+            destroyWaitEvent(&pool->workAvailable);
+            destroyWaitEvent(&pool->taskDone);
+            free(pool);
+            return NULL;
+        }
+        worker->randomState = 0x9E3779B97F4A7C15u * (w + 1);
+        atomic_init(&worker->executed, 0);
+        atomic_init(&worker->steals, 0);
+    }
+    for (int w = 0; w < numWorkers; w++) {
+        pthread_create(&pool->workers[w].thread, NULL, workerThread, &pool->workers[w]);
+    }
+    return pool;
+}
+
+/**
+ * Create the default pool.
+ */
+static void createDefaultTaskPool(void) {
+    defaultPool = newTaskPool(0);
+}
+
+/**
+ * Returns the shared default pool, creating it with newTaskPool(0)
+ * on first use. The default pool is never deleted.
+ *
+ * @return the default pool, or NULL if out of memory
+ */
+TaskPool *getDefaultTaskPool(void) {
+    pthread_once(&defaultPoolOnce, createDefaultTaskPool);
+    return defaultPool;
+}
+
+/**
+ * Queue an initialized task: on the worker's own deque from a
+ * worker, else on the submission queue. Wakes a parked worker.
+ *
+ * @param pool the TaskPool
+ * @param task the task
+ */
+static void queueTask(TaskPool *pool, Task *task) {
+    TaskWorker *worker = currentWorker;
+    if (!task->external) {
+        if (!pushWorkStealingDeque(worker->deque, task)) {
+            runTask(worker, task);  // deque could not grow: run it now
+            return;
+        }
+        wakeWaiters(&pool->workAvailable, false);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->submitLock);
+    if (pool->submitTail == NULL) {
+        pool->submitHead = task;
+    } else {
+        pool->submitTail->next = task;
+    }
+    pool->submitTail = task;
+    atomic_fetch_add_explicit(&pool->submitted, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&pool->submitLock);
+    wakeWaiters(&pool->workAvailable, false);
+}
+
+/**
+ * Initialize a task for fn(arg).
+ *
+ * @param pool the TaskPool
+ * @param group the group of the task, or NULL
+ * @param task the task
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+static void initTask(TaskPool *pool, TaskGroup *group, Task *task, TaskFn fn, void *arg) {
+    task->fn = fn;
+    task->arg = arg;
+    task->next = NULL;
+    atomic_init(&task->done, false);
+    task->group = group;
+    task->external = currentWorker == NULL || currentWorker->pool != pool;
+}
+
+/**
+ * Spawn a task that runs fn(arg). From a worker the task goes on
+ * the worker's own deque; from another thread it is submitted to
+ * the pool. The task must be waited for with waitTask.
+ *
+ * @param pool the TaskPool
+ * @param task the task; must stay valid until waited for
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void spawnTask(TaskPool *pool, Task *task, TaskFn fn, void *arg) {
+    initTask(pool, NULL, task, fn, arg);
+    queueTask(pool, task);
+}
+
+/**
+ * Wait for a spawned task to finish. A worker runs other tasks
+ * while it waits.
+ *
+ * @param pool the TaskPool
+ * @param task the task
+ */
+void waitTask(TaskPool *pool, Task *task) {
+    waitUntil(pool, isTaskDone, task);
+}
+
+/**
+ * Run fn(arg) in the pool and wait for it to finish. From a worker
+ * fn is called directly.
+ *
+ * @param pool the TaskPool
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void runTaskPool(TaskPool *pool, TaskFn fn, void *arg) {
+    TaskWorker *worker = currentWorker;
+    if (worker != NULL && worker->pool == pool) {
+        fn(arg);
+        return;
+    }
+    Task task;
+    spawnTask(pool, &task, fn, arg);
+    waitTask(pool, &task);
+}
+
+/**
+ * Initialize an empty task group.
+ *
+ * @param group the TaskGroup
+ */
+void initTaskGroup(TaskGroup *group) {
+    atomic_init(&group->pending, 0);
+}
+
+/**
+ * Spawn a task that runs fn(arg) as part of a group. The task is
+ * waited for with waitTaskGroup rather than waitTask.
+ *
+ * @param pool the TaskPool
+ * @param group the TaskGroup
+ * @param task the task; must stay valid until the group is waited for
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void spawnTaskGroup(TaskPool *pool, TaskGroup *group, Task *task, TaskFn fn, void *arg) {
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    initTask(pool, group, task, fn, arg);
+    queueTask(pool, task);
+}
+
+/**
+ * Wait for every task spawned in a group to finish. A worker runs
+ * other tasks while it waits.
+ *
+ * @param pool the TaskPool
+ * @param group the TaskGroup
+ */
+void waitTaskGroup(TaskPool *pool, TaskGroup *group) {
+    waitUntil(pool, isTaskGroupDone, group);
+}
+
+/** Arguments of a parallel loop task */
+typedef struct {
+    /** the pool */
+    TaskPool *pool;
+    /** the first index */
+    size_t begin;
+    /** one past the last index */
+    size_t end;
+    /** the largest subrange run as one call */
+    size_t grain;
+    /** the function to call */
+    RangeFn fn;
+    /** the context passed to fn */
+    void *ctx;
+} RangeArg;
+
+/**
+ * Run a subrange of a parallel loop, forking the upper half until
+ * the subrange is no longer than the grain.
+ *
+ * @param arg the RangeArg
+ */
+static void rangeTask(void *arg) {
+    RangeArg *ra = arg;
+    if (ra->end - ra->begin <= ra->grain) {
+        ra->fn(ra->ctx, ra->begin, ra->end);
+        return;
+    }
+    size_t mid = ra->begin + (ra->end - ra->begin) / 2;
+    RangeArg lower = *ra;
+    lower.end = mid;
+    RangeArg upper = *ra;
+    upper.begin = mid;
+    Task task;
+    spawnTask(ra->pool, &task, rangeTask, &upper);
+    rangeTask(&lower);
+    waitTask(ra->pool, &task);
+}
+
+/**
+ * Call fn(ctx, b, e) on subranges [b, e) that together cover
+ * [begin, end), in parallel, and wait for all of them. The range is
+ * split in halves until a piece is no longer than grain.
+ *
+ * @param pool the TaskPool
+ * @param begin the first index
+ * @param end one past the last index
+ * @param grain the largest subrange run as one call; 0 to choose
+ *   one from the range size and number of workers
+ * @param fn the function to call on each subrange
+ * @param ctx the context passed to fn
+ */
+void parallelForTaskPool(TaskPool *pool, size_t begin, size_t end, size_t grain,
+                         RangeFn fn, void *ctx) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        grain = (end - begin) / ((size_t)pool->numWorkers * TASK_RANGES_PER_WORKER);
+        if (grain == 0) {
+            grain = 1;
+        }
+    }
+    RangeArg ra = { pool, begin, end, grain, fn, ctx };
+    runTaskPool(pool, rangeTask, &ra);
+}
+
+/**
+ * Returns the number of workers in the pool.
+ *
+ * @param pool the TaskPool
+ * @return the number of workers
+ */
+int taskPoolWorkers(TaskPool *pool) {
+    return pool->numWorkers;
+}
+
+/**
+ * Get the total number of tasks run and stolen by the workers.
+ *
+ * @param pool the TaskPool
+ * @param executed result parameter for the number of tasks run
+ * @param steals result parameter for the number of tasks stolen
+ */
+void getTaskPoolStats(TaskPool *pool, size_t *executed, size_t *steals) {
+    *executed = 0;
+    *steals = 0;
+    for (int w = 0; w < pool->numWorkers; w++) {
+        *executed += atomic_load_explicit(&pool->workers[w].executed, memory_order_relaxed);
+        *steals += atomic_load_explicit(&pool->workers[w].steals, memory_order_relaxed);
+    }
+}
+
+/**
+ * Get the number of workers parked waiting for work.
+ *
+ * @param pool the TaskPool
+ * @return the number of parked workers
+ */
+int parkedTaskPoolWorkers(TaskPool *pool) {
+    return (int)atomic_load(&pool->workAvailable.waiters);
+}
+
+/**
+ * Stop the workers and delete the pool. No tasks may be pending.
+ *
+ * @param pool the TaskPool
+ */
+void deleteTaskPool(TaskPool *pool) {
+    atomic_store(&pool->stop, true);
+    notifyWaitEvent(&pool->workAvailable, true);
+    for (int w = 0; w < pool->numWorkers; w++) {
+        pthread_join(pool->workers[w].thread, NULL);
+    }
+    for (int w = 0; w < pool->numWorkers; w++) {
+        deleteWorkStealingDeque(pool->workers[w].deque);
+    }
+    free(pool->workers);
+    pthread_mutex_destroy(&pool->submitLock);
+    destroyWaitEvent(&pool->workAvailable);
+    destroyWaitEvent(&pool->taskDone);
+
+    // free the pool itself
+    free(pool);
+}
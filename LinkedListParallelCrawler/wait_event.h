@@ -0,0 +1,104 @@
+/**
+ * @file wait_event.h
+ *
+ * Declarations for a wait event that threads sleep on until another
+ * thread changes some state and notifies them.
+ *
+ * A waiter registers with beginWaitEvent, which returns the current
+ * event sequence, then checks its condition and, if the condition
+ * does not hold, sleeps in awaitWaitEvent until the sequence moves
+ * on. A notifier changes the state and calls notifyWaitEvent, which
+ * bumps the sequence and makes a wake-up system call only if some
+ * thread is registered, so notifying with no waiters is two atomic
+ * operations. On Linux the sequence is a futex word; elsewhere a
+ * mutex and condition variable stand in for the futex.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef WAIT_EVENT_H_
+#define WAIT_EVENT_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <time.h>
+#ifndef __linux__
+#include <pthread.h>
+#endif
+
+/** Wait event data structure */
+typedef struct {
+    /** Sequence bumped by every notify; the futex word */
+    atomic_uint seq;
+    /** Number of threads between begin and end of a wait */
+    atomic_uint waiters;
+#ifndef __linux__
+    /** Protects the condition variable wait */
+    pthread_mutex_t lock;
+    /** Signalled by notify */
+    pthread_cond_t cond;
+#endif
+} WaitEvent;
+
+/**
+ * Initialize a wait event.
+ *
+ * @param event the wait event
+ */
+void initWaitEvent(WaitEvent *event);
+
+/**
+ * Destroy a wait event. No thread may be waiting.
+ *
+ * @param event the wait event
+ */
+void destroyWaitEvent(WaitEvent *event);
+
+/**
+ * Register the calling thread as a waiter. Must be called before the
+ * thread checks its condition, and be followed by endWaitEvent.
+ *
+ * @param event the wait event
+ * @return the sequence to pass to awaitWaitEvent
+ */
+unsigned beginWaitEvent(WaitEvent *event);
+
+/**
+ * Sleep until the event is notified after seq was read, or until
+ * the deadline passes. May return early spuriously. The caller
+ * must check its condition again after this returns.
+ *
+ * @param event the wait event
+ * @param seq the sequence returned by beginWaitEvent; updated to
+ *   the current sequence on return
+ * @param deadline the CLOCK_MONOTONIC deadline, or NULL for none
+ * @return false if the deadline has passed
+ */
+bool awaitWaitEvent(WaitEvent *event, unsigned *seq, const struct timespec *deadline);
+
+/**
+ * Unregister the calling thread as a waiter.
+ *
+ * @param event the wait event
+ */
+void endWaitEvent(WaitEvent *event);
+
+/**
+ * Notify waiters that the state changed. Makes no system call if
+ * no thread is waiting.
+ *
+ * @param event the wait event
+ * @param all true to wake all waiters, false to wake one
+ */
+void notifyWaitEvent(WaitEvent *event, bool all);
+
+/**
+ * Compute the CLOCK_MONOTONIC deadline for a timeout.
+ *
+ * @param timeoutMillis the timeout in milliseconds
+ * @param deadline result parameter for the deadline
+ */
+void waitEventDeadline(long timeoutMillis, struct timespec *deadline);
+
+#endif /* WAIT_EVENT_H_ */
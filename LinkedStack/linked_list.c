@@ -152,6 +152,202 @@ bool setLastLinkedListVal(LinkedList *list, const char *val) {
 	return setLinkedListValAt(list, list->size-1, val);
 }
 
+/**
+ * Exchange the values at two indexes without copying them.
+ *
+ * @param list the LinkedList
+ * @param index1 the first index
+ * @param index2 the second index
+ * @return false if either index is out of bounds
+ */
+bool swapLinkedListValsAt(LinkedList *list, size_t index1, size_t index2) {
+	if (index1 >= list->size || index2 >= list->size) {
+		return false;
+	}
+	// skip the dummy node
+	LinkedNode *node1 = getLinkedNodeAt(list->head, index1+1);
+	LinkedNode *node2 = getLinkedNodeAt(list->head, index2+1);
+	char *data = node1->data;
+	node1->data = node2->data;
+	node2->data = data;
+	return true;
+}
+
+/**
+ * Move the value at one index to another by relinking its node,
+ * so the values in between shift by one place.
+ *
+ * @param list the LinkedList
+ * @param from the index of the value to move
+ * @param to the index the value moves to
+ * @return false if either index is out of bounds
+ */
+bool rotateLinkedListVals(LinkedList *list, size_t from, size_t to) {
+	if (from >= list->size || to >= list->size) {
+		return false;
+	}
+	// unlink the node, then link it after the node before index to
+	LinkedNode *node = deleteAfterLinkedNode(getLinkedNodeAt(list->head, from));
+	addAfterLinkedNode(getLinkedNodeAt(list->head, to), node);
+	return true;
+}
+
+/**
+ * Add copies of values to the list at index. All nodes are created
+ * before any is linked in, and the chain is spliced in once.
+ *
+ * @param list the LinkedList
+ * @param index the index for the first new value
+ * @param vals the values to insert; values will be copied to store,
+ *   and cannot be null
+ * @param count the number of values
+ * @param reversed true to insert the values in reverse order
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+static bool addLinkedListChainAt(LinkedList *list, size_t index, const char *const vals[],
+								 size_t count, bool reversed) {
+	if (count > list->maxCapacity - list->size) {
+		return false;
+	}
+	// find node to insert after
+	LinkedNode *node = getLinkedNodeAt(list->head, index);
+	if (node == NULL) {
+		return false;
+	}
+	if (count == 0) {
+		return true;
+	}
+
+	// build the new chain first so the list is unchanged on failure
+	LinkedNode *first = NULL, *last = NULL;
+	for (size_t i = 0; i < count; i++) {
+		LinkedNode *newNode = newLinkedNode(vals[i]);
+		if (newNode == NULL || newNode->data == NULL) {
+			deleteLinkedNode(newNode);  // ignores NULL
+			if (first != NULL) {
+				deleteAllLinkedNodes(first);
+			}
+			return false;
+		}
+		if (reversed) {
+			// link each node ahead of the ones before it
+			newNode->next = first;
+			first = newNode;
+			if (last == NULL) {
+				last = newNode;
+			}
+		} else {
+			if (last == NULL) {
+				first = newNode;
+			} else {
+				last->next = newNode;
+			}
+			last = newNode;
+		}
+	}
+
+	// splice the chain in after node
+	last->next = node->next;
+	node->next = first;
+	list->size += count;
+	return true;
+}
+
+/**
+ * Add copies of values to the list at index. All nodes are created
+ * before any is linked in, and the chain is spliced in once.
+ *
+ * @param list the LinkedList
+ * @param index the index for the first new value
+ * @param vals the values to insert, in list order; values will be
+ *   copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addLinkedListValsAt(LinkedList *list, size_t index, const char *const vals[], size_t count) {
+	return addLinkedListChainAt(list, index, vals, count, false);
+}
+
+/**
+ * Add copies of values to the list at index in reverse order, so
+ * vals[count-1] ends at index. Like addLinkedListValsAt, the chain
+ * is built first and spliced in once.
+ *
+ * @param list the LinkedList
+ * @param index the index for the last new value
+ * @param vals the values to insert, in reverse list order; values
+ *   will be copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addLinkedListValsReversedAt(LinkedList *list, size_t index, const char *const vals[],
+								 size_t count) {
+	return addLinkedListChainAt(list, index, vals, count, true);
+}
+
+/**
+ * Remove values from the list at index without copying them. The
+ * caller owns the values.
+ *
+ * @param list the LinkedList
+ * @param index the index of the first value to remove
+ * @param vals result parameter for the values, in list order;
+ *   returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index;
+ *   the list is then unchanged
+ */
+bool removeLinkedListValsAt(LinkedList *list, size_t index, char *vals[], size_t count) {
+	if (index > list->size || count > list->size - index) {
+		return false;
+	}
+	// node before the first one to remove
+	LinkedNode *node = getLinkedNodeAt(list->head, index);
+	for (size_t i = 0; i < count; i++) {
+		LinkedNode *deleted = deleteAfterLinkedNode(node);
+		vals[i] = deleted->data;  // caller now owns the string
+		deleted->data = NULL;
+		deleteLinkedNode(deleted);
+	}
+	list->size -= count;
+	return true;
+}
+
+/**
+ * Reverse the order of values in a range by relinking the nodes.
+ *
+ * @param list the LinkedList
+ * @param index the index of the first value
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index
+ */
+bool reverseLinkedListVals(LinkedList *list, size_t index, size_t count) {
+	if (index > list->size || count > list->size - index) {
+		return false;
+	}
+	if (count < 2) {
+		return true;
+	}
+	// node before the range
+	LinkedNode *before = getLinkedNodeAt(list->head, index);
+	LinkedNode *first = before->next;
+	LinkedNode *reversed = NULL;
+	LinkedNode *node = first;
+	for (size_t i = 0; i < count; i++) {
+		LinkedNode *next = node->next;
+		node->next = reversed;
+		reversed = node;
+		node = next;
+	}
+	// first is now last in the range; node follows the range
+	first->next = node;
+	before->next = reversed;
+	return true;
+}
+
 /**
  * Returns number of items in the linked list.
  * @param list the LinkedList
@@ -117,6 +117,81 @@ bool setFirstLinkedListVal(LinkedList *list, const char *val);
  */
 bool setLastLinkedListVal(LinkedList *list, const char *val);
 
+/**
+ * Exchange the values at two indexes without copying them.
+ *
+ * @param list the LinkedList
+ * @param index1 the first index
+ * @param index2 the second index
+ * @return false if either index is out of bounds
+ */
+bool swapLinkedListValsAt(LinkedList *list, size_t index1, size_t index2);
+
+/**
+ * Move the value at one index to another by relinking its node,
+ * so the values in between shift by one place.
+ *
+ * @param list the LinkedList
+ * @param from the index of the value to move
+ * @param to the index the value moves to
+ * @return false if either index is out of bounds
+ */
+bool rotateLinkedListVals(LinkedList *list, size_t from, size_t to);
+
+/**
+ * Add copies of values to the list at index. All nodes are created
+ * before any is linked in, and the chain is spliced in once.
+ *
+ * @param list the LinkedList
+ * @param index the index for the first new value
+ * @param vals the values to insert, in list order; values will be
+ *   copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addLinkedListValsAt(LinkedList *list, size_t index, const char *const vals[], size_t count);
+
+/**
+ * Add copies of values to the list at index in reverse order, so
+ * vals[count-1] ends at index. Like addLinkedListValsAt, the chain
+ * is built first and spliced in once.
+ *
+ * @param list the LinkedList
+ * @param index the index for the last new value
+ * @param vals the values to insert, in reverse list order; values
+ *   will be copied to store, and cannot be null
+ * @param count the number of values
+ * @return false if index out of bounds, the values would exceed
+ *   max capacity, or out of memory; the list is then unchanged
+ */
+bool addLinkedListValsReversedAt(LinkedList *list, size_t index, const char *const vals[],
+								 size_t count);
+
+/**
+ * Remove values from the list at index without copying them. The
+ * caller owns the values.
+ *
+ * @param list the LinkedList
+ * @param index the index of the first value to remove
+ * @param vals result parameter for the values, in list order;
+ *   returned values must be freed
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index;
+ *   the list is then unchanged
+ */
+bool removeLinkedListValsAt(LinkedList *list, size_t index, char *vals[], size_t count);
+
+/**
+ * Reverse the order of values in a range by relinking the nodes.
+ *
+ * @param list the LinkedList
+ * @param index the index of the first value
+ * @param count the number of values
+ * @return false if the list has fewer than count values from index
+ */
+bool reverseLinkedListVals(LinkedList *list, size_t index, size_t count);
+
 /**
  * Returns number of items in the linked list.
  * @param list the LinkedList
@@ -56,6 +56,22 @@ bool pushLinkedStackVal(LinkedStack *stack, const char *val) {
 	return addFirstLinkedListVal(stack->list, val);
 }
 
+/**
+ * Push values onto the stack with one capacity check and one
+ * splice. Equivalent to pushing each value in turn, so vals[n-1]
+ * ends on top.
+ * @param stack the LinkedStack
+ * @param vals the values to push; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     stack is then unchanged
+ */
+bool pushNLinkedStackVals(LinkedStack *stack, const char *const vals[], size_t n) {
+	// top is first, so the last value pushed goes first
+	return addLinkedListValsReversedAt(stack->list, 0, vals, n);
+}
+
 /**
  * Get the top stack value without removing it.
  * @param stack the LinkedStack
@@ -95,6 +111,20 @@ bool popLinkedStackVal(LinkedStack *stack, const char **val) {
 	return false;
 }
 
+/**
+ * Deletes and returns the top n values without copying them.
+ * Equivalent to popping n times, so vals[0] is the old top.
+ * @param stack the linked stack
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if stack has fewer than n values; the stack is
+ *   then unchanged
+ */
+bool popNLinkedStackVals(LinkedStack *stack, char *vals[], size_t n) {
+	return removeLinkedListValsAt(stack->list, 0, vals, n);
+}
+
 /**
  * Exchange the top two stack values.
  * @param stack the LinkedStack
@@ -102,21 +132,7 @@ bool popLinkedStackVal(LinkedStack *stack, const char **val) {
  *   operation is not supported
  */
 bool swapLinkedStackVal(LinkedStack *stack) {
-	size_t size = linkedListSize(stack->list);
-	if (size >= 2) {
-		// portable but not as efficient
-		const char *val1, *val2;
-		popLinkedStackVal(stack, &val1);
-		popLinkedStackVal(stack,&val2);
-		pushLinkedStackVal(stack, val1);
-		pushLinkedStackVal(stack, val2);
-
-		// must free because pop returns allocated storage
-		free((char*)val1);
-		free((char*)val2);
-		return true;
-	}
-	return false;
+	return swapLinkedListValsAt(stack->list, 0, 1);
 }
 
 /**
@@ -132,6 +148,77 @@ bool dupLinkedStackVal(LinkedStack *stack) {
 	return false;
 }
 
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the LinkedStack
+ * @return false if the stack does not have three values
+ */
+bool rotLinkedStackVal(LinkedStack *stack) {
+	return rollLinkedStackVal(stack, 2);
+}
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overLinkedStackVal(LinkedStack *stack) {
+	return pickLinkedStackVal(stack, 1);
+}
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup and
+ * pick 1 is over. Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickLinkedStackVal(LinkedStack *stack, size_t n) {
+	const char *val;
+	if (getLinkedListValAt(stack->list, n, &val)) {
+		return pushLinkedStackVal(stack, val);
+	}
+	return false;
+}
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param stack the LinkedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollLinkedStackVal(LinkedStack *stack, size_t n) {
+	return rotateLinkedListVals(stack->list, n, 0);
+}
+
+/**
+ * Deletes the second stack value: (a b -- b).
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values
+ */
+bool nipLinkedStackVal(LinkedStack *stack) {
+	return deleteLinkedListValAt(stack->list, 1);
+}
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b). Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckLinkedStackVal(LinkedStack *stack) {
+	const char *val;
+	if (linkedListSize(stack->list) >= 2 && peekLinkedStackVal(stack, &val)) {
+		return addLinkedListValAt(stack->list, 2, val);
+	}
+	return false;
+}
+
 /**
  * Deletes top value from the stack.
  * @param stack the LinkedStack
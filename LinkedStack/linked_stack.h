@@ -37,6 +37,19 @@ LinkedStack *newLinkedStack(size_t maxCapacity);
  */
 bool pushLinkedStackVal(LinkedStack *stack, const char *val);
 
+/**
+ * Push values onto the stack with one capacity check and one
+ * splice. Equivalent to pushing each value in turn, so vals[n-1]
+ * ends on top.
+ * @param stack the LinkedStack
+ * @param vals the values to push; values will be copied to store,
+ *     and cannot be null
+ * @param n the number of values
+ * @return false if exceeds max capacity or out of memory; the
+ *     stack is then unchanged
+ */
+bool pushNLinkedStackVals(LinkedStack *stack, const char *const vals[], size_t n);
+
 /**
  * Get the top stack value without removing it.
  * @param stack the LinkedStack
@@ -63,6 +76,18 @@ bool pokeLinkedStackVal(LinkedStack *stack, const char *val);
  */
 bool popLinkedStackVal(LinkedStack *stack, const char **val);
 
+/**
+ * Deletes and returns the top n values without copying them.
+ * Equivalent to popping n times, so vals[0] is the old top.
+ * @param stack the linked stack
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param n the number of values
+ * @return false if stack has fewer than n values; the stack is
+ *   then unchanged
+ */
+bool popNLinkedStackVals(LinkedStack *stack, char *vals[], size_t n);
+
 /**
  * Exchange the top two stack values.
  * @param stack the LinkedStack
@@ -78,6 +103,57 @@ bool swapLinkedStackVal(LinkedStack *stack);
  */
 bool dupLinkedStackVal(LinkedStack *stack);
 
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the LinkedStack
+ * @return false if the stack does not have three values
+ */
+bool rotLinkedStackVal(LinkedStack *stack);
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overLinkedStackVal(LinkedStack *stack);
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup and
+ * pick 1 is over. Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickLinkedStackVal(LinkedStack *stack, size_t n);
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param stack the LinkedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollLinkedStackVal(LinkedStack *stack, size_t n);
+
+/**
+ * Deletes the second stack value: (a b -- b).
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values
+ */
+bool nipLinkedStackVal(LinkedStack *stack);
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b). Only the new value is allocated.
+ * @param stack the LinkedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckLinkedStackVal(LinkedStack *stack);
+
 /**
  * Deletes top value from the stack.
  * @param stack the LinkedStack
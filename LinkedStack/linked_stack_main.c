@@ -77,6 +77,62 @@ int main(void) {
 		printf("\ncannot dup value\n");
 	}
 
+	status = rotLinkedStackVal(stack);
+	if (status) {
+		printf("\nrotated third to top\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot rotate\n");
+	}
+
+	status = rollLinkedStackVal(stack, 4);
+	if (status) {
+		printf("\nrolled value 4 below top to top\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot roll 4\n");
+	}
+
+	status = nipLinkedStackVal(stack);
+	if (status) {
+		printf("\nnipped second value\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot nip\n");
+	}
+
+	status = nipLinkedStackVal(stack);
+	if (status) {
+		printf("\nnipped second value\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot nip\n");
+	}
+
+	status = pickLinkedStackVal(stack, 2);
+	if (status) {
+		printf("\npicked value 2 below top\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot pick 2\n");
+	}
+
+	status = tuckLinkedStackVal(stack);
+	if (status) {
+		printf("\ntucked top below second\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot tuck\n");
+	}
+
+	status = overLinkedStackVal(stack);
+	if (status) {
+		printf("\nover value\n");
+		printLinkedStack(stack);
+	} else {
+		printf("\ncannot over at max capacity\n");
+	}
+
 	empty = isLinkedStackEmpty(stack);
 	printf("\nstack empty? %s\n", empty ? "true" : "false");
 	size = linkedStackSize(stack);
@@ -90,6 +146,25 @@ int main(void) {
 	printf("stack size: %ld\n", size);
 	printLinkedStack(stack);
 
+	const char *batch[] = { "a", "b", "c", "d" };
+	status = pushNLinkedStackVals(stack, batch, 4);
+	printf("\npush 4 values: %s\n", status ? "true" : "false");
+	printLinkedStack(stack);
+	status = pushNLinkedStackVals(stack, batch, 2);
+	printf("push 2 more past max capacity: %s\n", status ? "true" : "false");
+	char *popped[4];
+	status = popNLinkedStackVals(stack, popped, 3);
+	if (status) {
+		printf("pop 3 values: %s %s %s\n", popped[0], popped[1], popped[2]);
+		for (int i = 0; i < 3; i++) {
+			free(popped[i]);
+		}
+	}
+	printLinkedStack(stack);
+	status = popNLinkedStackVals(stack, popped, 2);
+	printf("pop 2 of 1 value: %s\n", status ? "true" : "false");
+	dropAllLinkedStackVals(stack);
+
 	printf("\ndeleting linked stack\n");
 	deleteLinkedStack(stack);
 
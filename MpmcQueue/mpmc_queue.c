@@ -0,0 +1,275 @@
+/**
+ * @file mpmc_queue.c
+ *
+ * Implementation for a bounded lock-free multi-producer,
+ * multi-consumer queue.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpmc_queue.h"
+
+/** Number of spins before a waiting thread starts yielding */
+#define MPMC_SPIN_LIMIT 64
+
+/**
+ * Create an MPMC queue.
+ *
+ * @param capacity the minimum capacity of the queue; rounded
+ *   up to a power of 2 and at least 2
+ * @return the allocated queue, or NULL if out of memory
+ */
+MpmcQueue *newMpmcQueue(size_t capacity) {
+    // round up to a power of 2 so positions wrap with a mask;
+    // a full cell and a free cell need distinct sequences, so at least 2
+    size_t ringCapacity = 2;
+    while (ringCapacity < capacity) {
+        ringCapacity *= 2;
+    }
+
+    // aligned so the two positions are on their own cache lines
+    MpmcQueue *queue = aligned_alloc(MPMC_CACHE_LINE, sizeof(MpmcQueue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->cells = malloc(ringCapacity * sizeof(MpmcCell));
+    if (queue->cells == NULL) {
+        free(queue);
+        return NULL;
+    }
+    queue->capacity = ringCapacity;
+    for (size_t i = 0; i < ringCapacity; i++) {
+        atomic_init(&queue->cells[i].sequence, i);  // free for position i
+        queue->cells[i].val = NULL;
+    }
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+
+    return queue;
+}
+
+/**
+ * Wait a little before retrying: spin at first, then yield.
+ *
+ * @param spins the number of times this thread has waited
+ */
+static void backoff(unsigned spins) {
+    if (spins < MPMC_SPIN_LIMIT) {
+        for (unsigned i = 0; i < (1u << (spins / 8)); i++) {
+            atomic_signal_fence(memory_order_seq_cst);  // keep the loop
+        }
+    } else {
+        sched_yield();
+    }
+}
+
+/**
+ * Store a copy of a value in the next free cell.
+ *
+ * @param queue the MpmcQueue
+ * @param copy the copy to store
+ * @return false if the queue is full
+ */
+static bool tryEnqueueCopy(MpmcQueue *queue, char *copy) {
+    size_t mask = queue->capacity - 1;
+    size_t pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    for (;;) {
+        MpmcCell *cell = &queue->cells[pos & mask];
+        // acquire: the consumer that freed the cell is done with it
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            // cell is free for this position; try to claim it
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                cell->val = copy;
+                // release: publish the value to consumers
+                atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+                return true;
+            }
+            // failed CAS reloaded pos
+        } else if (diff < 0) {
+            // cell still holds the value from one lap ago
+            return false;
+        } else {
+            // another producer claimed pos; catch up
+            pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Enqueue value onto the queue if there is room.
+ *
+ * @param queue the MpmcQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full or out of memory
+ */
+bool tryEnqueueMpmcQueueVal(MpmcQueue *queue, const char *val) {
+    // copy before claiming a cell so consumers never wait on strdup
+    char *copy = strdup(val);
+    if (copy == NULL) {
+        return false;
+    }
+    if (!tryEnqueueCopy(queue, copy)) {
+        free(copy);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Enqueue value onto the queue, waiting while the queue is full.
+ *
+ * @param queue the MpmcQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if out of memory
+ */
+bool enqueueMpmcQueueVal(MpmcQueue *queue, const char *val) {
+    char *copy = strdup(val);  // must copy input string
+    if (copy == NULL) {
+        return false;
+    }
+    for (unsigned spins = 0; !tryEnqueueCopy(queue, copy); spins++) {
+        backoff(spins);
+    }
+    return true;
+}
+
+/**
+ * Dequeue the head queue value if there is one.
+ *
+ * @param queue the MpmcQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool tryDequeueMpmcQueueVal(MpmcQueue *queue, char **val) {
+    size_t mask = queue->capacity - 1;
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    for (;;) {
+        MpmcCell *cell = &queue->cells[pos & mask];
+        // acquire: the producer that filled the cell has written val
+        size_t seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            // cell is full for this position; try to claim it
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                // ownership of the string passes to the caller
+                *val = cell->val;
+                cell->val = NULL;
+                // release: free the cell for the producer one lap ahead
+                atomic_store_explicit(&cell->sequence, pos + mask + 1, memory_order_release);
+                return true;
+            }
+            // failed CAS reloaded pos
+        } else if (diff < 0) {
+            // cell not yet filled for this position
+            return false;
+        } else {
+            // another consumer claimed pos; catch up
+            pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Dequeue the head queue value, waiting while the queue is empty.
+ *
+ * @param queue the MpmcQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ */
+void dequeueMpmcQueueVal(MpmcQueue *queue, char **val) {
+    for (unsigned spins = 0; !tryDequeueMpmcQueueVal(queue, val); spins++) {
+        backoff(spins);
+    }
+}
+
+/**
+ * Returns number of items in the queue. The result may be out of
+ * date if other threads are changing the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return the number of items in the queue
+ */
+size_t mpmcQueueSize(MpmcQueue *queue) {
+    size_t dequeuePos = atomic_load(&queue->dequeuePos);
+    size_t enqueuePos = atomic_load(&queue->enqueuePos);
+    // positions count claims, so clamp to what the ring can hold
+    size_t size = enqueuePos - dequeuePos;
+    if ((intptr_t)size < 0) {
+        return 0;
+    }
+    return (size > queue->capacity) ? queue->capacity : size;
+}
+
+/**
+ * Returns the capacity of the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return the capacity
+ */
+size_t mpmcQueueCapacity(MpmcQueue *queue) {
+    return queue->capacity;
+}
+
+/**
+ * Determines whether queue is empty. The result may be out of
+ * date if other threads are changing the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return true if queue is empty, false otherwise
+ */
+bool isMpmcQueueEmpty(MpmcQueue *queue) {
+    return mpmcQueueSize(queue) == 0;
+}
+
+/**
+ * Delete the queue. Frees copies of all strings, then the ring,
+ * and finally the queue itself. No thread may be using the queue.
+ *
+ * @param queue the MpmcQueue
+ */
+void deleteMpmcQueue(MpmcQueue *queue) {
+    // free the strings in the ring
+    for (size_t i = 0; i < queue->capacity; i++) {
+        free(queue->cells[i].val);  // free ok with NULL
+    }
+    free(queue->cells);
+
+    // set fields to safe values
+    queue->cells = NULL;
+    queue->capacity = 0;
+
+    // free the queue itself
+    free(queue);
+}
+
+/**
+ * Print queue for diagnostic purposes. No thread may be
+ * changing the queue.
+ *
+ * @param queue the MpmcQueue
+ */
+void printMpmcQueue(MpmcQueue *queue) {
+    size_t pos = atomic_load(&queue->dequeuePos);
+    size_t end = atomic_load(&queue->enqueuePos);
+    printf("( ");
+    for (; pos != end; pos++) {
+        printf("\"%s\" ", queue->cells[pos & (queue->capacity - 1)].val);
+    }
+    printf(")\n");
+}
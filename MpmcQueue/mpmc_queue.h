@@ -0,0 +1,143 @@
+/**
+ * @file mpmc_queue.h
+ *
+ * Declarations for a bounded lock-free multi-producer,
+ * multi-consumer queue.
+ *
+ * The queue is a ring of cells with a power-of-two capacity, after
+ * Dmitry Vyukov's bounded MPMC queue. Each cell carries a sequence
+ * number that tells whether it is ready to be written for a given
+ * enqueue position or ready to be read for a given dequeue position.
+ * A producer claims a position with a compare-and-swap on the
+ * enqueue index, writes the cell, and publishes it by a release
+ * store of the cell sequence; consumers do the same on the dequeue
+ * index. Threads contend only on the index they use and on the
+ * cell they claimed, never on a lock.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef MPMC_QUEUE_H_
+#define MPMC_QUEUE_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Size of a cache line */
+#define MPMC_CACHE_LINE 64
+
+/** MPMC queue cell */
+typedef struct {
+    /** Sequence number: position when free, position + 1 when full */
+    atomic_size_t sequence;
+    /** The value */
+    char *val;
+} MpmcCell;
+
+/** MPMC queue data structure */
+typedef struct {
+    /** Capacity of the ring; a power of 2 */
+    _Alignas(MPMC_CACHE_LINE) size_t capacity;
+    /** Ring storage */
+    MpmcCell *cells;
+
+    /** Position of the next enqueue; claimed by producers */
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t enqueuePos;
+
+    /** Position of the next dequeue; claimed by consumers */
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t dequeuePos;
+} MpmcQueue;
+
+/**
+ * Create an MPMC queue.
+ *
+ * @param capacity the minimum capacity of the queue; rounded
+ *   up to a power of 2 and at least 2
+ * @return the allocated queue, or NULL if out of memory
+ */
+MpmcQueue *newMpmcQueue(size_t capacity);
+
+/**
+ * Enqueue value onto the queue if there is room.
+ *
+ * @param queue the MpmcQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full or out of memory
+ */
+bool tryEnqueueMpmcQueueVal(MpmcQueue *queue, const char *val);
+
+/**
+ * Enqueue value onto the queue, waiting while the queue is full.
+ *
+ * @param queue the MpmcQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if out of memory
+ */
+bool enqueueMpmcQueueVal(MpmcQueue *queue, const char *val);
+
+/**
+ * Dequeue the head queue value if there is one.
+ *
+ * @param queue the MpmcQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool tryDequeueMpmcQueueVal(MpmcQueue *queue, char **val);
+
+/**
+ * Dequeue the head queue value, waiting while the queue is empty.
+ *
+ * @param queue the MpmcQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ */
+void dequeueMpmcQueueVal(MpmcQueue *queue, char **val);
+
+/**
+ * Returns number of items in the queue. The result may be out of
+ * date if other threads are changing the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return the number of items in the queue
+ */
+size_t mpmcQueueSize(MpmcQueue *queue);
+
+/**
+ * Returns the capacity of the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return the capacity
+ */
+size_t mpmcQueueCapacity(MpmcQueue *queue);
+
+/**
+ * Determines whether queue is empty. The result may be out of
+ * date if other threads are changing the queue.
+ *
+ * @param queue the MpmcQueue
+ * @return true if queue is empty, false otherwise
+ */
+bool isMpmcQueueEmpty(MpmcQueue *queue);
+
+/**
+ * Delete the queue. Frees copies of all strings, then the ring,
+ * and finally the queue itself. No thread may be using the queue.
+ *
+ * @param queue the MpmcQueue
+ */
+void deleteMpmcQueue(MpmcQueue *queue);
+
+/**
+ * Print queue for diagnostic purposes. No thread may be
+ * changing the queue.
+ *
+ * @param queue the MpmcQueue
+ */
+void printMpmcQueue(MpmcQueue *queue);
+
+#endif /* MPMC_QUEUE_H_ */
@@ -0,0 +1,157 @@
+/*
+ * @file mpmc_queue_bench.c
+ *
+ * Benchmark of queue throughput with many threads, comparing the
+ * lock-free MpmcQueue with an ArrayQueue behind a global mutex.
+ * Each thread enqueues a value and then dequeues one, over and
+ * over, so every thread is both a producer and a consumer and the
+ * queue never holds more values than there are threads.
+ *
+ * Usage: mpmc_queue_bench [millis [maxThreads [capacity]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "array_queue.h"
+#include "mpmc_queue.h"
+
+/** State shared by the benchmark threads */
+typedef struct {
+    /** the lock-free queue, or NULL to use arrayQueue */
+    MpmcQueue *mpmcQueue;
+    /** the mutex-wrapped queue */
+    ArrayQueue *arrayQueue;
+    /** set to stop the threads */
+    atomic_bool stop;
+    /** total enqueues and dequeues by all threads */
+    atomic_size_t ops;
+} BenchState;
+
+/** The global mutex used by the baseline */
+static pthread_mutex_t globalLock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Enqueue onto the ArrayQueue under the global mutex.
+ *
+ * @param queue the ArrayQueue
+ * @param val the value to insert
+ * @return false if the queue is full
+ */
+static bool lockedEnqueue(ArrayQueue *queue, const char *val) {
+    pthread_mutex_lock(&globalLock);
+    bool ok = enqueueArrayQueueVal(queue, val);
+    pthread_mutex_unlock(&globalLock);
+    return ok;
+}
+
+/**
+ * Dequeue from the ArrayQueue under the global mutex.
+ *
+ * @param queue the ArrayQueue
+ * @param val result parameter for the value
+ * @return false if the queue is empty
+ */
+static bool lockedDequeue(ArrayQueue *queue, char **val) {
+    pthread_mutex_lock(&globalLock);
+    bool ok = dequeueArrayQueueVal(queue, val);
+    pthread_mutex_unlock(&globalLock);
+    return ok;
+}
+
+/**
+ * Benchmark thread that enqueues and dequeues until stopped.
+ *
+ * @param arg the benchmark state
+ * @return NULL
+ */
+static void *benchThread(void *arg) {
+    BenchState *bs = arg;
+    size_t ops = 0;
+    char *val;
+    while (!atomic_load_explicit(&bs->stop, memory_order_relaxed)) {
+        if (bs->mpmcQueue != NULL) {
+            enqueueMpmcQueueVal(bs->mpmcQueue, "value");
+            dequeueMpmcQueueVal(bs->mpmcQueue, &val);
+        } else {
+            while (!lockedEnqueue(bs->arrayQueue, "value")) {
+                sched_yield();
+            }
+            while (!lockedDequeue(bs->arrayQueue, &val)) {
+                sched_yield();
+            }
+        }
+        free(val);
+        ops += 2;
+    }
+    atomic_fetch_add(&bs->ops, ops);
+    return NULL;
+}
+
+/**
+ * Run threads for a time and report throughput.
+ *
+ * @param useMutex true to use the mutex-wrapped ArrayQueue
+ * @param numThreads the number of threads
+ * @param capacity the queue capacity
+ * @param millis the run time in milliseconds
+ * @return the throughput in millions of operations per second
+ */
+static double runBench(bool useMutex, int numThreads, size_t capacity, long millis) {
+    BenchState bs;
+    bs.mpmcQueue = useMutex ? NULL : newMpmcQueue(capacity);
+    bs.arrayQueue = useMutex ? newArrayQueue(capacity) : NULL;
+    atomic_init(&bs.stop, false);
+    atomic_init(&bs.ops, 0);
+
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+    for (int t = 0; t < numThreads; t++) {
+        pthread_create(&threads[t], NULL, benchThread, &bs);
+    }
+
+    struct timespec ts = { millis / 1000, (millis % 1000) * 1000000 };
+    nanosleep(&ts, NULL);
+    atomic_store(&bs.stop, true);
+
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+
+    if (useMutex) {
+        deleteArrayQueue(bs.arrayQueue);
+    } else {
+        deleteMpmcQueue(bs.mpmcQueue);
+    }
+    return atomic_load(&bs.ops) / (millis / 1000.0) / 1e6;
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    long millis = (argc > 1) ? strtol(argv[1], NULL, 10) : 500;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : 32;
+    size_t capacity = (argc > 3) ? strtoul(argv[3], NULL, 10) : 1024;
+    if (capacity < (size_t)maxThreads) {
+        capacity = maxThreads;  // so enqueue never waits on a full queue
+    }
+
+    printf("%8s %16s %16s %8s\n", "threads", "mutex (M/s)", "lock-free (M/s)", "speedup");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double mutexRate = runBench(true, threads, capacity, millis);
+        double lockFreeRate = runBench(false, threads, capacity, millis);
+        printf("%8d %16.2f %16.2f %8.2f\n", threads, mutexRate, lockFreeRate,
+               lockFreeRate / mutexRate);
+        fflush(stdout);
+    }
+
+    return EXIT_SUCCESS;
+}
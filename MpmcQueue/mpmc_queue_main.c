@@ -0,0 +1,172 @@
+/*
+ * @file mpmc_queue_main.c
+ *
+ * Test program for MpmcQueue. Several producer threads enqueue
+ * numbered messages while several consumer threads dequeue them;
+ * the program checks that every message arrives exactly once and
+ * that each consumer sees each producer's messages in order.
+ *
+ * Usage: mpmc_queue_main [producers [consumers [count [capacity]]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mpmc_queue.h"
+
+/** State shared by the producer and consumer threads */
+typedef struct {
+    /** the queue */
+    MpmcQueue *queue;
+    /** number of producers */
+    int producers;
+    /** messages per producer */
+    size_t count;
+    /** messages left to dequeue */
+    atomic_size_t remaining;
+    /** number of times each message was received */
+    atomic_uchar *received;
+    /** number of messages received out of order */
+    atomic_size_t errors;
+} MpmcState;
+
+/** Arguments for one producer thread */
+typedef struct {
+    /** the shared state */
+    MpmcState *ms;
+    /** the producer number */
+    int producer;
+} ProducerArg;
+
+/**
+ * Producer thread that enqueues count messages "producer:i".
+ *
+ * @param arg the producer argument
+ * @return NULL
+ */
+static void *producer(void *arg) {
+    ProducerArg *pa = arg;
+    char buf[48];
+    for (size_t i = 0; i < pa->ms->count; i++) {
+        sprintf(buf, "%d:%zu", pa->producer, i);
+        enqueueMpmcQueueVal(pa->ms->queue, buf);
+    }
+    return NULL;
+}
+
+/**
+ * Consumer thread that dequeues messages until all have arrived.
+ *
+ * @param arg the shared state
+ * @return NULL
+ */
+static void *consumer(void *arg) {
+    MpmcState *ms = arg;
+    // last message number seen from each producer
+    long *last = malloc(ms->producers * sizeof(long));
+    for (int p = 0; p < ms->producers; p++) {
+        last[p] = -1;
+    }
+
+    char *val;
+    for (;;) {
+        // claim a message before waiting so no consumer waits forever
+        size_t remaining = atomic_load(&ms->remaining);
+        do {
+            if (remaining == 0) {
+                free(last);
+                return NULL;
+            }
+        } while (!atomic_compare_exchange_weak(&ms->remaining, &remaining, remaining - 1));
+
+        dequeueMpmcQueueVal(ms->queue, &val);
+        int p;
+        long i;
+        if (sscanf(val, "%d:%ld", &p, &i) != 2 || p < 0 || p >= ms->producers
+            || i < 0 || (size_t)i >= ms->count || i <= last[p]) {
+            atomic_fetch_add(&ms->errors, 1);
+        } else {
+            last[p] = i;
+            atomic_fetch_add(&ms->received[p * ms->count + i], 1);
+        }
+        free(val);
+    }
+}
+
+/**
+ * Test functions.
+ */
+int main(int argc, char *argv[]) {
+    int producers = (argc > 1) ? atoi(argv[1]) : 4;
+    int consumers = (argc > 2) ? atoi(argv[2]) : 4;
+    size_t count = (argc > 3) ? strtoul(argv[3], NULL, 10) : 100000;
+    size_t capacity = (argc > 4) ? strtoul(argv[4], NULL, 10) : 64;
+
+    printf("Single-threaded operations\n");
+    MpmcQueue *queue = newMpmcQueue(3);
+    printf("capacity: %zu\n", mpmcQueueCapacity(queue));
+    const char *vals[] = { "A", "B", "C", "D", "E" };
+    for (int i = 0; i < 5; i++) {
+        printf("try enqueue %s: %s\n", vals[i],
+               tryEnqueueMpmcQueueVal(queue, vals[i]) ? "true" : "false");
+    }
+    printMpmcQueue(queue);
+    char *val;
+    dequeueMpmcQueueVal(queue, &val);
+    printf("dequeue: %s\n", val);
+    free(val);
+    enqueueMpmcQueueVal(queue, "E");
+    printMpmcQueue(queue);
+    printf("size: %zu\n", mpmcQueueSize(queue));
+    while (tryDequeueMpmcQueueVal(queue, &val)) {
+        free(val);
+    }
+    printf("empty? %s\n", isMpmcQueueEmpty(queue) ? "true" : "false");
+    deleteMpmcQueue(queue);
+
+    printf("\n%d producers, %d consumers, %zu messages each\n", producers, consumers, count);
+    MpmcState ms;
+    ms.queue = newMpmcQueue(capacity);
+    ms.producers = producers;
+    ms.count = count;
+    atomic_init(&ms.remaining, producers * count);
+    ms.received = calloc(producers * count, sizeof(atomic_uchar));
+    atomic_init(&ms.errors, 0);
+
+    pthread_t *threads = malloc((producers + consumers) * sizeof(pthread_t));
+    ProducerArg *args = malloc(producers * sizeof(ProducerArg));
+    for (int c = 0; c < consumers; c++) {
+        pthread_create(&threads[producers + c], NULL, consumer, &ms);
+    }
+    for (int p = 0; p < producers; p++) {
+        args[p] = (ProducerArg){ &ms, p };
+        pthread_create(&threads[p], NULL, producer, &args[p]);
+    }
+    for (int t = 0; t < producers + consumers; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    size_t missing = 0;
+    for (size_t i = 0; i < producers * count; i++) {
+        if (atomic_load(&ms.received[i]) != 1) {
+            missing++;
+        }
+    }
+    printf("out of order: %zu, missing or duplicated: %zu\n",
+           atomic_load(&ms.errors), missing);
+    printf("queue empty? %s\n", isMpmcQueueEmpty(ms.queue) ? "true" : "false");
+
+    free(args);
+    free(threads);
+    free(ms.received);
+    deleteMpmcQueue(ms.queue);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
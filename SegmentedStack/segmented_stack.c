@@ -0,0 +1,313 @@
+/**
+ * @file segmented_stack.c
+ *
+ * Implementation for a stack of strings stored in linked fixed-size
+ * chunks.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "segmented_stack.h"
+
+/**
+ * Create a segmented stack with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of SegmentedStack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated segmented stack, or NULL if out of memory
+ */
+SegmentedStack *newSegmentedStack(size_t maxCapacity) {
+    SegmentedStack *stack = malloc(sizeof(SegmentedStack));
+    if (stack == NULL) {
+        return NULL;
+    }
+    // chunks are allocated on first push
+    stack->top = NULL;
+    stack->topCount = 0;
+    stack->spare = NULL;
+    stack->size = 0;
+    stack->maxCapacity = maxCapacity;
+    return stack;
+}
+
+/**
+ * Returns the location of the value n below the top.
+ *
+ * @param stack the SegmentedStack
+ * @param n the depth of the value; less than the size
+ * @return the location of the value
+ */
+static char **getSegmentedStackSlot(SegmentedStack *stack, size_t n) {
+    StackChunk *chunk = stack->top;
+    size_t count = stack->topCount;
+    while (n >= count) {
+        n -= count;
+        chunk = chunk->previous;
+        count = SEGMENTED_STACK_CHUNK_SIZE;  // chunks below the top are full
+    }
+    return &chunk->vals[count - 1 - n];
+}
+
+/**
+ * Unlink the empty top chunk and keep it as the spare, freeing
+ * the previous spare.
+ *
+ * @param stack the SegmentedStack
+ */
+static void releaseTopChunk(SegmentedStack *stack) {
+    StackChunk *chunk = stack->top;
+    stack->top = chunk->previous;
+    stack->topCount = (stack->top == NULL) ? 0 : SEGMENTED_STACK_CHUNK_SIZE;
+    free(stack->spare);  // free ok with NULL
+    stack->spare = chunk;
+}
+
+/**
+ * Push value onto the stack.
+ * @param stack the SegmentedStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if exceeds max capacity or out of memory
+ */
+bool pushSegmentedStackVal(SegmentedStack *stack, const char *val) {
+    if (stack->size == stack->maxCapacity) {
+        return false;
+    }
+    char *copy = strdup(val);  // must copy input string
+    if (copy == NULL) {
+        return false;
+    }
+
+    // link a new chunk on top if the top one is full
+    if (stack->top == NULL || stack->topCount == SEGMENTED_STACK_CHUNK_SIZE) {
+        StackChunk *chunk = stack->spare;
+        if (chunk != NULL) {
+            stack->spare = NULL;
+        } else if ((chunk = malloc(sizeof(StackChunk))) == NULL) {
+            free(copy);
+            return false;
+        }
+        chunk->previous = stack->top;
+        stack->top = chunk;
+        stack->topCount = 0;
+    }
+    stack->top->vals[stack->topCount++] = copy;
+    stack->size++;
+    return true;
+}
+
+/**
+ * Get the top stack value without removing it.
+ * @param stack the SegmentedStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if empty
+ */
+bool peekSegmentedStackVal(SegmentedStack *stack, const char **val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    *val = stack->top->vals[stack->topCount-1];
+    return true;
+}
+
+/**
+ * Set the stack top to a new value.
+ * @param stack the SegmentedStack
+ * @param val the value to set; cannot be null
+ * @return false if empty or out of memory
+ */
+bool pokeSegmentedStackVal(SegmentedStack *stack, const char *val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    char *copy = strdup(val);  // must copy input string
+    if (copy == NULL) {
+        return false;
+    }
+    char **slot = &stack->top->vals[stack->topCount-1];
+    free(*slot);
+    *slot = copy;
+    return true;
+}
+
+/**
+ * Deletes and returns the stack top. The stored string is handed
+ * to the caller rather than copied.
+ * @param stack the SegmentedStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if stack is empty
+ */
+bool popSegmentedStackVal(SegmentedStack *stack, char **val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    *val = stack->top->vals[--stack->topCount];
+    stack->size--;
+    if (stack->topCount == 0) {
+        releaseTopChunk(stack);
+    }
+    return true;
+}
+
+/**
+ * Exchange the top two stack values: (a b -- b a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have two values
+ */
+bool swapSegmentedStackVal(SegmentedStack *stack) {
+    return rollSegmentedStackVal(stack, 1);
+}
+
+/**
+ * Pushes another copy of the top stack value onto the stack.
+ * @param stack the SegmentedStack
+ * @return false if the stack is empty or exceeds max capacity
+ */
+bool dupSegmentedStackVal(SegmentedStack *stack) {
+    return pickSegmentedStackVal(stack, 0);
+}
+
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have three values
+ */
+bool rotSegmentedStackVal(SegmentedStack *stack) {
+    return rollSegmentedStackVal(stack, 2);
+}
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overSegmentedStackVal(SegmentedStack *stack) {
+    return pickSegmentedStackVal(stack, 1);
+}
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup.
+ * @param stack the SegmentedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickSegmentedStackVal(SegmentedStack *stack, size_t n) {
+    if (n >= stack->size) {
+        return false;
+    }
+    return pushSegmentedStackVal(stack, *getSegmentedStackSlot(stack, n));
+}
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param stack the SegmentedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollSegmentedStackVal(SegmentedStack *stack, size_t n) {
+    if (n >= stack->size) {
+        return false;
+    }
+    // walk down from the top, moving each value down one place
+    StackChunk *chunk = stack->top;
+    size_t index = stack->topCount - 1;
+    char **topSlot = &chunk->vals[index];
+    char *carry = *topSlot;
+    for (size_t depth = 1; depth <= n; depth++) {
+        if (index == 0) {
+            chunk = chunk->previous;
+            index = SEGMENTED_STACK_CHUNK_SIZE;
+        }
+        index--;
+        char *val = chunk->vals[index];
+        chunk->vals[index] = carry;
+        carry = val;
+    }
+    *topSlot = carry;
+    return true;
+}
+
+/**
+ * Deletes top value from the stack.
+ * @param stack the SegmentedStack
+ * @return false if the stack is empty
+ */
+bool dropSegmentedStackVal(SegmentedStack *stack) {
+    char *val;
+    if (popSegmentedStackVal(stack, &val)) {
+        free(val);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Drops all segmented stack values. Keeps one chunk as the spare.
+ * @param stack the SegmentedStack
+ */
+void dropAllSegmentedStackVals(SegmentedStack *stack) {
+    // function returns false when stack is empty
+    while (dropSegmentedStackVal(stack)) {}
+}
+
+/**
+ * Returns number of items in the segmented stack.
+ * @param stack the SegmentedStack
+ * @return the number of items in the segmented stack.
+ */
+size_t segmentedStackSize(SegmentedStack *stack) {
+    return stack->size;
+}
+
+/**
+ * Determines whether segmented stack is empty.
+ * @param stack the SegmentedStack
+ * @return true if segmented stack is empty, false otherwise
+ */
+bool isSegmentedStackEmpty(SegmentedStack *stack) {
+    return stack->size == 0;
+}
+
+/**
+ * Delete the segmented stack. Frees copies of all strings, the
+ * chunks, and finally the stack itself.
+ *
+ * @param stack the SegmentedStack
+ */
+void deleteSegmentedStack(SegmentedStack *stack) {
+    // free the strings and all chunks but the spare
+    dropAllSegmentedStackVals(stack);
+    free(stack->spare);
+
+    // set fields to safe values
+    stack->spare = NULL;
+    stack->top = NULL;
+
+    // free the stack itself
+    free(stack);
+}
+
+/**
+ * Print segmented stack for diagnostic purposes.
+ *
+ * @param stack the SegmentedStack
+ */
+void printSegmentedStack(SegmentedStack *stack) {
+    printf("stack (%zu):\n", stack->size);
+    size_t count = stack->topCount;
+    for (StackChunk *chunk = stack->top; chunk != NULL; chunk = chunk->previous) {
+        for (size_t i = count; i > 0; i--) {
+            printf("%s\n", chunk->vals[i-1]);
+        }
+        count = SEGMENTED_STACK_CHUNK_SIZE;  // chunks below the top are full
+    }
+}
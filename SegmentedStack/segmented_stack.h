@@ -0,0 +1,184 @@
+/**
+ * @file segmented_stack.h
+ *
+ * Declarations for a stack of strings stored in linked fixed-size
+ * chunks.
+ *
+ * ArrayStack grows by reallocating one array, which copies every
+ * value pointer each time it doubles. A SegmentedStack instead
+ * links a new chunk on top when the top chunk is full, so pushing
+ * and popping never move existing values, and a push costs at most
+ * one chunk allocation. A chunk that empties is kept as a spare, so
+ * a stack that grows and shrinks around a chunk boundary does not
+ * allocate and free a chunk every time.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef SEGMENTED_STACK_H_
+#define SEGMENTED_STACK_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Number of values in a chunk */
+#define SEGMENTED_STACK_CHUNK_SIZE 256
+
+/** Chunk of stack values */
+typedef struct StackChunk {
+    /** The chunk below this one, or NULL */
+    struct StackChunk *previous;
+    /** The values, bottom first */
+    char *vals[SEGMENTED_STACK_CHUNK_SIZE];
+} StackChunk;
+
+/** Segmented stack data structure */
+typedef struct {
+    /** The top chunk, or NULL if the stack is empty */
+    StackChunk *top;
+    /** Number of values in the top chunk; chunks below are full */
+    size_t topCount;
+    /** An empty chunk kept for the next push, or NULL */
+    StackChunk *spare;
+    /** The current size */
+    size_t size;
+    /** Maximum capacity of the stack */
+    size_t maxCapacity;
+} SegmentedStack;
+
+/**
+ * Create a segmented stack with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of SegmentedStack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated segmented stack, or NULL if out of memory
+ */
+SegmentedStack *newSegmentedStack(size_t maxCapacity);
+
+/**
+ * Push value onto the stack.
+ * @param stack the SegmentedStack
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if exceeds max capacity or out of memory
+ */
+bool pushSegmentedStackVal(SegmentedStack *stack, const char *val);
+
+/**
+ * Get the top stack value without removing it.
+ * @param stack the SegmentedStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if empty
+ */
+bool peekSegmentedStackVal(SegmentedStack *stack, const char **val);
+
+/**
+ * Set the stack top to a new value.
+ * @param stack the SegmentedStack
+ * @param val the value to set; cannot be null
+ * @return false if empty or out of memory
+ */
+bool pokeSegmentedStackVal(SegmentedStack *stack, const char *val);
+
+/**
+ * Deletes and returns the stack top. The stored string is handed
+ * to the caller rather than copied.
+ * @param stack the SegmentedStack
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if stack is empty
+ */
+bool popSegmentedStackVal(SegmentedStack *stack, char **val);
+
+/**
+ * Exchange the top two stack values: (a b -- b a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have two values
+ */
+bool swapSegmentedStackVal(SegmentedStack *stack);
+
+/**
+ * Pushes another copy of the top stack value onto the stack.
+ * @param stack the SegmentedStack
+ * @return false if the stack is empty or exceeds max capacity
+ */
+bool dupSegmentedStackVal(SegmentedStack *stack);
+
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have three values
+ */
+bool rotSegmentedStackVal(SegmentedStack *stack);
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * @param stack the SegmentedStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overSegmentedStackVal(SegmentedStack *stack);
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup.
+ * @param stack the SegmentedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickSegmentedStackVal(SegmentedStack *stack, size_t n);
+
+/**
+ * Moves the value n below the top to the top without copying it;
+ * roll 1 is swap and roll 2 is rot.
+ * @param stack the SegmentedStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollSegmentedStackVal(SegmentedStack *stack, size_t n);
+
+/**
+ * Deletes top value from the stack.
+ * @param stack the SegmentedStack
+ * @return false if the stack is empty
+ */
+bool dropSegmentedStackVal(SegmentedStack *stack);
+
+/**
+ * Drops all segmented stack values. Keeps one chunk as the spare.
+ * @param stack the SegmentedStack
+ */
+void dropAllSegmentedStackVals(SegmentedStack *stack);
+
+/**
+ * Returns number of items in the segmented stack.
+ * @param stack the SegmentedStack
+ * @return the number of items in the segmented stack.
+ */
+size_t segmentedStackSize(SegmentedStack *stack);
+
+/**
+ * Determines whether segmented stack is empty.
+ * @param stack the SegmentedStack
+ * @return true if segmented stack is empty, false otherwise
+ */
+bool isSegmentedStackEmpty(SegmentedStack *stack);
+
+/**
+ * Delete the segmented stack. Frees copies of all strings, the
+ * chunks, and finally the stack itself.
+ *
+ * @param stack the SegmentedStack
+ */
+void deleteSegmentedStack(SegmentedStack *stack);
+
+/**
+ * Print segmented stack for diagnostic purposes.
+ *
+ * @param stack the SegmentedStack
+ */
+void printSegmentedStack(SegmentedStack *stack);
+
+#endif /* SEGMENTED_STACK_H_ */
@@ -0,0 +1,136 @@
+/*
+ * @file segmented_stack_bench.c
+ *
+ * Benchmark of SegmentedStack against ArrayStack, which grows by
+ * reallocating its array:
+ *
+ *   fill   - push count values, then pop them all
+ *   bounce - push and pop one value many times at a chunk boundary
+ *
+ * For fill it also reports the slowest single push, where the
+ * ArrayStack copies its whole array.
+ *
+ * Usage: segmented_stack_bench [count [bounces]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "array_stack.h"
+#include "segmented_stack.h"
+
+/** Value pushed by the benchmark */
+#define BENCH_VAL "value"
+
+/**
+ * Returns the current time in nanoseconds.
+ *
+ * @return the time
+ */
+static double nowNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**
+ * Return freed memory to the system between runs. Otherwise the
+ * first large allocation of the next run pays for consolidating
+ * the small blocks the previous run freed.
+ */
+static void settleHeap(void) {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
+/**
+ * Print one result row.
+ *
+ * @param work the workload name
+ * @param stack the stack name
+ * @param nanos the total time
+ * @param ops the number of operations
+ * @param maxPushNanos the slowest push, or a negative number if
+ *   not measured
+ */
+static void printRow(const char *work, const char *stack, double nanos, size_t ops,
+                     double maxPushNanos) {
+    printf("%-7s %-10s %12.2f %10.1f", work, stack, nanos / 1e6, nanos / ops);
+    if (maxPushNanos >= 0) {
+        printf(" %14.1f", maxPushNanos / 1e3);
+    }
+    printf("\n");
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1 << 22;
+    size_t bounces = (argc > 2) ? strtoul(argv[2], NULL, 10) : 10000000;
+
+    printf("%-7s %-10s %12s %10s %14s\n", "work", "stack", "time (ms)", "ns/op", "max push (us)");
+
+    // fill: time every push to find the slowest
+    ArrayStack *arrayStack = newArrayStack(SIZE_MAX);
+    double maxPush = 0;
+    double start = nowNanos();
+    for (size_t i = 0; i < count; i++) {
+        double before = nowNanos();
+        pushArrayStackVal(arrayStack, BENCH_VAL);
+        double elapsed = nowNanos() - before;
+        maxPush = (elapsed > maxPush) ? elapsed : maxPush;
+    }
+    char *val;
+    while (popArrayStackVal(arrayStack, &val)) {
+        free(val);
+    }
+    printRow("fill", "array", nowNanos() - start, 2 * count, maxPush);
+    settleHeap();
+
+    SegmentedStack *segmentedStack = newSegmentedStack(SIZE_MAX);
+    maxPush = 0;
+    start = nowNanos();
+    for (size_t i = 0; i < count; i++) {
+        double before = nowNanos();
+        pushSegmentedStackVal(segmentedStack, BENCH_VAL);
+        double elapsed = nowNanos() - before;
+        maxPush = (elapsed > maxPush) ? elapsed : maxPush;
+    }
+    while (popSegmentedStackVal(segmentedStack, &val)) {
+        free(val);
+    }
+    printRow("fill", "segmented", nowNanos() - start, 2 * count, maxPush);
+    settleHeap();
+
+    // bounce: one past a full chunk
+    for (size_t i = 0; i < SEGMENTED_STACK_CHUNK_SIZE; i++) {
+        pushArrayStackVal(arrayStack, BENCH_VAL);
+        pushSegmentedStackVal(segmentedStack, BENCH_VAL);
+    }
+    start = nowNanos();
+    for (size_t i = 0; i < bounces; i++) {
+        pushArrayStackVal(arrayStack, BENCH_VAL);
+        dropArrayStackVal(arrayStack);
+    }
+    printRow("bounce", "array", nowNanos() - start, 2 * bounces, -1);
+
+    start = nowNanos();
+    for (size_t i = 0; i < bounces; i++) {
+        pushSegmentedStackVal(segmentedStack, BENCH_VAL);
+        dropSegmentedStackVal(segmentedStack);
+    }
+    printRow("bounce", "segmented", nowNanos() - start, 2 * bounces, -1);
+
+    deleteArrayStack(arrayStack);
+    deleteSegmentedStack(segmentedStack);
+    return EXIT_SUCCESS;
+}
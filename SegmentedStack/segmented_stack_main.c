@@ -0,0 +1,120 @@
+/*
+ * @file segmented_stack_main.c
+ *
+ * Test program for SegmentedStack. Exercises the stack operations,
+ * then checks values across chunk boundaries and that a stack
+ * growing and shrinking around a boundary reuses its spare chunk.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "segmented_stack.h"
+
+/**
+ * Push the numbers 0 to count-1 as strings.
+ *
+ * @param stack the SegmentedStack
+ * @param count the number of values
+ */
+static void pushNumbers(SegmentedStack *stack, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%zu", i);
+        pushSegmentedStackVal(stack, buf);
+    }
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating segmented stack\n");
+    SegmentedStack *stack = newSegmentedStack(5);
+    printf("stack empty? %s\n", isSegmentedStackEmpty(stack) ? "true" : "false");
+
+    printf("\nadding 5 values\n");
+    pushSegmentedStackVal(stack, "A");
+    pushSegmentedStackVal(stack, "B");
+    pushSegmentedStackVal(stack, "C");
+    pushSegmentedStackVal(stack, "D");
+    pushSegmentedStackVal(stack, "E");
+    printSegmentedStack(stack);
+    printf("push past max capacity: %s\n",
+           pushSegmentedStackVal(stack, "F") ? "true" : "false");
+
+    swapSegmentedStackVal(stack);
+    printf("\nswapped top\n");
+    printSegmentedStack(stack);
+    rotSegmentedStackVal(stack);
+    printf("\nrotated third to top\n");
+    printSegmentedStack(stack);
+    pokeSegmentedStackVal(stack, "Z");
+    printf("\npoked top: Z\n");
+    printSegmentedStack(stack);
+    char *val;
+    popSegmentedStackVal(stack, &val);
+    printf("\npop value: %s\n", val);
+    free(val);  // pop returns allocated storage
+    overSegmentedStackVal(stack);
+    printf("\nover value\n");
+    printSegmentedStack(stack);
+    dropAllSegmentedStackVals(stack);
+    printf("\ndropped all; stack empty? %s\n",
+           isSegmentedStackEmpty(stack) ? "true" : "false");
+    deleteSegmentedStack(stack);
+
+    size_t count = 5 * SEGMENTED_STACK_CHUNK_SIZE + 17;
+    printf("\nValues across chunks of %d\n", SEGMENTED_STACK_CHUNK_SIZE);
+    stack = newSegmentedStack(SIZE_MAX);
+    pushNumbers(stack, count);
+    const char *top;
+    peekSegmentedStackVal(stack, &top);
+    printf("size: %zu, top: %s\n", segmentedStackSize(stack), top);
+
+    // roll the bottom value to the top and back down again
+    rollSegmentedStackVal(stack, count - 1);
+    peekSegmentedStackVal(stack, &top);
+    printf("after roll %zu, top: %s\n", count - 1, top);
+    for (size_t i = 0; i < count - 1; i++) {
+        rollSegmentedStackVal(stack, count - 1);
+    }
+    pickSegmentedStackVal(stack, 600);
+    popSegmentedStackVal(stack, &val);
+    printf("pick 600: %s\n", val);
+    free(val);
+
+    size_t wrong = 0;
+    for (size_t i = count; i > 0; i--) {
+        popSegmentedStackVal(stack, &val);
+        if ((size_t)atol(val) != i - 1) {
+            wrong++;
+        }
+        free(val);
+    }
+    printf("popped all, %zu out of order, empty? %s\n", wrong,
+           isSegmentedStackEmpty(stack) ? "true" : "false");
+
+    printf("\nGrowing and shrinking around a chunk boundary\n");
+    pushNumbers(stack, SEGMENTED_STACK_CHUNK_SIZE);
+    pushSegmentedStackVal(stack, "over");  // allocates the second chunk
+    dropSegmentedStackVal(stack);  // which becomes the spare
+    StackChunk *spare = stack->spare;
+    bool reused = true;
+    for (int i = 0; i < 1000; i++) {
+        pushSegmentedStackVal(stack, "over");  // takes the spare
+        reused = reused && stack->spare == NULL;
+        dropSegmentedStackVal(stack);  // gives it back
+        reused = reused && stack->spare == spare;
+    }
+    printf("spare chunk reused every time? %s\n", reused ? "true" : "false");
+    deleteSegmentedStack(stack);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,270 @@
+/**
+ * @file spsc_queue.c
+ *
+ * Implementation for a bounded lock-free single-producer,
+ * single-consumer queue.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spsc_queue.h"
+
+/**
+ * Create an SPSC queue.
+ *
+ * @param capacity the minimum capacity of the queue; rounded
+ *   up to a power of 2
+ * @return the allocated queue, or NULL if out of memory or
+ *   capacity is too large to round up
+ */
+SpscQueue *newSpscQueue(size_t capacity) {
+    // no power of 2 above SIZE_MAX / 2 + 1 fits in a size_t
+    if (capacity > SIZE_MAX / 2 + 1) {
+        return NULL;
+    }
+
+    // round up to a power of 2 so indexes wrap with a mask
+    size_t ringCapacity = 1;
+    while (ringCapacity < capacity) {
+        ringCapacity *= 2;
+    }
+
+    // aligned so head and tail are on their own cache lines
+    SpscQueue *queue = aligned_alloc(SPSC_CACHE_LINE, sizeof(SpscQueue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->vals = calloc(ringCapacity, sizeof(char*));
+    if (queue->vals == NULL) {
+        free(queue);
+        return NULL;
+    }
+    queue->capacity = ringCapacity;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+
+    return queue;
+}
+
+/**
+ * Returns the number of free slots seen by the producer, reloading
+ * the head index only if the cached copy shows fewer than wanted.
+ *
+ * @param queue the SpscQueue
+ * @param tail the producer's tail index
+ * @param wanted the number of slots wanted
+ * @return the number of free slots
+ */
+static size_t producerFreeSlots(SpscQueue *queue, size_t tail, size_t wanted) {
+    size_t freeSlots = queue->capacity - (tail - queue->cachedHead);
+    if (freeSlots < wanted) {
+        // acquire: consumer is done with slots before head
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        freeSlots = queue->capacity - (tail - queue->cachedHead);
+    }
+    return freeSlots;
+}
+
+/**
+ * Returns the number of values seen by the consumer, reloading the
+ * tail index only if the cached copy shows fewer than wanted.
+ *
+ * @param queue the SpscQueue
+ * @param head the consumer's head index
+ * @param wanted the number of values wanted
+ * @return the number of values available
+ */
+static size_t consumerAvailable(SpscQueue *queue, size_t head, size_t wanted) {
+    size_t available = queue->cachedTail - head;
+    if (available < wanted) {
+        // acquire: producer has written values before tail
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        available = queue->cachedTail - head;
+    }
+    return available;
+}
+
+/**
+ * Enqueue value onto the queue. Producer only.
+ *
+ * @param queue the SpscQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full
+ */
+bool enqueueSpscQueueVal(SpscQueue *queue, const char *val) {
+    return enqueueSpscQueueVals(queue, &val, 1) == 1;
+}
+
+/**
+ * Enqueue values onto the queue, publishing them to the consumer
+ * together. Producer only.
+ *
+ * @param queue the SpscQueue
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param count the number of values
+ * @return the number of values enqueued, less than count if the
+ *   queue fills
+ */
+size_t enqueueSpscQueueVals(SpscQueue *queue, const char *vals[], size_t count) {
+    // only the producer writes tail
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t freeSlots = producerFreeSlots(queue, tail, count);
+    if (count > freeSlots) {
+        count = freeSlots;
+    }
+
+    size_t mask = queue->capacity - 1;
+    for (size_t i = 0; i < count; i++) {
+        queue->vals[(tail + i) & mask] = strdup(vals[i]);  // must copy input string
+    }
+
+    // release: publish all values with one store
+    if (count > 0) {
+        atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+    }
+    return count;
+}
+
+/**
+ * Get the head queue value without removing it. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; value is valid until it is dequeued
+ * @return false if the queue is empty
+ */
+bool peekSpscQueueVal(SpscQueue *queue, const char **val) {
+    // only the consumer writes head
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (consumerAvailable(queue, head, 1) == 0) {
+        return false;
+    }
+    *val = queue->vals[head & (queue->capacity - 1)];
+    return true;
+}
+
+/**
+ * Dequeue the head queue value. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueSpscQueueVal(SpscQueue *queue, char **val) {
+    return dequeueSpscQueueVals(queue, val, 1) == 1;
+}
+
+/**
+ * Dequeue values from the queue, freeing their slots for the
+ * producer together. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param count the maximum number of values
+ * @return the number of values dequeued
+ */
+size_t dequeueSpscQueueVals(SpscQueue *queue, char *vals[], size_t count) {
+    // only the consumer writes head
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t available = consumerAvailable(queue, head, count);
+    if (count > available) {
+        count = available;
+    }
+
+    // ownership of the strings passes to the caller
+    size_t mask = queue->capacity - 1;
+    for (size_t i = 0; i < count; i++) {
+        vals[i] = queue->vals[(head + i) & mask];
+        queue->vals[(head + i) & mask] = NULL;
+    }
+
+    // release: hand all slots back with one store
+    if (count > 0) {
+        atomic_store_explicit(&queue->head, head + count, memory_order_release);
+    }
+    return count;
+}
+
+/**
+ * Returns number of items in the queue. The result may be out of
+ * date if the other thread is changing the queue.
+ *
+ * @param queue the SpscQueue
+ * @return the number of items in the queue
+ */
+size_t spscQueueSize(SpscQueue *queue) {
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    // head loaded first, so tail is never behind it
+    return tail - head;
+}
+
+/**
+ * Returns the capacity of the queue.
+ *
+ * @param queue the SpscQueue
+ * @return the capacity
+ */
+size_t spscQueueCapacity(SpscQueue *queue) {
+    return queue->capacity;
+}
+
+/**
+ * Determines whether queue is empty. The result may be out of
+ * date if the other thread is changing the queue.
+ *
+ * @param queue the SpscQueue
+ * @return true if queue is empty, false otherwise
+ */
+bool isSpscQueueEmpty(SpscQueue *queue) {
+    return spscQueueSize(queue) == 0;
+}
+
+/**
+ * Delete the queue. Frees copies of all strings, then the ring,
+ * and finally the queue itself. No thread may be using the queue.
+ *
+ * @param queue the SpscQueue
+ */
+void deleteSpscQueue(SpscQueue *queue) {
+    // free the strings in the ring
+    for (size_t i = 0; i < queue->capacity; i++) {
+        free(queue->vals[i]);  // free ok with NULL
+    }
+    free(queue->vals);
+
+    // set fields to safe values
+    queue->vals = NULL;
+    queue->capacity = 0;
+
+    // free the queue itself
+    free(queue);
+}
+
+/**
+ * Print queue for diagnostic purposes. No thread may be
+ * changing the queue.
+ *
+ * @param queue the SpscQueue
+ */
+void printSpscQueue(SpscQueue *queue) {
+    size_t head = atomic_load(&queue->head);
+    size_t tail = atomic_load(&queue->tail);
+    printf("( ");
+    for (size_t i = head; i != tail; i++) {
+        printf("\"%s\" ", queue->vals[i & (queue->capacity - 1)]);
+    }
+    printf(")\n");
+}
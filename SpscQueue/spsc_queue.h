@@ -0,0 +1,155 @@
+/**
+ * @file spsc_queue.h
+ *
+ * Declarations for a bounded lock-free single-producer,
+ * single-consumer queue.
+ *
+ * The queue is a ring buffer with a power-of-two capacity. One
+ * thread may call the enqueue functions and one other thread may
+ * call the dequeue and peek functions, concurrently, without locks.
+ * The producer publishes values by a release store of the tail
+ * index, and the consumer frees slots by a release store of the
+ * head index. The two indices are on separate cache lines, and each
+ * side keeps a cached copy of the other side's index so it reads
+ * the shared index only when the queue looks full or empty.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef SPSC_QUEUE_H_
+#define SPSC_QUEUE_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Size of a cache line */
+#define SPSC_CACHE_LINE 64
+
+/** SPSC queue data structure */
+typedef struct {
+    /** Index of the next value to dequeue; written by the consumer */
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t head;
+    /** Consumer's copy of the tail index */
+    size_t cachedTail;
+
+    /** Index of the next slot to enqueue; written by the producer */
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t tail;
+    /** Producer's copy of the head index */
+    size_t cachedHead;
+
+    /** Capacity of the ring; a power of 2 */
+    _Alignas(SPSC_CACHE_LINE) size_t capacity;
+    /** Ring storage */
+    char **vals;
+} SpscQueue;
+
+/**
+ * Create an SPSC queue.
+ *
+ * @param capacity the minimum capacity of the queue; rounded
+ *   up to a power of 2
+ * @return the allocated queue, or NULL if out of memory or
+ *   capacity is too large to round up
+ */
+SpscQueue *newSpscQueue(size_t capacity);
+
+/**
+ * Enqueue value onto the queue. Producer only.
+ *
+ * @param queue the SpscQueue
+ * @param val the value to insert; value will be copied to store,
+ *     and cannot be null
+ * @return false if the queue is full
+ */
+bool enqueueSpscQueueVal(SpscQueue *queue, const char *val);
+
+/**
+ * Enqueue values onto the queue, publishing them to the consumer
+ * together. Producer only.
+ *
+ * @param queue the SpscQueue
+ * @param vals the values to insert; values will be copied to store,
+ *     and cannot be null
+ * @param count the number of values
+ * @return the number of values enqueued, less than count if the
+ *   queue fills
+ */
+size_t enqueueSpscQueueVals(SpscQueue *queue, const char *vals[], size_t count);
+
+/**
+ * Get the head queue value without removing it. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; value is valid until it is dequeued
+ * @return false if the queue is empty
+ */
+bool peekSpscQueueVal(SpscQueue *queue, const char **val);
+
+/**
+ * Dequeue the head queue value. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null; returned value must be freed
+ * @return false if the queue is empty
+ */
+bool dequeueSpscQueueVal(SpscQueue *queue, char **val);
+
+/**
+ * Dequeue values from the queue, freeing their slots for the
+ * producer together. Consumer only.
+ *
+ * @param queue the SpscQueue
+ * @param vals result parameter for the values; returned values
+ *   must be freed
+ * @param count the maximum number of values
+ * @return the number of values dequeued
+ */
+size_t dequeueSpscQueueVals(SpscQueue *queue, char *vals[], size_t count);
+
+/**
+ * Returns number of items in the queue. The result may be out of
+ * date if the other thread is changing the queue.
+ *
+ * @param queue the SpscQueue
+ * @return the number of items in the queue
+ */
+size_t spscQueueSize(SpscQueue *queue);
+
+/**
+ * Returns the capacity of the queue.
+ *
+ * @param queue the SpscQueue
+ * @return the capacity
+ */
+size_t spscQueueCapacity(SpscQueue *queue);
+
+/**
+ * Determines whether queue is empty. The result may be out of
+ * date if the other thread is changing the queue.
+ *
+ * @param queue the SpscQueue
+ * @return true if queue is empty, false otherwise
+ */
+bool isSpscQueueEmpty(SpscQueue *queue);
+
+/**
+ * Delete the queue. Frees copies of all strings, then the ring,
+ * and finally the queue itself. No thread may be using the queue.
+ *
+ * @param queue the SpscQueue
+ */
+void deleteSpscQueue(SpscQueue *queue);
+
+/**
+ * Print queue for diagnostic purposes. No thread may be
+ * changing the queue.
+ *
+ * @param queue the SpscQueue
+ */
+void printSpscQueue(SpscQueue *queue);
+
+#endif /* SPSC_QUEUE_H_ */
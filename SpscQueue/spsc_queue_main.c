@@ -0,0 +1,153 @@
+/*
+ * @file spsc_queue_main.c
+ *
+ * Test program for SpscQueue. A producer thread hands messages to
+ * a consumer thread one at a time and then in batches; the consumer
+ * checks that every message arrives once and in order.
+ *
+ * Usage: spsc_queue_main [count [capacity [batch]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "spsc_queue.h"
+
+/** State shared by the producer and consumer threads */
+typedef struct {
+    /** the queue */
+    SpscQueue *queue;
+    /** number of messages to hand off */
+    size_t count;
+    /** values per batch; 1 for single enqueue and dequeue */
+    size_t batch;
+    /** number of messages received out of order */
+    size_t errors;
+} HandoffState;
+
+/**
+ * Producer thread that enqueues count messages.
+ *
+ * @param arg the handoff state
+ * @return NULL
+ */
+static void *producer(void *arg) {
+    HandoffState *hs = arg;
+    char bufs[hs->batch][24];
+    const char *vals[hs->batch];
+    for (size_t i = 0; i < hs->count; ) {
+        size_t n = (hs->count - i < hs->batch) ? hs->count - i : hs->batch;
+        for (size_t j = 0; j < n; j++) {
+            sprintf(bufs[j], "msg%zu", i + j);
+            vals[j] = bufs[j];
+        }
+        size_t sent = 0;
+        while (sent < n) {
+            size_t k = (hs->batch == 1)
+                     ? enqueueSpscQueueVal(hs->queue, vals[0])
+                     : enqueueSpscQueueVals(hs->queue, vals + sent, n - sent);
+            if (k == 0) {
+                sched_yield();  // full: let the consumer run
+            }
+            sent += k;
+        }
+        i += n;
+    }
+    return NULL;
+}
+
+/**
+ * Consumer thread that dequeues count messages and checks order.
+ *
+ * @param arg the handoff state
+ * @return NULL
+ */
+static void *consumer(void *arg) {
+    HandoffState *hs = arg;
+    char *vals[hs->batch];
+    char expected[24];
+    for (size_t i = 0; i < hs->count; ) {
+        size_t k = (hs->batch == 1)
+                 ? dequeueSpscQueueVal(hs->queue, &vals[0])
+                 : dequeueSpscQueueVals(hs->queue, vals, hs->batch);
+        if (k == 0) {
+            sched_yield();  // empty: let the producer run
+        }
+        for (size_t j = 0; j < k; j++, i++) {
+            sprintf(expected, "msg%zu", i);
+            if (strcmp(vals[j], expected) != 0) {
+                hs->errors++;
+            }
+            free(vals[j]);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Hand off messages between two threads and print the throughput.
+ *
+ * @param count the number of messages
+ * @param capacity the queue capacity
+ * @param batch the values per batch
+ */
+static void runHandoff(size_t count, size_t capacity, size_t batch) {
+    HandoffState hs = { newSpscQueue(capacity), count, batch, 0 };
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t producerThread, consumerThread;
+    pthread_create(&consumerThread, NULL, consumer, &hs);
+    pthread_create(&producerThread, NULL, producer, &hs);
+    pthread_join(producerThread, NULL);
+    pthread_join(consumerThread, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("batch %zu: %zu messages, %zu errors, %.0f messages/sec\n",
+           batch, count, hs.errors, count / secs);
+    printf("queue empty? %s\n", isSpscQueueEmpty(hs.queue) ? "true" : "false");
+    deleteSpscQueue(hs.queue);
+}
+
+/**
+ * Test functions.
+ */
+int main(int argc, char *argv[]) {
+    size_t count = (argc > 1) ? strtoull(argv[1], NULL, 10) : 1000000;
+    size_t capacity = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1024;
+    size_t batch = (argc > 3) ? strtoull(argv[3], NULL, 10) : 32;
+
+    printf("Single-threaded operations\n");
+    SpscQueue *queue = newSpscQueue(3);
+    printf("capacity: %zu\n", spscQueueCapacity(queue));
+    const char *vals[] = { "A", "B", "C", "D", "E" };
+    printf("enqueued %zu of 5\n", enqueueSpscQueueVals(queue, vals, 5));
+    printSpscQueue(queue);
+    const char *head;
+    if (peekSpscQueueVal(queue, &head)) {
+        printf("peek: %s\n", head);
+    }
+    char *val;
+    dequeueSpscQueueVal(queue, &val);
+    printf("dequeue: %s\n", val);
+    free(val);
+    enqueueSpscQueueVal(queue, "E");
+    printSpscQueue(queue);
+    printf("size: %zu\n", spscQueueSize(queue));
+    deleteSpscQueue(queue);
+
+    printf("\nHanding off between threads\n");
+    runHandoff(count, capacity, 1);
+    runHandoff(count, capacity, (batch > 0) ? batch : 1);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+/**
+ * @file number_stack.c
+ *
+ * Implementation for a stack of numbers stored inline.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "number_stack.h"
+
+/**
+ * Create a number stack with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of NumberStack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated number stack, or NULL if out of memory
+ */
+NumberStack *newNumberStack(size_t maxCapacity) {
+    NumberStack *stack = malloc(sizeof(NumberStack));
+    if (stack == NULL) {
+        return NULL;
+    }
+    stack->size = 0;
+    stack->capacity = 16;  // small power of 2
+    stack->maxCapacity = maxCapacity;
+    stack->vals = malloc(stack->capacity * sizeof(double));
+    if (stack->vals == NULL) {
+        free(stack);
+        return NULL;
+    }
+    return stack;
+}
+
+/**
+ * Grow the array if needed so that count more values fit; pushing
+ * them then does not grow it again.
+ *
+ * @param stack the NumberStack
+ * @param count the number of values to make room for
+ * @return false if the values would exceed max capacity or out
+ *   of memory; the stack is then unchanged
+ */
+bool reserveNumberStack(NumberStack *stack, size_t count) {
+    if (count > stack->maxCapacity - stack->size) {
+        return false;
+    }
+    size_t needed = stack->size + count;
+    if (needed <= stack->capacity) {
+        return true;
+    }
+
+    // double until large enough, but not past maxCapacity
+    size_t newCapacity = stack->capacity;
+    while (newCapacity < needed) {
+        newCapacity = (stack->maxCapacity - newCapacity < newCapacity)
+                    ? stack->maxCapacity : newCapacity * 2;
+    }
+    double *newVals = realloc(stack->vals, newCapacity * sizeof(double));
+    if (newVals == NULL) { // not enough memory to reallocate
+        return false;
+    }
+    stack->vals = newVals;
+    stack->capacity = newCapacity;
+    return true;
+}
+
+/**
+ * Push value onto the stack.
+ * @param stack the NumberStack
+ * @param val the value to push
+ * @return false if exceeds max capacity
+ */
+bool pushNumberStackVal(NumberStack *stack, double val) {
+    if (!reserveNumberStack(stack, 1)) {
+        return false;
+    }
+    stack->vals[stack->size++] = val;
+    return true;
+}
+
+/**
+ * Get the top stack value without removing it.
+ * @param stack the NumberStack
+ * @param val result parameter for the value
+ * @return false if empty
+ */
+bool peekNumberStackVal(NumberStack *stack, double *val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    *val = stack->vals[stack->size-1];
+    return true;
+}
+
+/**
+ * Set the stack top to a new value.
+ * @param stack the NumberStack
+ * @param val the value to set
+ * @return false if empty
+ */
+bool pokeNumberStackVal(NumberStack *stack, double val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    stack->vals[stack->size-1] = val;
+    return true;
+}
+
+/**
+ * Deletes and returns the stack top.
+ * @param stack the NumberStack
+ * @param val result parameter for the value
+ * @return false if empty
+ */
+bool popNumberStackVal(NumberStack *stack, double *val) {
+    if (stack->size == 0) {
+        return false;
+    }
+    *val = stack->vals[--stack->size];
+    return true;
+}
+
+/**
+ * Exchange the top two stack values: (a b -- b a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values
+ */
+bool swapNumberStackVal(NumberStack *stack) {
+    return rollNumberStackVal(stack, 1);
+}
+
+/**
+ * Pushes another copy of the top stack value: (a -- a a).
+ * @param stack the NumberStack
+ * @return false if the stack is empty or exceeds max capacity
+ */
+bool dupNumberStackVal(NumberStack *stack) {
+    return pickNumberStackVal(stack, 0);
+}
+
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have three values
+ */
+bool rotNumberStackVal(NumberStack *stack) {
+    return rollNumberStackVal(stack, 2);
+}
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overNumberStackVal(NumberStack *stack) {
+    return pickNumberStackVal(stack, 1);
+}
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup.
+ * @param stack the NumberStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickNumberStackVal(NumberStack *stack, size_t n) {
+    if (n >= stack->size) {
+        return false;
+    }
+    // read first: the push may move the array
+    double val = stack->vals[stack->size-1-n];
+    return pushNumberStackVal(stack, val);
+}
+
+/**
+ * Moves the value n below the top to the top; roll 1 is swap.
+ * @param stack the NumberStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollNumberStackVal(NumberStack *stack, size_t n) {
+    if (n >= stack->size) {
+        return false;
+    }
+    double *top = &stack->vals[stack->size-1];
+    double val = *(top - n);
+    memmove(top - n, top - n + 1, n * sizeof(double));
+    *top = val;
+    return true;
+}
+
+/**
+ * Deletes the second stack value: (a b -- b).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values
+ */
+bool nipNumberStackVal(NumberStack *stack) {
+    if (stack->size < 2) {
+        return false;
+    }
+    stack->vals[stack->size-2] = stack->vals[stack->size-1];
+    stack->size--;
+    return true;
+}
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckNumberStackVal(NumberStack *stack) {
+    if (stack->size < 2 || !reserveNumberStack(stack, 1)) {
+        return false;
+    }
+    double *vals = stack->vals + stack->size - 2;
+    vals[2] = vals[1];
+    vals[1] = vals[0];
+    vals[0] = vals[2];
+    stack->size++;
+    return true;
+}
+
+/**
+ * Deletes top value from the stack.
+ * @param stack the NumberStack
+ * @return false if the stack is empty
+ */
+bool dropNumberStackVal(NumberStack *stack) {
+    if (stack->size == 0) {
+        return false;
+    }
+    stack->size--;
+    return true;
+}
+
+/**
+ * Drops all number stack values.
+ * @param stack the NumberStack
+ */
+void dropAllNumberStackVals(NumberStack *stack) {
+    stack->size = 0;
+}
+
+/**
+ * Returns number of items in the number stack.
+ * @param stack the NumberStack
+ * @return the number of items in the number stack.
+ */
+size_t numberStackSize(NumberStack *stack) {
+    return stack->size;
+}
+
+/**
+ * Determines whether number stack is empty.
+ * @param stack the NumberStack
+ * @return true if number stack is empty, false otherwise
+ */
+bool isNumberStackEmpty(NumberStack *stack) {
+    return stack->size == 0;
+}
+
+/**
+ * Delete the number stack.
+ *
+ * @param stack the NumberStack
+ */
+void deleteNumberStack(NumberStack *stack) {
+    free(stack->vals);
+
+    // set fields to safe values
+    stack->vals = NULL;
+    stack->size = 0;
+    stack->capacity = 0;
+
+    // free the stack itself
+    free(stack);
+}
+
+/**
+ * Print number stack for diagnostic purposes.
+ *
+ * @param stack the NumberStack
+ */
+void printNumberStack(NumberStack *stack) {
+    printf("stack (%zu):\n", stack->size);
+    for (size_t i = stack->size; i > 0; i--) {
+        printf("%g\n", stack->vals[i-1]);
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file number_stack.h
+ *
+ * Declarations for a stack of numbers stored inline.
+ *
+ * NumberStack has the operations of ArrayStack, but its values are
+ * doubles held directly in the array, so pushing and popping never
+ * allocate or copy strings.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef NUMBER_STACK_H_
+#define NUMBER_STACK_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Number stack data structure */
+typedef struct {
+    /** Allocated array storage; the top is the last value */
+    double *vals;
+    /** The current size */
+    size_t size;
+    /** Capacity of allocated array */
+    size_t capacity;
+    /** Maximum capacity of allocated array */
+    size_t maxCapacity;
+} NumberStack;
+
+/**
+ * Create a number stack with a max capacity.
+ *
+ * @param maxCapacity maximum capacity of NumberStack.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated number stack, or NULL if out of memory
+ */
+NumberStack *newNumberStack(size_t maxCapacity);
+
+/**
+ * Grow the array if needed so that count more values fit; pushing
+ * them then does not grow it again.
+ *
+ * @param stack the NumberStack
+ * @param count the number of values to make room for
+ * @return false if the values would exceed max capacity or out
+ *   of memory; the stack is then unchanged
+ */
+bool reserveNumberStack(NumberStack *stack, size_t count);
+
+/**
+ * Push value onto the stack.
+ * @param stack the NumberStack
+ * @param val the value to push
+ * @return false if exceeds max capacity
+ */
+bool pushNumberStackVal(NumberStack *stack, double val);
+
+/**
+ * Get the top stack value without removing it.
+ * @param stack the NumberStack
+ * @param val result parameter for the value
+ * @return false if empty
+ */
+bool peekNumberStackVal(NumberStack *stack, double *val);
+
+/**
+ * Set the stack top to a new value.
+ * @param stack the NumberStack
+ * @param val the value to set
+ * @return false if empty
+ */
+bool pokeNumberStackVal(NumberStack *stack, double val);
+
+/**
+ * Deletes and returns the stack top.
+ * @param stack the NumberStack
+ * @param val result parameter for the value
+ * @return false if empty
+ */
+bool popNumberStackVal(NumberStack *stack, double *val);
+
+/**
+ * Exchange the top two stack values: (a b -- b a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values
+ */
+bool swapNumberStackVal(NumberStack *stack);
+
+/**
+ * Pushes another copy of the top stack value: (a -- a a).
+ * @param stack the NumberStack
+ * @return false if the stack is empty or exceeds max capacity
+ */
+bool dupNumberStackVal(NumberStack *stack);
+
+/**
+ * Rotate the third stack value to the top: (a b c -- b c a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have three values
+ */
+bool rotNumberStackVal(NumberStack *stack);
+
+/**
+ * Pushes a copy of the second stack value: (a b -- a b a).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool overNumberStackVal(NumberStack *stack);
+
+/**
+ * Pushes a copy of the value n below the top; pick 0 is dup.
+ * @param stack the NumberStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values or
+ *   exceeds max capacity
+ */
+bool pickNumberStackVal(NumberStack *stack, size_t n);
+
+/**
+ * Moves the value n below the top to the top; roll 1 is swap.
+ * @param stack the NumberStack
+ * @param n the depth of the value, 0 for the top
+ * @return false if the stack does not have n+1 values
+ */
+bool rollNumberStackVal(NumberStack *stack, size_t n);
+
+/**
+ * Deletes the second stack value: (a b -- b).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values
+ */
+bool nipNumberStackVal(NumberStack *stack);
+
+/**
+ * Inserts a copy of the top value below the second value:
+ * (a b -- b a b).
+ * @param stack the NumberStack
+ * @return false if the stack does not have two values or
+ *   exceeds max capacity
+ */
+bool tuckNumberStackVal(NumberStack *stack);
+
+/**
+ * Deletes top value from the stack.
+ * @param stack the NumberStack
+ * @return false if the stack is empty
+ */
+bool dropNumberStackVal(NumberStack *stack);
+
+/**
+ * Drops all number stack values.
+ * @param stack the NumberStack
+ */
+void dropAllNumberStackVals(NumberStack *stack);
+
+/**
+ * Returns number of items in the number stack.
+ * @param stack the NumberStack
+ * @return the number of items in the number stack.
+ */
+size_t numberStackSize(NumberStack *stack);
+
+/**
+ * Determines whether number stack is empty.
+ * @param stack the NumberStack
+ * @return true if number stack is empty, false otherwise
+ */
+bool isNumberStackEmpty(NumberStack *stack);
+
+/**
+ * Delete the number stack.
+ *
+ * @param stack the NumberStack
+ */
+void deleteNumberStack(NumberStack *stack);
+
+/**
+ * Print number stack for diagnostic purposes.
+ *
+ * @param stack the NumberStack
+ */
+void printNumberStack(NumberStack *stack);
+
+#endif /* NUMBER_STACK_H_ */
@@ -0,0 +1,489 @@
+/**
+ * @file stack_machine.c
+ *
+ * Implementation for a bytecode stack machine that runs RPN
+ * expressions over a NumberStack.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "number_stack.h"
+#include "stack_machine.h"
+
+/** Characters that separate words */
+#define STACK_SPACE " \t\r\n"
+
+/** Longest word, including the terminator */
+#define STACK_MAX_WORD 64
+
+/** Deepest nesting of if ... then */
+#define STACK_MAX_NESTING 32
+
+/** Names of the operations, as written in source */
+static const char *const stackOpNames[STACK_OP_COUNT] = {
+    [STACK_OP_PUSH] = "push", [STACK_OP_LOAD] = "load",
+    [STACK_OP_ADD] = "+", [STACK_OP_SUB] = "-", [STACK_OP_MUL] = "*", [STACK_OP_DIV] = "/",
+    [STACK_OP_NEG] = "neg", [STACK_OP_ABS] = "abs", [STACK_OP_MIN] = "min", [STACK_OP_MAX] = "max",
+    [STACK_OP_LT] = "<", [STACK_OP_LE] = "<=", [STACK_OP_GT] = ">", [STACK_OP_GE] = ">=",
+    [STACK_OP_EQ] = "=", [STACK_OP_NE] = "<>",
+    [STACK_OP_AND] = "and", [STACK_OP_OR] = "or", [STACK_OP_NOT] = "not",
+    [STACK_OP_DUP] = "dup", [STACK_OP_DROP] = "drop", [STACK_OP_SWAP] = "swap",
+    [STACK_OP_OVER] = "over", [STACK_OP_ROT] = "rot", [STACK_OP_NIP] = "nip",
+    [STACK_OP_TUCK] = "tuck",
+    [STACK_OP_JUMP] = "jump", [STACK_OP_JUMP_IF_ZERO] = "jz", [STACK_OP_HALT] = "halt"
+};
+
+/** Number of values each operation needs on the stack */
+static const unsigned char stackOpPops[STACK_OP_COUNT] = {
+    [STACK_OP_ADD] = 2, [STACK_OP_SUB] = 2, [STACK_OP_MUL] = 2, [STACK_OP_DIV] = 2,
+    [STACK_OP_NEG] = 1, [STACK_OP_ABS] = 1, [STACK_OP_MIN] = 2, [STACK_OP_MAX] = 2,
+    [STACK_OP_LT] = 2, [STACK_OP_LE] = 2, [STACK_OP_GT] = 2, [STACK_OP_GE] = 2,
+    [STACK_OP_EQ] = 2, [STACK_OP_NE] = 2,
+    [STACK_OP_AND] = 2, [STACK_OP_OR] = 2, [STACK_OP_NOT] = 1,
+    [STACK_OP_DUP] = 1, [STACK_OP_DROP] = 1, [STACK_OP_SWAP] = 2,
+    [STACK_OP_OVER] = 2, [STACK_OP_ROT] = 3, [STACK_OP_NIP] = 2, [STACK_OP_TUCK] = 2,
+    [STACK_OP_JUMP_IF_ZERO] = 1
+};
+
+/** Number of values each operation leaves in their place */
+static const unsigned char stackOpPushes[STACK_OP_COUNT] = {
+    [STACK_OP_PUSH] = 1, [STACK_OP_LOAD] = 1,
+    [STACK_OP_ADD] = 1, [STACK_OP_SUB] = 1, [STACK_OP_MUL] = 1, [STACK_OP_DIV] = 1,
+    [STACK_OP_NEG] = 1, [STACK_OP_ABS] = 1, [STACK_OP_MIN] = 1, [STACK_OP_MAX] = 1,
+    [STACK_OP_LT] = 1, [STACK_OP_LE] = 1, [STACK_OP_GT] = 1, [STACK_OP_GE] = 1,
+    [STACK_OP_EQ] = 1, [STACK_OP_NE] = 1,
+    [STACK_OP_AND] = 1, [STACK_OP_OR] = 1, [STACK_OP_NOT] = 1,
+    [STACK_OP_DUP] = 2, [STACK_OP_SWAP] = 2,
+    [STACK_OP_OVER] = 3, [STACK_OP_ROT] = 3, [STACK_OP_NIP] = 1, [STACK_OP_TUCK] = 3
+};
+
+/** An if whose then has not been compiled yet */
+typedef struct {
+    /** index of the jump to patch at the next else or then */
+    size_t jumpAt;
+    /** stack depth after if popped its condition */
+    size_t depth;
+    /** stack depth at the end of the true branch */
+    size_t thenDepth;
+    /** set once else is compiled */
+    bool hasElse;
+} StackIfFrame;
+
+/** Compiler state */
+typedef struct {
+    /** the program being compiled */
+    StackProgram *program;
+    /** the variable names */
+    const char *const *varNames;
+    /** the number of variables */
+    size_t numVars;
+    /** open ifs, innermost last */
+    StackIfFrame frames[STACK_MAX_NESTING];
+    /** number of open ifs */
+    size_t nesting;
+    /** stack depth at the current instruction */
+    size_t depth;
+} StackCompiler;
+
+/**
+ * Append an instruction, checking and tracking the stack depth.
+ *
+ * @param compiler the compiler
+ * @param op the operation
+ * @param num the number for STACK_OP_PUSH
+ * @param index the index for other operations with an operand
+ * @return an error message, or NULL if the instruction was added
+ */
+static const char *emitStackCode(StackCompiler *compiler, StackOp op, double num, size_t index) {
+    if (compiler->depth < stackOpPops[op]) {
+        return "stack underflow";
+    }
+    StackProgram *program = compiler->program;
+    if (program->length == program->capacity) {
+        size_t newCapacity = program->capacity * 2;
+        StackCode *newCode = realloc(program->code, newCapacity * sizeof(StackCode));
+        if (newCode == NULL) { // not enough memory to reallocate
+            return "out of memory";
+        }
+        program->code = newCode;
+        program->capacity = newCapacity;
+    }
+
+    StackCode *code = &program->code[program->length++];
+    code->op = op;
+    if (op == STACK_OP_PUSH) {
+        code->arg.num = num;
+    } else {
+        code->arg.index = index;
+    }
+    compiler->depth = compiler->depth - stackOpPops[op] + stackOpPushes[op];
+    if (compiler->depth > program->maxDepth) {
+        program->maxDepth = compiler->depth;
+    }
+    return NULL;
+}
+
+/**
+ * Compile one word.
+ *
+ * @param compiler the compiler
+ * @param word the word
+ * @return an error message, or NULL if the word was compiled
+ */
+static const char *compileStackWord(StackCompiler *compiler, const char *word) {
+    StackProgram *program = compiler->program;
+
+    if (strcmp(word, "if") == 0) {
+        if (compiler->nesting == STACK_MAX_NESTING) {
+            return "if nested too deeply";
+        }
+        StackIfFrame *frame = &compiler->frames[compiler->nesting];
+        frame->jumpAt = program->length;
+        frame->hasElse = false;
+        // target patched by else or then
+        const char *error = emitStackCode(compiler, STACK_OP_JUMP_IF_ZERO, 0, 0);
+        frame->depth = compiler->depth;
+        if (error == NULL) {
+            compiler->nesting++;
+        }
+        return error;
+    }
+    if (strcmp(word, "else") == 0) {
+        if (compiler->nesting == 0 || compiler->frames[compiler->nesting-1].hasElse) {
+            return "else without if";
+        }
+        StackIfFrame *frame = &compiler->frames[compiler->nesting-1];
+        frame->thenDepth = compiler->depth;
+        const char *error = emitStackCode(compiler, STACK_OP_JUMP, 0, 0);
+        if (error != NULL) {
+            return error;
+        }
+        // a false condition continues after the jump
+        program->code[frame->jumpAt].arg.index = program->length;
+        frame->jumpAt = program->length - 1;
+        frame->hasElse = true;
+        compiler->depth = frame->depth;
+        return NULL;
+    }
+    if (strcmp(word, "then") == 0) {
+        if (compiler->nesting == 0) {
+            return "then without if";
+        }
+        StackIfFrame *frame = &compiler->frames[--compiler->nesting];
+        size_t otherDepth = frame->hasElse ? frame->thenDepth : frame->depth;
+        if (compiler->depth != otherDepth) {
+            return "branches leave different stack depths";
+        }
+        program->code[frame->jumpAt].arg.index = program->length;
+        return NULL;
+    }
+
+    char *end;
+    double num = strtod(word, &end);
+    if (end != word && *end == '\0') {
+        return emitStackCode(compiler, STACK_OP_PUSH, num, 0);
+    }
+    for (size_t i = 0; i < compiler->numVars; i++) {
+        if (strcmp(word, compiler->varNames[i]) == 0) {
+            return emitStackCode(compiler, STACK_OP_LOAD, 0, i);
+        }
+    }
+    // operations written as words, excluding push, load and jumps
+    for (StackOp op = STACK_OP_ADD; op <= STACK_OP_TUCK; op++) {
+        if (strcmp(word, stackOpNames[op]) == 0) {
+            return emitStackCode(compiler, op, 0, 0);
+        }
+    }
+    return "unknown word";
+}
+
+/**
+ * Compile RPN source to a program.
+ *
+ * @param source the source
+ * @param varNames the variable names; a variable is passed to
+ *   runStackProgram at the same index
+ * @param numVars the number of variables
+ * @param program result parameter for the program; must be
+ *   deleted with deleteStackProgram
+ * @param error result parameter for a message if compiling fails;
+ *   may be NULL
+ * @return false if the source is not a valid program or out of memory
+ */
+bool compileStackProgram(const char *source, const char *const varNames[], size_t numVars,
+                         StackProgram **program, const char **error) {
+    StackProgram *prog = malloc(sizeof(StackProgram));
+    if (prog == NULL) {
+        if (error != NULL) {
+            *error = "out of memory";
+        }
+        return false;
+    }
+    prog->length = 0;
+    prog->capacity = 16;
+    prog->numVars = numVars;
+    prog->maxDepth = 0;
+    prog->resultDepth = 0;
+    prog->code = malloc(prog->capacity * sizeof(StackCode));
+
+    StackCompiler compiler;
+    compiler.program = prog;
+    compiler.varNames = varNames;
+    compiler.numVars = numVars;
+    compiler.nesting = 0;
+    compiler.depth = 0;
+
+    const char *message = (prog->code == NULL) ? "out of memory" : NULL;
+    const char *p = source;
+    while (message == NULL) {
+        p += strspn(p, STACK_SPACE);
+        size_t len = strcspn(p, STACK_SPACE);
+        if (len == 0) {
+            break;
+        }
+        if (len >= STACK_MAX_WORD) {
+            message = "word too long";
+            break;
+        }
+        char word[STACK_MAX_WORD];
+        memcpy(word, p, len);
+        word[len] = '\0';
+        p += len;
+        message = compileStackWord(&compiler, word);
+    }
+    if (message == NULL && compiler.nesting > 0) {
+        message = "if without then";
+    }
+    if (message == NULL) {
+        message = emitStackCode(&compiler, STACK_OP_HALT, 0, 0);
+    }
+
+    if (message != NULL) {
+        if (error != NULL) {
+            *error = message;
+        }
+        deleteStackProgram(prog);
+        return false;
+    }
+    prog->resultDepth = compiler.depth;
+    *program = prog;
+    return true;
+}
+
+/**
+ * Run a program, leaving its results on the stack.
+ *
+ * @param program the program
+ * @param vars the values of the variables
+ * @param stack the stack
+ * @return false if the stack cannot hold maxDepth more values
+ */
+bool runStackProgram(const StackProgram *program, const double vars[], NumberStack *stack) {
+    // the compiler bounded the depth: no checks below
+    if (!reserveNumberStack(stack, program->maxDepth)) {
+        return false;
+    }
+    double *sp = stack->vals + stack->size;  // one past the top
+    const StackCode *code = program->code;
+    const StackCode *ip = code;
+
+#ifdef __GNUC__
+    // threaded code: each operation jumps straight to the next
+    static const void *const labels[STACK_OP_COUNT] = {
+        [STACK_OP_PUSH] = &&opPush, [STACK_OP_LOAD] = &&opLoad,
+        [STACK_OP_ADD] = &&opAdd, [STACK_OP_SUB] = &&opSub,
+        [STACK_OP_MUL] = &&opMul, [STACK_OP_DIV] = &&opDiv,
+        [STACK_OP_NEG] = &&opNeg, [STACK_OP_ABS] = &&opAbs,
+        [STACK_OP_MIN] = &&opMin, [STACK_OP_MAX] = &&opMax,
+        [STACK_OP_LT] = &&opLt, [STACK_OP_LE] = &&opLe,
+        [STACK_OP_GT] = &&opGt, [STACK_OP_GE] = &&opGe,
+        [STACK_OP_EQ] = &&opEq, [STACK_OP_NE] = &&opNe,
+        [STACK_OP_AND] = &&opAnd, [STACK_OP_OR] = &&opOr, [STACK_OP_NOT] = &&opNot,
+        [STACK_OP_DUP] = &&opDup, [STACK_OP_DROP] = &&opDrop,
+        [STACK_OP_SWAP] = &&opSwap, [STACK_OP_OVER] = &&opOver,
+        [STACK_OP_ROT] = &&opRot, [STACK_OP_NIP] = &&opNip, [STACK_OP_TUCK] = &&opTuck,
+        [STACK_OP_JUMP] = &&opJump, [STACK_OP_JUMP_IF_ZERO] = &&opJumpIfZero,
+        [STACK_OP_HALT] = &&opHalt
+    };
+#define STACK_CASE(label, op) label:
+#define STACK_NEXT() goto *labels[(++ip)->op]
+#define STACK_JUMP(target) do { ip = code + (target); goto *labels[ip->op]; } while (0)
+    goto *labels[ip->op];
+#else
+#define STACK_CASE(label, op) case op:
+#define STACK_NEXT() do { ip++; goto dispatch; } while (0)
+#define STACK_JUMP(target) do { ip = code + (target); goto dispatch; } while (0)
+dispatch:
+#endif
+// replace the top two values a b with expr
+#define STACK_BINARY(expr) do { double b = *--sp; double a = sp[-1]; sp[-1] = (expr); } while (0)
+
+    switch (ip->op) {
+    STACK_CASE(opPush, STACK_OP_PUSH)
+        *sp++ = ip->arg.num;
+        STACK_NEXT();
+    STACK_CASE(opLoad, STACK_OP_LOAD)
+        *sp++ = vars[ip->arg.index];
+        STACK_NEXT();
+    STACK_CASE(opAdd, STACK_OP_ADD)
+        STACK_BINARY(a + b);
+        STACK_NEXT();
+    STACK_CASE(opSub, STACK_OP_SUB)
+        STACK_BINARY(a - b);
+        STACK_NEXT();
+    STACK_CASE(opMul, STACK_OP_MUL)
+        STACK_BINARY(a * b);
+        STACK_NEXT();
+    STACK_CASE(opDiv, STACK_OP_DIV)
+        STACK_BINARY(a / b);
+        STACK_NEXT();
+    STACK_CASE(opNeg, STACK_OP_NEG)
+        sp[-1] = -sp[-1];
+        STACK_NEXT();
+    STACK_CASE(opAbs, STACK_OP_ABS)
+        sp[-1] = (sp[-1] < 0) ? -sp[-1] : sp[-1];
+        STACK_NEXT();
+    STACK_CASE(opMin, STACK_OP_MIN)
+        STACK_BINARY((b < a) ? b : a);
+        STACK_NEXT();
+    STACK_CASE(opMax, STACK_OP_MAX)
+        STACK_BINARY((b > a) ? b : a);
+        STACK_NEXT();
+    STACK_CASE(opLt, STACK_OP_LT)
+        STACK_BINARY(a < b);
+        STACK_NEXT();
+    STACK_CASE(opLe, STACK_OP_LE)
+        STACK_BINARY(a <= b);
+        STACK_NEXT();
+    STACK_CASE(opGt, STACK_OP_GT)
+        STACK_BINARY(a > b);
+        STACK_NEXT();
+    STACK_CASE(opGe, STACK_OP_GE)
+        STACK_BINARY(a >= b);
+        STACK_NEXT();
+    STACK_CASE(opEq, STACK_OP_EQ)
+        STACK_BINARY(a == b);
+        STACK_NEXT();
+    STACK_CASE(opNe, STACK_OP_NE)
+        STACK_BINARY(a != b);
+        STACK_NEXT();
+    STACK_CASE(opAnd, STACK_OP_AND)
+        STACK_BINARY(a != 0 && b != 0);
+        STACK_NEXT();
+    STACK_CASE(opOr, STACK_OP_OR)
+        STACK_BINARY(a != 0 || b != 0);
+        STACK_NEXT();
+    STACK_CASE(opNot, STACK_OP_NOT)
+        sp[-1] = (sp[-1] == 0);
+        STACK_NEXT();
+    STACK_CASE(opDup, STACK_OP_DUP)
+        sp[0] = sp[-1];
+        sp++;
+        STACK_NEXT();
+    STACK_CASE(opDrop, STACK_OP_DROP)
+        sp--;
+        STACK_NEXT();
+    STACK_CASE(opSwap, STACK_OP_SWAP) {
+        double top = sp[-1];
+        sp[-1] = sp[-2];
+        sp[-2] = top;
+        STACK_NEXT();
+    }
+    STACK_CASE(opOver, STACK_OP_OVER)
+        sp[0] = sp[-2];
+        sp++;
+        STACK_NEXT();
+    STACK_CASE(opRot, STACK_OP_ROT) {
+        double third = sp[-3];
+        sp[-3] = sp[-2];
+        sp[-2] = sp[-1];
+        sp[-1] = third;
+        STACK_NEXT();
+    }
+    STACK_CASE(opNip, STACK_OP_NIP)
+        sp[-2] = sp[-1];
+        sp--;
+        STACK_NEXT();
+    STACK_CASE(opTuck, STACK_OP_TUCK)
+        sp[0] = sp[-1];
+        sp[-1] = sp[-2];
+        sp[-2] = sp[0];
+        sp++;
+        STACK_NEXT();
+    STACK_CASE(opJump, STACK_OP_JUMP)
+        STACK_JUMP(ip->arg.index);
+    STACK_CASE(opJumpIfZero, STACK_OP_JUMP_IF_ZERO)
+        if (*--sp == 0) {
+            STACK_JUMP(ip->arg.index);
+        }
+        STACK_NEXT();
+    STACK_CASE(opHalt, STACK_OP_HALT)
+    default:
+        break;
+    }
+
+#undef STACK_BINARY
+#undef STACK_JUMP
+#undef STACK_NEXT
+#undef STACK_CASE
+    stack->size = sp - stack->vals;
+    return true;
+}
+
+/**
+ * Returns the name of an operation.
+ *
+ * @param op the operation
+ * @return the name
+ */
+const char *stackOpName(StackOp op) {
+    return (op < STACK_OP_COUNT) ? stackOpNames[op] : "?";
+}
+
+/**
+ * Print a program for diagnostic purposes.
+ *
+ * @param program the program
+ */
+void printStackProgram(const StackProgram *program) {
+    printf("program (%zu instructions, max depth %zu, results %zu):\n",
+           program->length, program->maxDepth, program->resultDepth);
+    for (size_t i = 0; i < program->length; i++) {
+        const StackCode *code = &program->code[i];
+        printf("%4zu  %s", i, stackOpName(code->op));
+        switch (code->op) {
+        case STACK_OP_PUSH:
+            printf(" %g", code->arg.num);
+            break;
+        case STACK_OP_LOAD:
+        case STACK_OP_JUMP:
+        case STACK_OP_JUMP_IF_ZERO:
+            printf(" %zu", code->arg.index);
+            break;
+        default:
+            break;
+        }
+        printf("\n");
+    }
+}
+
+/**
+ * Delete a program.
+ *
+ * @param program the program
+ */
+void deleteStackProgram(StackProgram *program) {
+    free(program->code);
+
+    // set fields to safe values
+    program->code = NULL;
+    program->length = 0;
+    program->capacity = 0;
+
+    // free the program itself
+    free(program);
+}
@@ -0,0 +1,147 @@
+/**
+ * @file stack_machine.h
+ *
+ * Declarations for a bytecode stack machine that runs RPN
+ * expressions over a NumberStack.
+ *
+ * Source is a Forth-like sequence of words separated by spaces:
+ * numbers, variable names, arithmetic and comparison operators,
+ * the stack words dup drop swap over rot nip tuck, and
+ * "if ... else ... then" for conditionals. For example
+ *
+ *   temp 30 > humidity 80 < and if 1 else 0 then
+ *
+ * The compiler checks every path for stack underflow and records
+ * the deepest stack a program can reach, so the interpreter reserves
+ * room once and then runs without bounds checks. Instructions are
+ * dispatched with computed gotos (threaded code) where the compiler
+ * supports them, else with a switch.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef STACK_MACHINE_H_
+#define STACK_MACHINE_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "number_stack.h"
+
+/** Stack machine operations */
+typedef enum {
+    /** push arg.num */
+    STACK_OP_PUSH,
+    /** push variable arg.index */
+    STACK_OP_LOAD,
+    STACK_OP_ADD,
+    STACK_OP_SUB,
+    STACK_OP_MUL,
+    STACK_OP_DIV,
+    STACK_OP_NEG,
+    STACK_OP_ABS,
+    STACK_OP_MIN,
+    STACK_OP_MAX,
+    STACK_OP_LT,
+    STACK_OP_LE,
+    STACK_OP_GT,
+    STACK_OP_GE,
+    STACK_OP_EQ,
+    STACK_OP_NE,
+    STACK_OP_AND,
+    STACK_OP_OR,
+    STACK_OP_NOT,
+    STACK_OP_DUP,
+    STACK_OP_DROP,
+    STACK_OP_SWAP,
+    STACK_OP_OVER,
+    STACK_OP_ROT,
+    STACK_OP_NIP,
+    STACK_OP_TUCK,
+    /** continue at arg.index */
+    STACK_OP_JUMP,
+    /** pop; continue at arg.index if the value was 0 */
+    STACK_OP_JUMP_IF_ZERO,
+    STACK_OP_HALT,
+    /** number of operations */
+    STACK_OP_COUNT
+} StackOp;
+
+/** One instruction */
+typedef struct {
+    /** The operation */
+    StackOp op;
+    /** The operand, if the operation has one */
+    union {
+        /** number to push */
+        double num;
+        /** variable index or jump target */
+        size_t index;
+    } arg;
+} StackCode;
+
+/** Compiled program */
+typedef struct {
+    /** The instructions; the last is STACK_OP_HALT */
+    StackCode *code;
+    /** Number of instructions */
+    size_t length;
+    /** Capacity of allocated instructions */
+    size_t capacity;
+    /** Number of variables the program reads */
+    size_t numVars;
+    /** Most values the program has on the stack at once */
+    size_t maxDepth;
+    /** Values the program leaves on the stack */
+    size_t resultDepth;
+} StackProgram;
+
+/**
+ * Compile RPN source to a program.
+ *
+ * @param source the source
+ * @param varNames the variable names; a variable is passed to
+ *   runStackProgram at the same index
+ * @param numVars the number of variables
+ * @param program result parameter for the program; must be
+ *   deleted with deleteStackProgram
+ * @param error result parameter for a message if compiling fails;
+ *   may be NULL
+ * @return false if the source is not a valid program or out of memory
+ */
+bool compileStackProgram(const char *source, const char *const varNames[], size_t numVars,
+                         StackProgram **program, const char **error);
+
+/**
+ * Run a program, leaving its results on the stack.
+ *
+ * @param program the program
+ * @param vars the values of the variables
+ * @param stack the stack
+ * @return false if the stack cannot hold maxDepth more values
+ */
+bool runStackProgram(const StackProgram *program, const double vars[], NumberStack *stack);
+
+/**
+ * Returns the name of an operation.
+ *
+ * @param op the operation
+ * @return the name
+ */
+const char *stackOpName(StackOp op);
+
+/**
+ * Print a program for diagnostic purposes.
+ *
+ * @param program the program
+ */
+void printStackProgram(const StackProgram *program);
+
+/**
+ * Delete a program.
+ *
+ * @param program the program
+ */
+void deleteStackProgram(StackProgram *program);
+
+#endif /* STACK_MACHINE_H_ */
@@ -0,0 +1,282 @@
+/*
+ * @file stack_machine_bench.c
+ *
+ * Benchmark of the stack machine. Runs the same compiled programs
+ * three ways:
+ *
+ *   string   - switch dispatch over an ArrayStack of strings, as the
+ *              string stack modules would have to: every value is
+ *              formatted, copied and parsed again
+ *   calls    - switch dispatch through the NumberStack functions,
+ *              which check bounds on every operation
+ *   threaded - runStackProgram: computed-goto dispatch on the
+ *              inline NumberStack array, bounds checked once
+ *
+ * Usage: stack_machine_bench [evaluations]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "array_stack.h"
+#include "number_stack.h"
+#include "stack_machine.h"
+
+/** Variable names used by the programs */
+static const char *const varNames[] = { "temp", "humidity", "x", "y" };
+
+/** Number of variables */
+#define NUM_VARS (sizeof(varNames) / sizeof(varNames[0]))
+
+/** Programs to run */
+static const char *const sources[] = {
+    "temp 30 > humidity 80 < and if temp 30 - 2 * else humidity 80 - abs then "
+        "x y over over < if swap then drop max",
+    "x x * y y * + x y * 2 * - dup 0 < if neg then temp humidity min /",
+    "1 2 3 4 5 rot tuck nip + + + + x y + 2 / over over max rot rot min -"
+};
+
+/** Number of programs */
+#define NUM_SOURCES (sizeof(sources) / sizeof(sources[0]))
+
+/**
+ * Apply an operation that replaces one or two values with one.
+ *
+ * @param op the operation
+ * @param a the first value, or the only one
+ * @param b the second value
+ * @return the result
+ */
+static double applyStackOp(StackOp op, double a, double b) {
+    switch (op) {
+    case STACK_OP_ADD: return a + b;
+    case STACK_OP_SUB: return a - b;
+    case STACK_OP_MUL: return a * b;
+    case STACK_OP_DIV: return a / b;
+    case STACK_OP_NEG: return -a;
+    case STACK_OP_ABS: return (a < 0) ? -a : a;
+    case STACK_OP_MIN: return (b < a) ? b : a;
+    case STACK_OP_MAX: return (b > a) ? b : a;
+    case STACK_OP_LT: return a < b;
+    case STACK_OP_LE: return a <= b;
+    case STACK_OP_GT: return a > b;
+    case STACK_OP_GE: return a >= b;
+    case STACK_OP_EQ: return a == b;
+    case STACK_OP_NE: return a != b;
+    case STACK_OP_AND: return a != 0 && b != 0;
+    case STACK_OP_OR: return a != 0 || b != 0;
+    case STACK_OP_NOT: return a == 0;
+    default: return 0;
+    }
+}
+
+/**
+ * Determines whether an operation takes one value.
+ *
+ * @param op the operation
+ * @return true for neg, abs and not
+ */
+static bool isUnaryStackOp(StackOp op) {
+    return op == STACK_OP_NEG || op == STACK_OP_ABS || op == STACK_OP_NOT;
+}
+
+/**
+ * Pop a number from a string stack.
+ *
+ * @param stack the ArrayStack
+ * @return the number
+ */
+static double popString(ArrayStack *stack) {
+    char *val;
+    popArrayStackVal(stack, &val);
+    double num = strtod(val, NULL);
+    free(val);  // pop returns allocated storage
+    return num;
+}
+
+/**
+ * Push a number onto a string stack.
+ *
+ * @param stack the ArrayStack
+ * @param num the number
+ */
+static void pushString(ArrayStack *stack, double num) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.17g", num);  // exact round trip
+    pushArrayStackVal(stack, buf);
+}
+
+/**
+ * Run a program on a stack of strings.
+ *
+ * @param program the program
+ * @param vars the values of the variables
+ * @param stack the ArrayStack
+ */
+static void runStrings(const StackProgram *program, const double vars[], ArrayStack *stack) {
+    for (size_t pc = 0; ; ) {
+        const StackCode *code = &program->code[pc++];
+        switch (code->op) {
+        case STACK_OP_PUSH: pushString(stack, code->arg.num); break;
+        case STACK_OP_LOAD: pushString(stack, vars[code->arg.index]); break;
+        case STACK_OP_DUP: dupArrayStackVal(stack); break;
+        case STACK_OP_DROP: dropArrayStackVal(stack); break;
+        case STACK_OP_SWAP: swapArrayStackVal(stack); break;
+        case STACK_OP_OVER: overArrayStackVal(stack); break;
+        case STACK_OP_ROT: rotArrayStackVal(stack); break;
+        case STACK_OP_NIP: nipArrayStackVal(stack); break;
+        case STACK_OP_TUCK: tuckArrayStackVal(stack); break;
+        case STACK_OP_JUMP: pc = code->arg.index; break;
+        case STACK_OP_JUMP_IF_ZERO:
+            if (popString(stack) == 0) {
+                pc = code->arg.index;
+            }
+            break;
+        case STACK_OP_HALT: return;
+        default:
+            if (isUnaryStackOp(code->op)) {
+                pushString(stack, applyStackOp(code->op, popString(stack), 0));
+            } else {
+                double b = popString(stack);
+                double a = popString(stack);
+                pushString(stack, applyStackOp(code->op, a, b));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Run a program through the NumberStack functions.
+ *
+ * @param program the program
+ * @param vars the values of the variables
+ * @param stack the NumberStack
+ */
+static void runCalls(const StackProgram *program, const double vars[], NumberStack *stack) {
+    double a, b;
+    for (size_t pc = 0; ; ) {
+        const StackCode *code = &program->code[pc++];
+        switch (code->op) {
+        case STACK_OP_PUSH: pushNumberStackVal(stack, code->arg.num); break;
+        case STACK_OP_LOAD: pushNumberStackVal(stack, vars[code->arg.index]); break;
+        case STACK_OP_DUP: dupNumberStackVal(stack); break;
+        case STACK_OP_DROP: dropNumberStackVal(stack); break;
+        case STACK_OP_SWAP: swapNumberStackVal(stack); break;
+        case STACK_OP_OVER: overNumberStackVal(stack); break;
+        case STACK_OP_ROT: rotNumberStackVal(stack); break;
+        case STACK_OP_NIP: nipNumberStackVal(stack); break;
+        case STACK_OP_TUCK: tuckNumberStackVal(stack); break;
+        case STACK_OP_JUMP: pc = code->arg.index; break;
+        case STACK_OP_JUMP_IF_ZERO:
+            popNumberStackVal(stack, &a);
+            if (a == 0) {
+                pc = code->arg.index;
+            }
+            break;
+        case STACK_OP_HALT: return;
+        default:
+            if (isUnaryStackOp(code->op)) {
+                popNumberStackVal(stack, &a);
+                pushNumberStackVal(stack, applyStackOp(code->op, a, 0));
+            } else {
+                popNumberStackVal(stack, &b);
+                popNumberStackVal(stack, &a);
+                pushNumberStackVal(stack, applyStackOp(code->op, a, b));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Set the variables for one evaluation.
+ *
+ * @param i the evaluation number
+ * @param vars result parameter for the variables
+ */
+static void setVars(size_t i, double vars[]) {
+    vars[0] = (double)(i % 50);          // temp
+    vars[1] = (double)(i % 97);          // humidity
+    vars[2] = (double)(i % 13) - 6;      // x
+    vars[3] = (double)(i % 7) + 0.5;     // y
+}
+
+/**
+ * Returns the current time in milliseconds.
+ *
+ * @return the time
+ */
+static double nowMillis(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    size_t evals = (argc > 1) ? strtoul(argv[1], NULL, 10) : 200000;
+
+    printf("%-8s %-8s %12s %10s %8s\n", "program", "path", "time (ms)", "ns/eval", "speedup");
+    for (size_t s = 0; s < NUM_SOURCES; s++) {
+        StackProgram *program;
+        const char *error;
+        if (!compileStackProgram(sources[s], varNames, NUM_VARS, &program, &error)) {
+            printf("compile error: %s\n", error);
+            return EXIT_FAILURE;
+        }
+        double vars[NUM_VARS];
+        double sumStrings = 0, sumCalls = 0, sumThreaded = 0;
+
+        ArrayStack *strings = newArrayStack(SIZE_MAX);
+        double start = nowMillis();
+        for (size_t i = 0; i < evals; i++) {
+            setVars(i, vars);
+            runStrings(program, vars, strings);
+            sumStrings += popString(strings);
+        }
+        double stringMillis = nowMillis() - start;
+        deleteArrayStack(strings);
+
+        NumberStack *numbers = newNumberStack(SIZE_MAX);
+        start = nowMillis();
+        for (size_t i = 0; i < evals; i++) {
+            setVars(i, vars);
+            runCalls(program, vars, numbers);
+            double result;
+            popNumberStackVal(numbers, &result);
+            sumCalls += result;
+        }
+        double callMillis = nowMillis() - start;
+
+        start = nowMillis();
+        for (size_t i = 0; i < evals; i++) {
+            setVars(i, vars);
+            runStackProgram(program, vars, numbers);
+            double result;
+            popNumberStackVal(numbers, &result);
+            sumThreaded += result;
+        }
+        double threadedMillis = nowMillis() - start;
+        deleteNumberStack(numbers);
+
+        const char *paths[] = { "string", "calls", "threaded" };
+        double millis[] = { stringMillis, callMillis, threadedMillis };
+        for (int p = 0; p < 3; p++) {
+            printf("%-8zu %-8s %12.2f %10.1f %8.1f\n", s + 1, paths[p], millis[p],
+                   millis[p] * 1e6 / evals, stringMillis / millis[p]);
+        }
+        if (sumCalls != sumStrings || sumThreaded != sumStrings) {
+            printf("results differ: %.17g %.17g %.17g\n", sumStrings, sumCalls, sumThreaded);
+        }
+        deleteStackProgram(program);
+        fflush(stdout);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+/*
+ * @file stack_machine_main.c
+ *
+ * Test program for NumberStack and the stack machine. Exercises
+ * the NumberStack operations, then compiles and runs RPN
+ * expressions, including rules with variables and conditionals,
+ * and shows the errors the compiler reports.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "number_stack.h"
+#include "stack_machine.h"
+
+/** Variable names used by the test expressions */
+static const char *const varNames[] = { "temp", "humidity", "x", "y" };
+
+/** Number of variables */
+#define NUM_VARS (sizeof(varNames) / sizeof(varNames[0]))
+
+/**
+ * Compile and run an expression, printing the results.
+ *
+ * @param source the expression
+ * @param vars the values of the variables
+ * @param print true to print the compiled program
+ */
+static void runExpression(const char *source, const double vars[], bool print) {
+    printf("\n%s\n", source);
+    StackProgram *program;
+    const char *error;
+    if (!compileStackProgram(source, varNames, NUM_VARS, &program, &error)) {
+        printf("compile error: %s\n", error);
+        return;
+    }
+    if (print) {
+        printStackProgram(program);
+    }
+    NumberStack *stack = newNumberStack(SIZE_MAX);
+    if (runStackProgram(program, vars, stack)) {
+        printNumberStack(stack);
+    } else {
+        printf("cannot run: stack too small\n");
+    }
+    deleteNumberStack(stack);
+    deleteStackProgram(program);
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating number stack\n");
+    NumberStack *stack = newNumberStack(5);
+    for (int i = 1; i <= 5; i++) {
+        pushNumberStackVal(stack, i);
+    }
+    printNumberStack(stack);
+    printf("push past max capacity: %s\n",
+           pushNumberStackVal(stack, 6) ? "true" : "false");
+
+    rotNumberStackVal(stack);
+    printf("\nrot\n");
+    printNumberStack(stack);
+    rollNumberStackVal(stack, 4);
+    printf("\nroll 4\n");
+    printNumberStack(stack);
+    nipNumberStackVal(stack);
+    printf("\nnip\n");
+    printNumberStack(stack);
+    tuckNumberStackVal(stack);
+    printf("\ntuck\n");
+    printNumberStack(stack);
+    double val;
+    popNumberStackVal(stack, &val);
+    printf("\npop value: %g\n", val);
+    overNumberStackVal(stack);
+    printf("\nover\n");
+    printNumberStack(stack);
+    dropAllNumberStackVals(stack);
+    printf("\nstack empty? %s\n", isNumberStackEmpty(stack) ? "true" : "false");
+    deleteNumberStack(stack);
+
+    double vars[NUM_VARS] = { 32, 65, 3, 4 };
+    printf("\nvariables: temp=%g humidity=%g x=%g y=%g\n", vars[0], vars[1], vars[2], vars[3]);
+    runExpression("2 3 + 4 *", vars, false);
+    runExpression("x x * y y * +", vars, false);
+    runExpression("temp 30 > humidity 80 < and if 1 else 0 then", vars, true);
+    runExpression("x y over over < if swap then drop", vars, true);
+    runExpression("1 2 3 rot tuck nip", vars, false);
+    runExpression("x neg abs y min 10 max", vars, false);
+
+    printf("\nCompile errors\n");
+    runExpression("1 +", vars, false);
+    runExpression("1 2 if 3 then", vars, false);
+    runExpression("1 if 2 else 3 4 then", vars, false);
+    runExpression("1 if 2", vars, false);
+    runExpression("then", vars, false);
+    runExpression("pressure 2 *", vars, false);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,496 @@
+/**
+ * @file tiered_vector.c
+ *
+ * Implementation for a tiered vector of strings.
+ *
+ * The block size is rebuilt to the next power of 2 when the number
+ * of blocks grows past twice the block size, and to the previous
+ * power of 2 when the vector shrinks to an eighth of a full square,
+ * so the block size stays within a small factor of sqrt n.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tiered_vector.h"
+
+/** The smallest block size; must be a power of 2 */
+static const size_t MIN_BLOCK_SIZE = 16;
+
+/** log2 of the smallest block size */
+static const size_t MIN_BLOCK_SHIFT = 4;
+
+/**
+ * Returns the storage position of the value at an offset in the block.
+ *
+ * @param vector the TieredVector
+ * @param block the TieredVectorBlock
+ * @param offset the offset of the value in the block
+ * @return the position of the value in the block storage
+ */
+static inline size_t blockPos(TieredVector *vector, TieredVectorBlock *block, size_t offset) {
+    return (block->head + offset) & (vector->blockSize - 1);
+}
+
+/**
+ * Insert value at an offset in a block that is not full. Moves the
+ * values before or after the offset, whichever are fewer.
+ *
+ * @param vector the TieredVector
+ * @param block the TieredVectorBlock
+ * @param offset the offset for the value; at most the block size
+ * @param val the value to insert; the block takes ownership
+ */
+static void insertBlockValAt(TieredVector *vector, TieredVectorBlock *block, size_t offset, char *val) {
+    if (offset < block->size / 2) {
+        // move head back and values before offset down
+        block->head = (block->head - 1) & (vector->blockSize - 1);
+        for (size_t i = 0; i < offset; i++) {
+            block->vals[blockPos(vector, block, i)] = block->vals[blockPos(vector, block, i+1)];
+        }
+    } else {
+        // move values after offset up
+        for (size_t i = block->size; i > offset; i--) {
+            block->vals[blockPos(vector, block, i)] = block->vals[blockPos(vector, block, i-1)];
+        }
+    }
+    block->vals[blockPos(vector, block, offset)] = val;
+    block->size++;
+}
+
+/**
+ * Remove value at an offset in a block. Moves the values before
+ * or after the offset, whichever are fewer.
+ *
+ * @param vector the TieredVector
+ * @param block the TieredVectorBlock
+ * @param offset the offset of the value; less than the block size
+ * @return the removed value; caller takes ownership
+ */
+static char *removeBlockValAt(TieredVector *vector, TieredVectorBlock *block, size_t offset) {
+    char *val = block->vals[blockPos(vector, block, offset)];
+    if (offset < block->size / 2) {
+        // move values before offset up and head forward
+        for (size_t i = offset; i > 0; i--) {
+            block->vals[blockPos(vector, block, i)] = block->vals[blockPos(vector, block, i-1)];
+        }
+        block->head = (block->head + 1) & (vector->blockSize - 1);
+    } else {
+        // move values after offset down
+        for (size_t i = offset; i+1 < block->size; i++) {
+            block->vals[blockPos(vector, block, i)] = block->vals[blockPos(vector, block, i+1)];
+        }
+    }
+    block->size--;
+    return val;
+}
+
+/**
+ * Ensure the array of blocks has room for the number of blocks.
+ *
+ * @param vector the TieredVector
+ * @param numBlocks the required number of blocks
+ * @return false if there is no room to grow it
+ */
+static bool ensureBlockCapacity(TieredVector *vector, size_t numBlocks) {
+    if (numBlocks <= vector->blockCapacity) {
+        return true;
+    }
+    size_t newCapacity = (vector->blockCapacity == 0) ? 2 : vector->blockCapacity;
+    while (newCapacity < numBlocks) {
+        newCapacity *= 2;
+    }
+    TieredVectorBlock *newBlocks = realloc(vector->blocks, newCapacity * sizeof(TieredVectorBlock));
+    if (newBlocks == NULL) { // not enough memory to reallocate
+        return false;
+    }
+    vector->blocks = newBlocks;
+    vector->blockCapacity = newCapacity;
+    return true;
+}
+
+/**
+ * Append an empty block to the vector.
+ *
+ * @param vector the TieredVector
+ * @return false if there is no room for the block
+ */
+static bool appendBlock(TieredVector *vector) {
+    if (!ensureBlockCapacity(vector, vector->numBlocks+1)) {
+        return false;
+    }
+    char **vals = malloc(vector->blockSize * sizeof(char*));
+    if (vals == NULL) {
+        return false;
+    }
+    TieredVectorBlock *block = &vector->blocks[vector->numBlocks++];
+    block->vals = vals;
+    block->head = 0;
+    block->size = 0;
+    return true;
+}
+
+/**
+ * Rebuild the blocks with a new block size, keeping all values.
+ * Values are moved without copying the strings.
+ *
+ * @param vector the TieredVector
+ * @param newShift log2 of the new block size
+ * @return false if there is no room for the new blocks
+ */
+static bool rebuildBlocks(TieredVector *vector, size_t newShift) {
+    size_t newBlockSize = (size_t)1 << newShift;
+    size_t newNumBlocks = (vector->size + newBlockSize - 1) >> newShift;
+    size_t newCapacity = (newNumBlocks < 2) ? 2 : newNumBlocks;
+
+    TieredVectorBlock *newBlocks = malloc(newCapacity * sizeof(TieredVectorBlock));
+    if (newBlocks == NULL) {
+        return false;
+    }
+    for (size_t b = 0; b < newNumBlocks; b++) {
+        newBlocks[b].vals = malloc(newBlockSize * sizeof(char*));
+        if (newBlocks[b].vals == NULL) {
+            for ( ; b > 0; b--) {
+                free(newBlocks[b-1].vals);
+            }
+            free(newBlocks);
+            return false;
+        }
+        newBlocks[b].head = 0;
+        newBlocks[b].size = 0;
+    }
+
+    // move the values in order into the new blocks
+    size_t index = 0;
+    for (size_t b = 0; b < vector->numBlocks; b++) {
+        TieredVectorBlock *block = &vector->blocks[b];
+        for (size_t i = 0; i < block->size; i++, index++) {
+            TieredVectorBlock *newBlock = &newBlocks[index >> newShift];
+            newBlock->vals[newBlock->size++] = block->vals[blockPos(vector, block, i)];
+        }
+        free(block->vals);
+    }
+    free(vector->blocks);
+
+    vector->blocks = newBlocks;
+    vector->numBlocks = newNumBlocks;
+    vector->blockCapacity = newCapacity;
+    vector->blockSize = newBlockSize;
+    vector->blockShift = newShift;
+    return true;
+}
+
+/**
+ * Create a tiered vector with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the TieredVector.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated tiered vector
+ */
+TieredVector *newTieredVector(size_t maxCapacity) {
+    TieredVector *vector = malloc(sizeof(TieredVector));
+    vector->blocks = NULL;  // allocated when first value is added
+    vector->numBlocks = 0;
+    vector->blockCapacity = 0;
+    vector->blockSize = MIN_BLOCK_SIZE;
+    vector->blockShift = MIN_BLOCK_SHIFT;
+    vector->size = 0;
+    vector->maxCapacity = maxCapacity;
+
+    return vector;
+}
+
+/**
+ * Add value to vector at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds capacity
+ */
+bool addTieredVectorValAt(TieredVector *vector, size_t index, const char *val) {
+    // cannot add NULL or beyond end of vector
+    if (val == NULL || index > vector->size) {
+        return false;
+    }
+    if (vector->size == vector->maxCapacity) {
+        return false;
+    }
+
+    // grow block size when number of blocks gets too large
+    if (vector->numBlocks > 2 * vector->blockSize) {
+        rebuildBlocks(vector, vector->blockShift+1);  // ok to continue if failed
+    }
+
+    // ensure last block has room for a value moved from earlier blocks
+    if (vector->numBlocks == 0
+        || vector->blocks[vector->numBlocks-1].size == vector->blockSize) {
+        if (!appendBlock(vector)) {
+            return false;
+        }
+    }
+
+    // insert into block, then carry overflow to the front of the next block
+    size_t b = index >> vector->blockShift;
+    size_t offset = index & (vector->blockSize - 1);
+    char *carry = strdup(val);  // must copy input string
+    for ( ; carry != NULL; b++, offset = 0) {
+        TieredVectorBlock *block = &vector->blocks[b];
+        char *overflow = NULL;
+        if (block->size == vector->blockSize) {
+            overflow = removeBlockValAt(vector, block, block->size-1);
+        }
+        insertBlockValAt(vector, block, offset, carry);
+        carry = overflow;
+    }
+    vector->size++;
+
+    return true;
+}
+
+/**
+ * Add value to start of vector.
+ *
+ * @param vector the TieredVector
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addFirstTieredVectorVal(TieredVector *vector, const char *val) {
+    return addTieredVectorValAt(vector, 0, val);
+}
+
+/**
+ * Add value to end of vector.
+ *
+ * @param vector the TieredVector
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addLastTieredVectorVal(TieredVector *vector, const char *val) {
+    return addTieredVectorValAt(vector, vector->size, val);
+}
+
+/**
+ * Get value at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getTieredVectorValAt(TieredVector *vector, size_t index, const char **val) {
+    if (index < vector->size) {
+        TieredVectorBlock *block = &vector->blocks[index >> vector->blockShift];
+        *val = block->vals[blockPos(vector, block, index & (vector->blockSize - 1))];
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Get value at first index.
+ *
+ * @param vector the TieredVector
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if vector is empty
+ */
+bool getFirstTieredVectorVal(TieredVector *vector, const char **val) {
+    return getTieredVectorValAt(vector, 0, val);
+}
+
+/**
+ * Get value at last index.
+ *
+ * @param vector the TieredVector
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if vector is empty
+ */
+bool getLastTieredVectorVal(TieredVector *vector, const char **val) {
+    if (vector->size == 0) { // prevent negative size_t index
+        return false;
+    }
+    return getTieredVectorValAt(vector, vector->size-1, val);
+}
+
+/**
+ * Set value at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setTieredVectorValAt(TieredVector *vector, size_t index, const char *val) {
+    if (val != NULL && index < vector->size) {
+        TieredVectorBlock *block = &vector->blocks[index >> vector->blockShift];
+        size_t pos = blockPos(vector, block, index & (vector->blockSize - 1));
+        free(block->vals[pos]);
+        block->vals[pos] = strdup(val);  // must copy input string
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Set value at first index.
+ *
+ * @param vector the TieredVector
+ * @param val the value to set
+ * @return false if vector is empty
+ */
+bool setFirstTieredVectorVal(TieredVector *vector, const char *val) {
+    return setTieredVectorValAt(vector, 0, val);
+}
+
+/**
+ * Set value at last index.
+ *
+ * @param vector the TieredVector
+ * @param val the value to set
+ * @return false if vector is empty
+ */
+bool setLastTieredVectorVal(TieredVector *vector, const char *val) {
+    if (vector->size == 0) { // prevent negative size_t index
+        return false;
+    }
+    return setTieredVectorValAt(vector, vector->size-1, val);
+}
+
+/**
+ * Returns number of items in the tiered vector.
+ *
+ * @param vector the TieredVector
+ * @return the number of items in the tiered vector.
+ */
+size_t tieredVectorSize(TieredVector *vector) {
+    return vector->size;
+}
+
+/**
+ * Determines whether tiered vector is empty.
+ *
+ * @param vector the TieredVector
+ * @return true if tiered vector is empty, false otherwise
+ */
+bool isTieredVectorEmpty(TieredVector *vector) {
+    return vector->size == 0;
+}
+
+/**
+ * Delete the tiered vector value at the specified index.
+ *
+ * @param vector the TieredVector
+ * @param index the index
+ * @return false if index out of bounds
+ */
+bool deleteTieredVectorValAt(TieredVector *vector, size_t index) {
+    if (index >= vector->size) {
+        return false;
+    }
+
+    // remove from block, then fill from the front of each following block
+    size_t b = index >> vector->blockShift;
+    free(removeBlockValAt(vector, &vector->blocks[b], index & (vector->blockSize - 1)));
+    for (b++; b < vector->numBlocks; b++) {
+        TieredVectorBlock *prev = &vector->blocks[b-1];
+        insertBlockValAt(vector, prev, prev->size, removeBlockValAt(vector, &vector->blocks[b], 0));
+    }
+    vector->size--;
+
+    // free last block once it is empty
+    if (vector->blocks[vector->numBlocks-1].size == 0) {
+        free(vector->blocks[--vector->numBlocks].vals);
+    }
+
+    // shrink block size when vector gets much smaller than a full square
+    if (vector->blockSize > MIN_BLOCK_SIZE
+        && vector->size < vector->blockSize * vector->blockSize / 8) {
+        rebuildBlocks(vector, vector->blockShift-1);  // ok to continue if failed
+    }
+
+    return true;
+}
+
+/**
+ * Delete the first tiered vector value.
+ *
+ * @param vector the TieredVector
+ * @return false if vector is empty
+ */
+bool deleteFirstTieredVectorVal(TieredVector *vector) {
+    return deleteTieredVectorValAt(vector, 0);
+}
+
+/**
+ * Delete the last tiered vector value.
+ *
+ * @param vector the TieredVector
+ * @return false if vector is empty
+ */
+bool deleteLastTieredVectorVal(TieredVector *vector) {
+    if (vector->size > 0) {
+        return deleteTieredVectorValAt(vector, vector->size-1);
+    }
+    return false;
+}
+
+/**
+ * Deletes all tiered vector values.
+ *
+ * @param vector the TieredVector
+ */
+void deleteAllTieredVectorVals(TieredVector *vector) {
+    for (size_t b = 0; b < vector->numBlocks; b++) {
+        TieredVectorBlock *block = &vector->blocks[b];
+        for (size_t i = 0; i < block->size; i++) {
+            free(block->vals[blockPos(vector, block, i)]);
+        }
+        free(block->vals);
+    }
+    vector->numBlocks = 0;
+    vector->blockSize = MIN_BLOCK_SIZE;
+    vector->blockShift = MIN_BLOCK_SHIFT;
+    vector->size = 0;
+}
+
+/**
+ * Delete the tiered vector. Frees copies of all strings,
+ * then the blocks, and finally the vector itself.
+ *
+ * @param vector the TieredVector
+ */
+void deleteTieredVector(TieredVector *vector) {
+    // free the strings and the blocks
+    deleteAllTieredVectorVals(vector);
+
+    // free the array of blocks
+    free(vector->blocks);
+
+    // set fields to safe values
+    vector->blocks = NULL;
+    vector->blockCapacity = 0;
+    vector->maxCapacity = 0;
+
+    // free the vector itself
+    free(vector);
+}
+
+/**
+ * Print the tiered vector.
+ *
+ * @param vector the TieredVector
+ */
+void printTieredVector(TieredVector *vector) {
+    printf("( ");
+    const char *val;
+    for (size_t i = 0; getTieredVectorValAt(vector, i, &val); i++) {
+        printf("\"%s\" ", val);
+    }
+    printf(")\n");
+}
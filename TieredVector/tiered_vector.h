@@ -0,0 +1,211 @@
+/**
+ * @file tiered_vector.h
+ *
+ * Declarations for a tiered vector of strings. A tiered vector is
+ * a top-level index of fixed-size blocks, each of which is a
+ * circular buffer. All blocks except the last one are full, so
+ * the block and position of a value are computed from its index.
+ *
+ * Random access is O(1). Adding or deleting a value shifts at
+ * most one block, then moves one value between each pair of
+ * following blocks, so it is O(sqrt n) when the block size is
+ * kept near sqrt n, instead of the O(n) shift of an ArrayList.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TIERED_VECTOR_H_
+#define TIERED_VECTOR_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/** Tiered vector block: a circular buffer of values */
+typedef struct {
+    /** Allocated block storage of blockSize values */
+    char** vals;
+    /** Position of the first value in the storage */
+    size_t head;
+    /** The number of values in the block */
+    size_t size;
+} TieredVectorBlock;
+
+/** Tiered vector data structure */
+typedef struct {
+    /** Allocated array of blocks */
+    TieredVectorBlock* blocks;
+    /** The number of blocks in use */
+    size_t numBlocks;
+    /** Capacity of allocated array of blocks */
+    size_t blockCapacity;
+    /** The number of values in each block; a power of 2 */
+    size_t blockSize;
+    /** log2 of blockSize, to find the block of an index */
+    size_t blockShift;
+    /** The current size */
+    size_t size;
+    /** Maximum capacity of the tiered vector */
+    size_t maxCapacity;
+} TieredVector;
+
+/**
+ * Create a tiered vector with a maximum capacity.
+ *
+ * @param maxCapacity maximum capacity of the TieredVector.
+ *     Use SIZE_MAX for unlimited capacity
+ * @return the allocated tiered vector
+ */
+TieredVector *newTieredVector(size_t maxCapacity);
+
+/**
+ * Add value to vector at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the new value
+ * @param val the value to insert; value will be copied to store
+ * @return false if index out of bounds, exceeds capacity
+ */
+bool addTieredVectorValAt(TieredVector *vector, size_t index, const char *val);
+
+/**
+ * Add value to start of vector.
+ *
+ * @param vector the TieredVector
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addFirstTieredVectorVal(TieredVector *vector, const char *val);
+
+/**
+ * Add value to end of vector.
+ *
+ * @param vector the TieredVector
+ * @param val the value to insert; value will be copied to store
+ * @return false if exceeds capacity
+ */
+bool addLastTieredVectorVal(TieredVector *vector, const char *val);
+
+/**
+ * Get value at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the value
+ * @param val result parameter is pointer to result value location;
+ *   cannot be NULL
+ * @return false if index out of bounds
+ */
+bool getTieredVectorValAt(TieredVector *vector, size_t index, const char **val);
+
+/**
+ * Get value at first index.
+ *
+ * @param vector the TieredVector
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if vector is empty
+ */
+bool getFirstTieredVectorVal(TieredVector *vector, const char **val);
+
+/**
+ * Get value at last index.
+ *
+ * @param vector the TieredVector
+ * @param val result parameter is pointer to result value location;
+ *   cannot be null
+ * @return false if vector is empty
+ */
+bool getLastTieredVectorVal(TieredVector *vector, const char **val);
+
+/**
+ * Set value at index.
+ *
+ * @param vector the TieredVector
+ * @param the index for the new value
+ * @param val the value to set
+ * @return false if index out of bounds
+ */
+bool setTieredVectorValAt(TieredVector *vector, size_t index, const char *val);
+
+/**
+ * Set value at first index.
+ *
+ * @param vector the TieredVector
+ * @param val the value to set
+ * @return false if vector is empty
+ */
+bool setFirstTieredVectorVal(TieredVector *vector, const char *val);
+
+/**
+ * Set value at last index.
+ *
+ * @param vector the TieredVector
+ * @param val the value to set
+ * @return false if vector is empty
+ */
+bool setLastTieredVectorVal(TieredVector *vector, const char *val);
+
+/**
+ * Returns number of items in the tiered vector.
+ *
+ * @param vector the TieredVector
+ * @return the number of items in the tiered vector.
+ */
+size_t tieredVectorSize(TieredVector *vector);
+
+/**
+ * Determines whether tiered vector is empty.
+ *
+ * @param vector the TieredVector
+ * @return true if tiered vector is empty, false otherwise
+ */
+bool isTieredVectorEmpty(TieredVector *vector);
+
+/**
+ * Delete the tiered vector value at the specified index.
+ *
+ * @param vector the TieredVector
+ * @param index the index
+ * @return false if index out of bounds
+ */
+bool deleteTieredVectorValAt(TieredVector *vector, size_t index);
+
+/**
+ * Delete the first tiered vector value.
+ *
+ * @param vector the TieredVector
+ * @return false if vector is empty
+ */
+bool deleteFirstTieredVectorVal(TieredVector *vector);
+
+/**
+ * Delete the last tiered vector value.
+ *
+ * @param vector the TieredVector
+ * @return false if vector is empty
+ */
+bool deleteLastTieredVectorVal(TieredVector *vector);
+
+/**
+ * Deletes all tiered vector values.
+ *
+ * @param vector the TieredVector
+ */
+void deleteAllTieredVectorVals(TieredVector *vector);
+
+/**
+ * Delete the tiered vector. Frees copies of all strings,
+ * then the blocks, and finally the vector itself.
+ *
+ * @param vector the TieredVector
+ */
+void deleteTieredVector(TieredVector *vector);
+
+/**
+ * Print the tiered vector.
+ *
+ * @param vector the TieredVector
+ */
+void printTieredVector(TieredVector *vector);
+
+#endif /* TIERED_VECTOR_H_ */
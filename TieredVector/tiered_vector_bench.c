@@ -0,0 +1,184 @@
+/*
+ * @file tiered_vector_bench.c
+ *
+ * Benchmark comparing TieredVector with ArrayList and LinkedList
+ * on mixed workloads of positional gets, adds and deletes at
+ * random indexes.
+ *
+ * Usage: tiered_vector_bench [ops [maxSize]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "array_list.h"
+#include "linked_list.h"
+#include "tiered_vector.h"
+
+/** Operations on a list container used by the benchmark */
+typedef struct {
+    /** name of the container */
+    const char *name;
+    /** create the container */
+    void *(*newList)(void);
+    /** add value at index */
+    bool (*addValAt)(void *list, size_t index, const char *val);
+    /** get value at index */
+    bool (*getValAt)(void *list, size_t index, const char **val);
+    /** delete value at index */
+    bool (*deleteValAt)(void *list, size_t index);
+    /** delete the container */
+    void (*deleteList)(void *list);
+} BenchList;
+
+/** A mixed workload, as percentages of gets and adds; rest are deletes */
+typedef struct {
+    /** name of the workload */
+    const char *name;
+    /** percentage of gets */
+    unsigned getPct;
+    /** percentage of adds */
+    unsigned addPct;
+} Workload;
+
+static void *newArrayListBench(void) { return newArrayList(SIZE_MAX); }
+static bool addArrayListBench(void *l, size_t i, const char *v) { return addArrayListValAt(l, i, v); }
+static bool getArrayListBench(void *l, size_t i, const char **v) { return getArrayListValAt(l, i, v); }
+static bool deleteArrayListBench(void *l, size_t i) { return deleteArrayListValAt(l, i); }
+static void deleteArrayListBenchList(void *l) { deleteArrayList(l); }
+
+static void *newLinkedListBench(void) { return newLinkedList(SIZE_MAX); }
+static bool addLinkedListBench(void *l, size_t i, const char *v) { return addLinkedListValAt(l, i, v); }
+static bool getLinkedListBench(void *l, size_t i, const char **v) { return getLinkedListValAt(l, i, v); }
+static bool deleteLinkedListBench(void *l, size_t i) { return deleteLinkedListValAt(l, i); }
+static void deleteLinkedListBenchList(void *l) { deleteLinkedList(l); }
+
+static void *newTieredVectorBench(void) { return newTieredVector(SIZE_MAX); }
+static bool addTieredVectorBench(void *l, size_t i, const char *v) { return addTieredVectorValAt(l, i, v); }
+static bool getTieredVectorBench(void *l, size_t i, const char **v) { return getTieredVectorValAt(l, i, v); }
+static bool deleteTieredVectorBench(void *l, size_t i) { return deleteTieredVectorValAt(l, i); }
+static void deleteTieredVectorBenchList(void *l) { deleteTieredVector(l); }
+
+/** The containers to compare */
+static const BenchList benchLists[] = {
+    {"TieredVector", newTieredVectorBench, addTieredVectorBench, getTieredVectorBench,
+        deleteTieredVectorBench, deleteTieredVectorBenchList},
+    {"ArrayList", newArrayListBench, addArrayListBench, getArrayListBench,
+        deleteArrayListBench, deleteArrayListBenchList},
+    {"LinkedList", newLinkedListBench, addLinkedListBench, getLinkedListBench,
+        deleteLinkedListBench, deleteLinkedListBenchList},
+};
+
+/** The workloads to run */
+static const Workload workloads[] = {
+    {"read-heavy", 90, 5},
+    {"balanced", 50, 25},
+    {"write-heavy", 10, 45},
+};
+
+/** Receives checksums so the compiler keeps the gets */
+static volatile size_t checksumSink;
+
+/**
+ * Returns the next pseudo-random number (xorshift64).
+ *
+ * @param state the generator state; must not be 0
+ * @return the next number
+ */
+static uint64_t nextRandom(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+/**
+ * Returns the current monotonic time in nanoseconds.
+ *
+ * @return the time in nanoseconds
+ */
+static uint64_t nowNanos(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/**
+ * Run a workload on a list of a given size, and return the time per
+ * operation. The same random sequence is used for every container.
+ *
+ * @param bl the container
+ * @param wl the workload
+ * @param size the initial size of the list
+ * @param ops the number of operations
+ * @return the nanoseconds per operation
+ */
+static double runWorkload(const BenchList *bl, const Workload *wl, size_t size, size_t ops) {
+    void *list = bl->newList();
+    char buf[24];
+    for (size_t i = 0; i < size; i++) {
+        sprintf(buf, "%zu", i);
+        bl->addValAt(list, i, buf);
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    size_t curSize = size;
+    size_t checksum = 0;
+    uint64_t start = nowNanos();
+    for (size_t op = 0; op < ops; op++) {
+        uint64_t r = nextRandom(&state);
+        unsigned pct = r % 100;
+        size_t index = (r >> 8) % (curSize + 1);
+        if (pct < wl->getPct && curSize > 0) {
+            const char *val;
+            bl->getValAt(list, index % curSize, &val);
+            checksum += val[0];
+        } else if (pct < wl->getPct + wl->addPct || curSize == 0) {
+            bl->addValAt(list, index, "bench");
+            curSize++;
+        } else {
+            bl->deleteValAt(list, index % curSize);
+            curSize--;
+        }
+    }
+    uint64_t elapsed = nowNanos() - start;
+
+    bl->deleteList(list);
+    checksumSink = checksum;
+    return (double)elapsed / ops;
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    size_t ops = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+    size_t maxSize = (argc > 2) ? strtoul(argv[2], NULL, 10) : 100000;
+    size_t numLists = sizeof(benchLists) / sizeof(benchLists[0]);
+    size_t numWorkloads = sizeof(workloads) / sizeof(workloads[0]);
+
+    printf("%-12s %10s", "workload", "size");
+    for (size_t l = 0; l < numLists; l++) {
+        printf(" %14s", benchLists[l].name);
+    }
+    printf("   (ns/op, %zu ops)\n", ops);
+
+    for (size_t w = 0; w < numWorkloads; w++) {
+        for (size_t size = 1000; size <= maxSize; size *= 10) {
+            printf("%-12s %10zu", workloads[w].name, size);
+            for (size_t l = 0; l < numLists; l++) {
+                printf(" %14.1f", runWorkload(&benchLists[l], &workloads[w], size, ops));
+                fflush(stdout);
+            }
+            printf("\n");
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/*
+ * @file tiered_vector_main.c
+ *
+ * Test program for TieredVector functions.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tiered_vector.h"
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating tiered vector\n");
+    TieredVector *vector = newTieredVector(SIZE_MAX);
+    bool empty = isTieredVectorEmpty(vector);
+    printf("vector empty? %s\n", empty ? "true" : "false");
+    size_t size = tieredVectorSize(vector);
+    printf("vector size: %ld\n", size);
+
+    printf("\nadding 5 values\n");
+    addLastTieredVectorVal(vector, "B");
+    addLastTieredVectorVal(vector, "D");
+    addFirstTieredVectorVal(vector, "A");
+    addTieredVectorValAt(vector, 2, "C");
+    addLastTieredVectorVal(vector, "E");
+    empty = isTieredVectorEmpty(vector);
+    printf("vector empty? %s\n", empty ? "true" : "false");
+    size = tieredVectorSize(vector);
+    printf("vector size: %ld\n", size);
+    printTieredVector(vector);
+
+    const char *val;
+    if (getFirstTieredVectorVal(vector, &val)) {
+        printf("vector first: %s\n", val);
+    }
+    if (getLastTieredVectorVal(vector, &val)) {
+        printf("vector last: %s\n", val);
+    }
+    if (getTieredVectorValAt(vector, 5, &val)) {
+        printf("error: got vector[5] \"%s\" beyond vector\n", val);
+    } else {
+        printf("cannot access vector[5]\n");
+    }
+
+    printf("\nsetting vector[2] to \"Z\"\n");
+    setTieredVectorValAt(vector, 2, "Z");
+    printTieredVector(vector);
+
+    printf("\ndeleting first, last, and vector[1]\n");
+    deleteFirstTieredVectorVal(vector);
+    deleteLastTieredVectorVal(vector);
+    deleteTieredVectorValAt(vector, 1);
+    printTieredVector(vector);
+
+    printf("\nadding 1000 values in the middle\n");
+    char buf[16];
+    for (int i = 0; i < 1000; i++) {
+        sprintf(buf, "%d", i);
+        addTieredVectorValAt(vector, tieredVectorSize(vector)/2, buf);
+    }
+    printf("vector size: %ld\n", tieredVectorSize(vector));
+    printf("block size: %ld, blocks: %ld\n", vector->blockSize, vector->numBlocks);
+    getTieredVectorValAt(vector, 500, &val);
+    printf("vector[500]: %s\n", val);
+
+    printf("\ndeleting 990 values from the middle\n");
+    for (int i = 0; i < 990; i++) {
+        deleteTieredVectorValAt(vector, tieredVectorSize(vector)/2);
+    }
+    printf("vector size: %ld\n", tieredVectorSize(vector));
+    printf("block size: %ld, blocks: %ld\n", vector->blockSize, vector->numBlocks);
+    printTieredVector(vector);
+
+    printf("\ndeleting all tiered vector values\n");
+    deleteAllTieredVectorVals(vector);
+    empty = isTieredVectorEmpty(vector);
+    printf("vector empty? %s\n", empty ? "true" : "false");
+    printTieredVector(vector);
+
+    printf("\ndeleting tiered vector\n");
+    deleteTieredVector(vector);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
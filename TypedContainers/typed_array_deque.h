@@ -0,0 +1,224 @@
+/**
+ * @file typed_array_deque.h
+ *
+ * Macro that generates an array deque of values of a given type.
+ *
+ * DEFINE_ARRAY_DEQUE(Name, T) defines the deque type Name backed by
+ * a list generated with DEFINE_ARRAY_LIST(NameList, T), and static
+ * inline functions that mirror the ArrayDeque functions. The head
+ * of the deque is its first value and the top is its last value.
+ * For example
+ *
+ *     DEFINE_ARRAY_DEQUE(IntDeque, int64_t)
+ *
+ * defines IntDeque with functions:
+ *
+ *     IntDeque *newIntDeque(size_t maxCapacity);
+ *     bool addFirstIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool addLastIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool enqueueIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool pushIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool peekFirstIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool peekLastIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool peekHeadIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool peekTopIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool pokeFirstIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool pokeLastIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool pokeHeadIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool pokeTopIntDequeVal(IntDeque *deque, int64_t val);
+ *     bool deleteFirstIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool deleteLastIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool dequeueIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool popIntDequeVal(IntDeque *deque, int64_t *val);
+ *     bool dropFirstIntDequeVal(IntDeque *deque);
+ *     bool dropLastIntDequeVal(IntDeque *deque);
+ *     bool dropHeadIntDequeVal(IntDeque *deque);
+ *     bool dropTopIntDequeVal(IntDeque *deque);
+ *     bool swapTopIntDequeVal(IntDeque *deque);
+ *     bool dupTopIntDequeVal(IntDeque *deque);
+ *     void dropAllIntDequeVals(IntDeque *deque);
+ *     size_t IntDequeSize(IntDeque *deque);
+ *     bool isIntDequeEmpty(IntDeque *deque);
+ *     void deleteIntDeque(IntDeque *deque);
+ *     void printIntDeque(IntDeque *deque, void (*printVal)(int64_t val));
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TYPED_ARRAY_DEQUE_H_
+#define TYPED_ARRAY_DEQUE_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "typed_array_list.h"
+
+/**
+ * Define an array deque type Name of T values and its functions.
+ *
+ * @param Name the name of the deque type
+ * @param T the value type
+ */
+#define DEFINE_ARRAY_DEQUE(Name, T) \
+\
+DEFINE_ARRAY_LIST(Name##List, T) \
+\
+/** array deque data structure */ \
+typedef struct { \
+    /** Uses typed array list as backing store */ \
+    Name##List *list; \
+} Name; \
+\
+/* Create an array deque with a maximum capacity. */ \
+static inline Name *new##Name(size_t maxCapacity) { \
+    Name *deque = malloc(sizeof(Name)); \
+    deque->list = new##Name##List(maxCapacity); \
+    return deque; \
+} \
+\
+/* Add value onto the deque first; false if exceeds max capacity. */ \
+static inline bool addFirst##Name##Val(Name *deque, T val) { \
+    return addFirst##Name##List##Val(deque->list, val); \
+} \
+\
+/* Add value onto the deque last; false if exceeds max capacity. */ \
+static inline bool addLast##Name##Val(Name *deque, T val) { \
+    return addLast##Name##List##Val(deque->list, val); \
+} \
+\
+/* Enqueue value onto the deque tail. */ \
+static inline bool enqueue##Name##Val(Name *deque, T val) { \
+    return addLast##Name##Val(deque, val); \
+} \
+\
+/* Push value onto the deque top. */ \
+static inline bool push##Name##Val(Name *deque, T val) { \
+    return addLast##Name##Val(deque, val); \
+} \
+\
+/* Get the first deque value without removing it; false if empty. */ \
+static inline bool peekFirst##Name##Val(Name *deque, T *val) { \
+    return getFirst##Name##List##Val(deque->list, val); \
+} \
+\
+/* Get the last deque value without removing it; false if empty. */ \
+static inline bool peekLast##Name##Val(Name *deque, T *val) { \
+    return getLast##Name##List##Val(deque->list, val); \
+} \
+\
+/* Get the head deque value without removing it; false if empty. */ \
+static inline bool peekHead##Name##Val(Name *deque, T *val) { \
+    return peekFirst##Name##Val(deque, val); \
+} \
+\
+/* Get the top deque value without removing it; false if empty. */ \
+static inline bool peekTop##Name##Val(Name *deque, T *val) { \
+    return peekLast##Name##Val(deque, val); \
+} \
+\
+/* Set the first deque value; false if empty. */ \
+static inline bool pokeFirst##Name##Val(Name *deque, T val) { \
+    return setFirst##Name##List##Val(deque->list, val); \
+} \
+\
+/* Set the last deque value; false if empty. */ \
+static inline bool pokeLast##Name##Val(Name *deque, T val) { \
+    return setLast##Name##List##Val(deque->list, val); \
+} \
+\
+/* Set the head deque value; false if empty. */ \
+static inline bool pokeHead##Name##Val(Name *deque, T val) { \
+    return pokeFirst##Name##Val(deque, val); \
+} \
+\
+/* Set the top deque value; false if empty. */ \
+static inline bool pokeTop##Name##Val(Name *deque, T val) { \
+    return pokeLast##Name##Val(deque, val); \
+} \
+\
+/* Delete and return the first deque value; false if empty. */ \
+static inline bool deleteFirst##Name##Val(Name *deque, T *val) { \
+    return peekFirst##Name##Val(deque, val) && deleteFirst##Name##List##Val(deque->list); \
+} \
+\
+/* Delete and return the last deque value; false if empty. */ \
+static inline bool deleteLast##Name##Val(Name *deque, T *val) { \
+    return peekLast##Name##Val(deque, val) && deleteLast##Name##List##Val(deque->list); \
+} \
+\
+/* Dequeue the head deque value; false if empty. */ \
+static inline bool dequeue##Name##Val(Name *deque, T *val) { \
+    return deleteFirst##Name##Val(deque, val); \
+} \
+\
+/* Pop the top deque value; false if empty. */ \
+static inline bool pop##Name##Val(Name *deque, T *val) { \
+    return deleteLast##Name##Val(deque, val); \
+} \
+\
+/* Drop the first deque value; false if empty. */ \
+static inline bool dropFirst##Name##Val(Name *deque) { \
+    return deleteFirst##Name##List##Val(deque->list); \
+} \
+\
+/* Drop the last deque value; false if empty. */ \
+static inline bool dropLast##Name##Val(Name *deque) { \
+    return deleteLast##Name##List##Val(deque->list); \
+} \
+\
+/* Drop the head deque value; false if empty. */ \
+static inline bool dropHead##Name##Val(Name *deque) { \
+    return dropFirst##Name##Val(deque); \
+} \
+\
+/* Drop the top deque value; false if empty. */ \
+static inline bool dropTop##Name##Val(Name *deque) { \
+    return dropLast##Name##Val(deque); \
+} \
+\
+/* Exchange the top two deque values; false if fewer than two. */ \
+static inline bool swapTop##Name##Val(Name *deque) { \
+    size_t size = deque->list->size; \
+    if (size >= 2) { \
+        T tmp = deque->list->vals[size-1]; \
+        deque->list->vals[size-1] = deque->list->vals[size-2]; \
+        deque->list->vals[size-2] = tmp; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Push another copy of the top deque value; false if empty. */ \
+static inline bool dupTop##Name##Val(Name *deque) { \
+    T val; \
+    return peekTop##Name##Val(deque, &val) && push##Name##Val(deque, val); \
+} \
+\
+/* Delete all deque values. */ \
+static inline void dropAll##Name##Vals(Name *deque) { \
+    deleteAll##Name##List##Vals(deque->list); \
+} \
+\
+/* Returns number of items in the deque. */ \
+static inline size_t Name##Size(Name *deque) { \
+    return Name##List##Size(deque->list); \
+} \
+\
+/* Determines whether deque is empty. */ \
+static inline bool is##Name##Empty(Name *deque) { \
+    return is##Name##List##Empty(deque->list); \
+} \
+\
+/* Delete the deque. */ \
+static inline void delete##Name(Name *deque) { \
+    delete##Name##List(deque->list); \
+    deque->list = NULL; \
+    free(deque); \
+} \
+\
+/* Print the deque from first to last. */ \
+static inline void print##Name(Name *deque, void (*printVal)(T val)) { \
+    print##Name##List(deque->list, printVal); \
+}
+
+#endif /* TYPED_ARRAY_DEQUE_H_ */
@@ -0,0 +1,224 @@
+/**
+ * @file typed_array_list.h
+ *
+ * Macro that generates a variable-size array list of values of
+ * a given type.
+ *
+ * DEFINE_ARRAY_LIST(Name, T) defines the list type Name and static
+ * inline functions that store T values inline in the array by value,
+ * so adding, getting and setting a value is a plain copy of the
+ * value that the compiler specializes for T. For example
+ *
+ *     DEFINE_ARRAY_LIST(IntList, int64_t)
+ *
+ * defines IntList with functions that mirror the ArrayList functions:
+ *
+ *     IntList *newIntList(size_t maxCapacity);
+ *     bool addIntListValAt(IntList *list, size_t index, int64_t val);
+ *     bool addFirstIntListVal(IntList *list, int64_t val);
+ *     bool addLastIntListVal(IntList *list, int64_t val);
+ *     bool getIntListValAt(IntList *list, size_t index, int64_t *val);
+ *     bool getFirstIntListVal(IntList *list, int64_t *val);
+ *     bool getLastIntListVal(IntList *list, int64_t *val);
+ *     bool setIntListValAt(IntList *list, size_t index, int64_t val);
+ *     bool setFirstIntListVal(IntList *list, int64_t val);
+ *     bool setLastIntListVal(IntList *list, int64_t val);
+ *     size_t IntListSize(IntList *list);
+ *     bool isIntListEmpty(IntList *list);
+ *     bool deleteIntListValAt(IntList *list, size_t index);
+ *     bool deleteFirstIntListVal(IntList *list);
+ *     bool deleteLastIntListVal(IntList *list);
+ *     void deleteAllIntListVals(IntList *list);
+ *     void deleteIntList(IntList *list);
+ *     void printIntList(IntList *list, void (*printVal)(int64_t val));
+ *
+ * Values are copied in and out; the list does not own any storage
+ * that the values point to.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TYPED_ARRAY_LIST_H_
+#define TYPED_ARRAY_LIST_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Define an array list type Name of T values and its functions.
+ *
+ * @param Name the name of the list type
+ * @param T the value type
+ */
+#define DEFINE_ARRAY_LIST(Name, T) \
+\
+/** Array List data structure */ \
+typedef struct { \
+    /** The current size */ \
+    size_t size; \
+    /** Capacity of array storage */ \
+    size_t capacity; \
+    /** Maximum capacity of array storage */ \
+    size_t maxCapacity; \
+    /** Allocated array storage */ \
+    T *vals; \
+} Name; \
+\
+/* Create an array list with a maximum capacity. */ \
+static inline Name *new##Name(size_t maxCapacity) { \
+    Name *list = malloc(sizeof(Name)); \
+    list->size = 0; \
+    list->capacity = (maxCapacity < 2) ? maxCapacity : 2;  /* small power of 2 */ \
+    list->maxCapacity = maxCapacity; \
+    list->vals = malloc(list->capacity * sizeof(T)); \
+    return list; \
+} \
+\
+/* Ensure array has capacity for a new value, growing it up to the \
+   maximum capacity; false if at maximum capacity or out of memory. */ \
+static inline bool ensure##Name##Capacity(Name *list) { \
+    if (list->size == list->capacity) { \
+        /* done if already at maxCapacity */ \
+        if (list->capacity == list->maxCapacity) { \
+            return false; \
+        } \
+        size_t newCapacity; \
+        if (list->maxCapacity - list->capacity < list->capacity) { \
+            /* no room to double: set to maxCapacity */ \
+            newCapacity = list->maxCapacity; \
+        } else { \
+            /* double current capacity */ \
+            newCapacity = list->capacity * 2; \
+        } \
+        T *newVals = realloc(list->vals, newCapacity * sizeof(T)); \
+        if (newVals == NULL) { /* not enough memory to reallocate */ \
+            return false; \
+        } \
+        list->capacity = newCapacity; \
+        list->vals = newVals; \
+    } \
+    return true; \
+} \
+\
+/* Add value to list at index; false if index out of bounds or \
+   exceeds max capacity. */ \
+static inline bool add##Name##ValAt(Name *list, size_t index, T val) { \
+    if (index > list->size || !ensure##Name##Capacity(list)) { \
+        return false; \
+    } \
+    /* move elements down to make room for new element */ \
+    memmove(&list->vals[index+1], &list->vals[index], (list->size - index) * sizeof(T)); \
+    list->vals[index] = val; \
+    list->size++; \
+    return true; \
+} \
+\
+/* Add value to start of list. */ \
+static inline bool addFirst##Name##Val(Name *list, T val) { \
+    return add##Name##ValAt(list, 0, val); \
+} \
+\
+/* Add value to end of list. */ \
+static inline bool addLast##Name##Val(Name *list, T val) { \
+    return add##Name##ValAt(list, list->size, val); \
+} \
+\
+/* Get value at index; false if index out of bounds. */ \
+static inline bool get##Name##ValAt(Name *list, size_t index, T *val) { \
+    if (index < list->size) { \
+        *val = list->vals[index]; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Get value at first index; false if list is empty. */ \
+static inline bool getFirst##Name##Val(Name *list, T *val) { \
+    return get##Name##ValAt(list, 0, val); \
+} \
+\
+/* Get value at last index; false if list is empty. */ \
+static inline bool getLast##Name##Val(Name *list, T *val) { \
+    return (list->size > 0) && get##Name##ValAt(list, list->size-1, val); \
+} \
+\
+/* Set value at index; false if index out of bounds. */ \
+static inline bool set##Name##ValAt(Name *list, size_t index, T val) { \
+    if (index < list->size) { \
+        list->vals[index] = val; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Set value at first index; false if list is empty. */ \
+static inline bool setFirst##Name##Val(Name *list, T val) { \
+    return set##Name##ValAt(list, 0, val); \
+} \
+\
+/* Set value at last index; false if list is empty. */ \
+static inline bool setLast##Name##Val(Name *list, T val) { \
+    return (list->size > 0) && set##Name##ValAt(list, list->size-1, val); \
+} \
+\
+/* Returns number of items in the list. */ \
+static inline size_t Name##Size(Name *list) { \
+    return list->size; \
+} \
+\
+/* Determines whether list is empty. */ \
+static inline bool is##Name##Empty(Name *list) { \
+    return list->size == 0; \
+} \
+\
+/* Delete the value at index; false if index out of bounds. */ \
+static inline bool delete##Name##ValAt(Name *list, size_t index) { \
+    if (index >= list->size) { \
+        return false; \
+    } \
+    /* move elements up over the deleted element */ \
+    list->size--; \
+    memmove(&list->vals[index], &list->vals[index+1], (list->size - index) * sizeof(T)); \
+    return true; \
+} \
+\
+/* Delete the first value; false if list is empty. */ \
+static inline bool deleteFirst##Name##Val(Name *list) { \
+    return delete##Name##ValAt(list, 0); \
+} \
+\
+/* Delete the last value; false if list is empty. */ \
+static inline bool deleteLast##Name##Val(Name *list) { \
+    return (list->size > 0) && delete##Name##ValAt(list, list->size-1); \
+} \
+\
+/* Deletes all list values. */ \
+static inline void deleteAll##Name##Vals(Name *list) { \
+    list->size = 0; \
+} \
+\
+/* Delete the list. */ \
+static inline void delete##Name(Name *list) { \
+    free(list->vals); \
+    /* set fields to safe values */ \
+    list->vals = NULL; \
+    list->size = 0; \
+    list->capacity = 0; \
+    list->maxCapacity = 0; \
+    free(list); \
+} \
+\
+/* Print the list using a function that prints one value. */ \
+static inline void print##Name(Name *list, void (*printVal)(T val)) { \
+    printf("( "); \
+    for (size_t i = 0; i < list->size; i++) { \
+        printVal(list->vals[i]); \
+        printf(" "); \
+    } \
+    printf(")\n"); \
+}
+
+#endif /* TYPED_ARRAY_LIST_H_ */
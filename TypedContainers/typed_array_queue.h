@@ -0,0 +1,112 @@
+/**
+ * @file typed_array_queue.h
+ *
+ * Macro that generates an array queue of values of a given type.
+ *
+ * DEFINE_ARRAY_QUEUE(Name, T) defines the queue type Name backed by
+ * a list generated with DEFINE_ARRAY_LIST(NameList, T), and static
+ * inline functions that mirror the ArrayQueue functions. For example
+ *
+ *     DEFINE_ARRAY_QUEUE(IntQueue, int64_t)
+ *
+ * defines IntQueue with functions:
+ *
+ *     IntQueue *newIntQueue(size_t maxCapacity);
+ *     bool enqueueIntQueueVal(IntQueue *queue, int64_t val);
+ *     bool peekIntQueueVal(IntQueue *queue, int64_t *val);
+ *     bool pokeIntQueueVal(IntQueue *queue, int64_t val);
+ *     bool dequeueIntQueueVal(IntQueue *queue, int64_t *val);
+ *     bool dropIntQueueVal(IntQueue *queue);
+ *     void dropAllIntQueueVals(IntQueue *queue);
+ *     size_t IntQueueSize(IntQueue *queue);
+ *     bool isIntQueueEmpty(IntQueue *queue);
+ *     void deleteIntQueue(IntQueue *queue);
+ *     void printIntQueue(IntQueue *queue, void (*printVal)(int64_t val));
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TYPED_ARRAY_QUEUE_H_
+#define TYPED_ARRAY_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "typed_array_list.h"
+
+/**
+ * Define an array queue type Name of T values and its functions.
+ *
+ * @param Name the name of the queue type
+ * @param T the value type
+ */
+#define DEFINE_ARRAY_QUEUE(Name, T) \
+\
+DEFINE_ARRAY_LIST(Name##List, T) \
+\
+/** array queue data structure */ \
+typedef struct { \
+    /** Uses typed array list as backing store */ \
+    Name##List *list; \
+} Name; \
+\
+/* Create an array queue with a maximum capacity. */ \
+static inline Name *new##Name(size_t maxCapacity) { \
+    Name *queue = malloc(sizeof(Name)); \
+    queue->list = new##Name##List(maxCapacity); \
+    return queue; \
+} \
+\
+/* Enqueue value onto the queue; false if exceeds max capacity. */ \
+static inline bool enqueue##Name##Val(Name *queue, T val) { \
+    return addLast##Name##List##Val(queue->list, val); \
+} \
+\
+/* Get the head queue value without removing it; false if empty. */ \
+static inline bool peek##Name##Val(Name *queue, T *val) { \
+    return getFirst##Name##List##Val(queue->list, val); \
+} \
+\
+/* Set the head queue value; false if empty. */ \
+static inline bool poke##Name##Val(Name *queue, T val) { \
+    return setFirst##Name##List##Val(queue->list, val); \
+} \
+\
+/* Delete and return the head queue value; false if empty. */ \
+static inline bool dequeue##Name##Val(Name *queue, T *val) { \
+    return peek##Name##Val(queue, val) && deleteFirst##Name##List##Val(queue->list); \
+} \
+\
+/* Delete the head queue value; false if empty. */ \
+static inline bool drop##Name##Val(Name *queue) { \
+    return deleteFirst##Name##List##Val(queue->list); \
+} \
+\
+/* Delete all queue values. */ \
+static inline void dropAll##Name##Vals(Name *queue) { \
+    deleteAll##Name##List##Vals(queue->list); \
+} \
+\
+/* Returns number of items in the queue. */ \
+static inline size_t Name##Size(Name *queue) { \
+    return Name##List##Size(queue->list); \
+} \
+\
+/* Determines whether queue is empty. */ \
+static inline bool is##Name##Empty(Name *queue) { \
+    return is##Name##List##Empty(queue->list); \
+} \
+\
+/* Delete the queue. */ \
+static inline void delete##Name(Name *queue) { \
+    delete##Name##List(queue->list); \
+    queue->list = NULL; \
+    free(queue); \
+} \
+\
+/* Print the queue from head to tail. */ \
+static inline void print##Name(Name *queue, void (*printVal)(T val)) { \
+    print##Name##List(queue->list, printVal); \
+}
+
+#endif /* TYPED_ARRAY_QUEUE_H_ */
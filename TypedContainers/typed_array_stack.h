@@ -0,0 +1,136 @@
+/**
+ * @file typed_array_stack.h
+ *
+ * Macro that generates an array stack of values of a given type.
+ *
+ * DEFINE_ARRAY_STACK(Name, T) defines the stack type Name backed by
+ * a list generated with DEFINE_ARRAY_LIST(NameList, T), and static
+ * inline functions that mirror the ArrayStack functions. For example
+ *
+ *     DEFINE_ARRAY_STACK(IntStack, int64_t)
+ *
+ * defines IntStack with functions:
+ *
+ *     IntStack *newIntStack(size_t maxCapacity);
+ *     bool pushIntStackVal(IntStack *stack, int64_t val);
+ *     bool peekIntStackVal(IntStack *stack, int64_t *val);
+ *     bool pokeIntStackVal(IntStack *stack, int64_t val);
+ *     bool popIntStackVal(IntStack *stack, int64_t *val);
+ *     bool swapIntStackVal(IntStack *stack);
+ *     bool dupIntStackVal(IntStack *stack);
+ *     bool dropIntStackVal(IntStack *stack);
+ *     void dropAllIntStackVals(IntStack *stack);
+ *     size_t IntStackSize(IntStack *stack);
+ *     bool isIntStackEmpty(IntStack *stack);
+ *     void deleteIntStack(IntStack *stack);
+ *     void printIntStack(IntStack *stack, void (*printVal)(int64_t val));
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TYPED_ARRAY_STACK_H_
+#define TYPED_ARRAY_STACK_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "typed_array_list.h"
+
+/**
+ * Define an array stack type Name of T values and its functions.
+ *
+ * @param Name the name of the stack type
+ * @param T the value type
+ */
+#define DEFINE_ARRAY_STACK(Name, T) \
+\
+DEFINE_ARRAY_LIST(Name##List, T) \
+\
+/** array stack data structure */ \
+typedef struct { \
+    /** Uses typed array list as backing store */ \
+    Name##List *list; \
+} Name; \
+\
+/* Create an array stack with a maximum capacity. */ \
+static inline Name *new##Name(size_t maxCapacity) { \
+    Name *stack = malloc(sizeof(Name)); \
+    stack->list = new##Name##List(maxCapacity); \
+    return stack; \
+} \
+\
+/* Push value onto the stack; false if exceeds max capacity. */ \
+static inline bool push##Name##Val(Name *stack, T val) { \
+    return addLast##Name##List##Val(stack->list, val); \
+} \
+\
+/* Get the top stack value without removing it; false if empty. */ \
+static inline bool peek##Name##Val(Name *stack, T *val) { \
+    return getLast##Name##List##Val(stack->list, val); \
+} \
+\
+/* Set the top stack value; false if empty. */ \
+static inline bool poke##Name##Val(Name *stack, T val) { \
+    return setLast##Name##List##Val(stack->list, val); \
+} \
+\
+/* Delete and return the top stack value; false if empty. */ \
+static inline bool pop##Name##Val(Name *stack, T *val) { \
+    if (peek##Name##Val(stack, val)) { \
+        stack->list->size--; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Exchange the top two stack values; false if fewer than two. */ \
+static inline bool swap##Name##Val(Name *stack) { \
+    size_t size = stack->list->size; \
+    if (size >= 2) { \
+        T tmp = stack->list->vals[size-1]; \
+        stack->list->vals[size-1] = stack->list->vals[size-2]; \
+        stack->list->vals[size-2] = tmp; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Push another copy of the top stack value; false if empty. */ \
+static inline bool dup##Name##Val(Name *stack) { \
+    T val; \
+    return peek##Name##Val(stack, &val) && push##Name##Val(stack, val); \
+} \
+\
+/* Delete the top stack value; false if empty. */ \
+static inline bool drop##Name##Val(Name *stack) { \
+    return deleteLast##Name##List##Val(stack->list); \
+} \
+\
+/* Delete all stack values. */ \
+static inline void dropAll##Name##Vals(Name *stack) { \
+    deleteAll##Name##List##Vals(stack->list); \
+} \
+\
+/* Returns number of items in the stack. */ \
+static inline size_t Name##Size(Name *stack) { \
+    return Name##List##Size(stack->list); \
+} \
+\
+/* Determines whether stack is empty. */ \
+static inline bool is##Name##Empty(Name *stack) { \
+    return is##Name##List##Empty(stack->list); \
+} \
+\
+/* Delete the stack. */ \
+static inline void delete##Name(Name *stack) { \
+    delete##Name##List(stack->list); \
+    stack->list = NULL; \
+    free(stack); \
+} \
+\
+/* Print the stack from bottom to top. */ \
+static inline void print##Name(Name *stack, void (*printVal)(T val)) { \
+    print##Name##List(stack->list, printVal); \
+}
+
+#endif /* TYPED_ARRAY_STACK_H_ */
@@ -0,0 +1,162 @@
+/*
+ * @file typed_containers_main.c
+ *
+ * Test program for typed container functions.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "typed_array_deque.h"
+#include "typed_array_list.h"
+#include "typed_array_queue.h"
+#include "typed_array_stack.h"
+#include "typed_linked_list.h"
+
+/** A small struct value */
+typedef struct {
+    /** x coordinate */
+    int32_t x;
+    /** y coordinate */
+    int32_t y;
+} Point;
+
+DEFINE_ARRAY_LIST(IntList, int64_t)
+DEFINE_ARRAY_LIST(PointList, Point)
+DEFINE_ARRAY_STACK(IntStack, int64_t)
+DEFINE_ARRAY_QUEUE(IntQueue, int64_t)
+DEFINE_ARRAY_DEQUE(PointDeque, Point)
+DEFINE_LINKED_LIST(IntLinkedList, int64_t)
+
+/**
+ * Print an int64_t value.
+ *
+ * @param val the value
+ */
+static void printInt(int64_t val) {
+    printf("%" PRId64, val);
+}
+
+/**
+ * Print a Point value.
+ *
+ * @param val the value
+ */
+static void printPoint(Point val) {
+    printf("(%d,%d)", val.x, val.y);
+}
+
+/**
+ * Test functions.
+ */
+int main(void) {
+    printf("Creating int list\n");
+    IntList *list = newIntList(SIZE_MAX);
+    addLastIntListVal(list, 2);
+    addLastIntListVal(list, 4);
+    addFirstIntListVal(list, 1);
+    addIntListValAt(list, 2, 3);
+    addLastIntListVal(list, 5);
+    printf("list size: %zu\n", IntListSize(list));
+    printIntList(list, printInt);
+    setIntListValAt(list, 2, 30);
+    deleteFirstIntListVal(list);
+    deleteLastIntListVal(list);
+    printIntList(list, printInt);
+    int64_t val;
+    if (!getIntListValAt(list, 3, &val)) {
+        printf("cannot access list[3]\n");
+    }
+    deleteIntList(list);
+
+    printf("\nCreating point list\n");
+    PointList *points = newPointList(SIZE_MAX);
+    for (int32_t i = 0; i < 5; i++) {
+        addLastPointListVal(points, (Point){i, i*i});
+    }
+    Point p;
+    if (getLastPointListVal(points, &p)) {
+        printf("last point: ");
+        printPoint(p);
+        printf("\n");
+    } else {
+        printf("cannot get last point\n");
+    }
+    printPointList(points, printPoint);
+    deletePointList(points);
+
+    printf("\nCreating int stack\n");
+    IntStack *stack = newIntStack(SIZE_MAX);
+    pushIntStackVal(stack, 1);
+    pushIntStackVal(stack, 2);
+    pushIntStackVal(stack, 3);
+    swapIntStackVal(stack);
+    dupIntStackVal(stack);
+    printIntStack(stack, printInt);
+    if (popIntStackVal(stack, &val)) {
+        printf("popped: %" PRId64 "\n", val);
+    } else {
+        printf("cannot pop empty stack\n");
+    }
+    printIntStack(stack, printInt);
+    deleteIntStack(stack);
+
+    printf("\nCreating int queue\n");
+    IntQueue *queue = newIntQueue(SIZE_MAX);
+    for (int64_t i = 1; i <= 4; i++) {
+        enqueueIntQueueVal(queue, i * 10);
+    }
+    if (dequeueIntQueueVal(queue, &val)) {
+        printf("dequeued: %" PRId64 "\n", val);
+    } else {
+        printf("cannot dequeue empty queue\n");
+    }
+    printIntQueue(queue, printInt);
+    deleteIntQueue(queue);
+
+    printf("\nCreating point deque\n");
+    PointDeque *deque = newPointDeque(SIZE_MAX);
+    addFirstPointDequeVal(deque, (Point){1, 1});
+    addLastPointDequeVal(deque, (Point){2, 2});
+    addFirstPointDequeVal(deque, (Point){0, 0});
+    printPointDeque(deque, printPoint);
+    if (popPointDequeVal(deque, &p)) {
+        printf("popped: ");
+        printPoint(p);
+        printf("\n");
+    } else {
+        printf("cannot pop empty deque\n");
+    }
+    if (dequeuePointDequeVal(deque, &p)) {
+        printf("dequeued: ");
+        printPoint(p);
+        printf("\n");
+    } else {
+        printf("cannot dequeue empty deque\n");
+    }
+    printPointDeque(deque, printPoint);
+    deletePointDeque(deque);
+
+    printf("\nCreating int linked list\n");
+    IntLinkedList *linked = newIntLinkedList(SIZE_MAX);
+    for (int64_t i = 0; i < 5; i++) {
+        addLastIntLinkedListVal(linked, i);
+    }
+    setIntLinkedListValAt(linked, 2, 20);
+    deleteIntLinkedListValAt(linked, 0);
+    if (getLastIntLinkedListVal(linked, &val)) {
+        printf("last: %" PRId64 "\n", val);
+    } else {
+        printf("cannot get last of empty list\n");
+    }
+    printIntLinkedList(linked, printInt);
+    deleteIntLinkedList(linked);
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
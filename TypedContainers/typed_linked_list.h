@@ -0,0 +1,220 @@
+/**
+ * @file typed_linked_list.h
+ *
+ * Macro that generates a linked list of values of a given type.
+ *
+ * DEFINE_LINKED_LIST(Name, T) defines the node type NameNode, the
+ * list type Name, and static inline functions that mirror the
+ * LinkedList functions. Each node stores its T value inline, so a
+ * value needs one allocation rather than a node and a string copy.
+ * For example
+ *
+ *     DEFINE_LINKED_LIST(IntLinkedList, int64_t)
+ *
+ * defines IntLinkedList with functions:
+ *
+ *     IntLinkedList *newIntLinkedList(size_t maxCapacity);
+ *     bool addIntLinkedListValAt(IntLinkedList *list, size_t index, int64_t val);
+ *     bool addFirstIntLinkedListVal(IntLinkedList *list, int64_t val);
+ *     bool addLastIntLinkedListVal(IntLinkedList *list, int64_t val);
+ *     bool getIntLinkedListValAt(IntLinkedList *list, size_t index, int64_t *val);
+ *     bool getFirstIntLinkedListVal(IntLinkedList *list, int64_t *val);
+ *     bool getLastIntLinkedListVal(IntLinkedList *list, int64_t *val);
+ *     bool setIntLinkedListValAt(IntLinkedList *list, size_t index, int64_t val);
+ *     bool setFirstIntLinkedListVal(IntLinkedList *list, int64_t val);
+ *     bool setLastIntLinkedListVal(IntLinkedList *list, int64_t val);
+ *     size_t IntLinkedListSize(IntLinkedList *list);
+ *     bool isIntLinkedListEmpty(IntLinkedList *list);
+ *     bool deleteIntLinkedListValAt(IntLinkedList *list, size_t index);
+ *     bool deleteFirstIntLinkedListVal(IntLinkedList *list);
+ *     bool deleteLastIntLinkedListVal(IntLinkedList *list);
+ *     void deleteAllIntLinkedListVals(IntLinkedList *list);
+ *     void deleteIntLinkedList(IntLinkedList *list);
+ *     void printIntLinkedList(IntLinkedList *list, void (*printVal)(int64_t val));
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TYPED_LINKED_LIST_H_
+#define TYPED_LINKED_LIST_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * Define a linked list type Name of T values and its functions.
+ *
+ * @param Name the name of the list type
+ * @param T the value type
+ */
+#define DEFINE_LINKED_LIST(Name, T) \
+\
+/** Linked node data structure */ \
+typedef struct Name##Node { \
+    /** The node value */ \
+    T val; \
+    /** The next node */ \
+    struct Name##Node *next; \
+} Name##Node; \
+\
+/** Linked List data structure */ \
+typedef struct { \
+    /** The dummy head node of the linked node chain */ \
+    Name##Node *head; \
+    /** The size of the linked list */ \
+    size_t size; \
+    /** The maximum capacity of the linked list */ \
+    size_t maxCapacity; \
+} Name; \
+\
+/* Returns the node k nodes after node, or NULL if there is none. */ \
+static inline Name##Node *get##Name##NodeAt(Name##Node *node, size_t k) { \
+    for (; node != NULL && k > 0; k--) { \
+        node = node->next; \
+    } \
+    return node; \
+} \
+\
+/* Create and initialize a new linked list. */ \
+static inline Name *new##Name(size_t maxCapacity) { \
+    Name *list = malloc(sizeof(Name)); \
+    list->size = 0; \
+    list->maxCapacity = maxCapacity; \
+    list->head = malloc(sizeof(Name##Node));  /* dummy node */ \
+    list->head->next = NULL; \
+    return list; \
+} \
+\
+/* Add value to list at index; false if index out of bounds or \
+   exceeds max capacity. */ \
+static inline bool add##Name##ValAt(Name *list, size_t index, T val) { \
+    if (list->size == list->maxCapacity || index > list->size) { \
+        return false; \
+    } \
+    /* find node to insert after */ \
+    Name##Node *node = get##Name##NodeAt(list->head, index); \
+    Name##Node *newNode = malloc(sizeof(Name##Node)); \
+    newNode->val = val; \
+    newNode->next = node->next; \
+    node->next = newNode; \
+    list->size++; \
+    return true; \
+} \
+\
+/* Add value to start of list. */ \
+static inline bool addFirst##Name##Val(Name *list, T val) { \
+    return add##Name##ValAt(list, 0, val); \
+} \
+\
+/* Add value to end of list. */ \
+static inline bool addLast##Name##Val(Name *list, T val) { \
+    return add##Name##ValAt(list, list->size, val); \
+} \
+\
+/* Get value at index; false if index out of bounds. */ \
+static inline bool get##Name##ValAt(Name *list, size_t index, T *val) { \
+    if (index < list->size) { \
+        *val = get##Name##NodeAt(list->head->next, index)->val; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Get value at first index; false if list is empty. */ \
+static inline bool getFirst##Name##Val(Name *list, T *val) { \
+    return get##Name##ValAt(list, 0, val); \
+} \
+\
+/* Get value at last index; false if list is empty. */ \
+static inline bool getLast##Name##Val(Name *list, T *val) { \
+    return (list->size > 0) && get##Name##ValAt(list, list->size-1, val); \
+} \
+\
+/* Set value at index; false if index out of bounds. */ \
+static inline bool set##Name##ValAt(Name *list, size_t index, T val) { \
+    if (index < list->size) { \
+        get##Name##NodeAt(list->head->next, index)->val = val; \
+        return true; \
+    } \
+    return false; \
+} \
+\
+/* Set value at first index; false if list is empty. */ \
+static inline bool setFirst##Name##Val(Name *list, T val) { \
+    return set##Name##ValAt(list, 0, val); \
+} \
+\
+/* Set value at last index; false if list is empty. */ \
+static inline bool setLast##Name##Val(Name *list, T val) { \
+    return (list->size > 0) && set##Name##ValAt(list, list->size-1, val); \
+} \
+\
+/* Returns number of items in the list. */ \
+static inline size_t Name##Size(Name *list) { \
+    return list->size; \
+} \
+\
+/* Determines whether list is empty. */ \
+static inline bool is##Name##Empty(Name *list) { \
+    return list->size == 0; \
+} \
+\
+/* Delete the value at index; false if index out of bounds. */ \
+static inline bool delete##Name##ValAt(Name *list, size_t index) { \
+    if (index >= list->size) { \
+        return false; \
+    } \
+    /* find node before the one to delete */ \
+    Name##Node *node = get##Name##NodeAt(list->head, index); \
+    Name##Node *oldNode = node->next; \
+    node->next = oldNode->next; \
+    free(oldNode); \
+    list->size--; \
+    return true; \
+} \
+\
+/* Delete the first value; false if list is empty. */ \
+static inline bool deleteFirst##Name##Val(Name *list) { \
+    return delete##Name##ValAt(list, 0); \
+} \
+\
+/* Delete the last value; false if list is empty. */ \
+static inline bool deleteLast##Name##Val(Name *list) { \
+    return (list->size > 0) && delete##Name##ValAt(list, list->size-1); \
+} \
+\
+/* Deletes all list values. */ \
+static inline void deleteAll##Name##Vals(Name *list) { \
+    Name##Node *node = list->head->next; \
+    while (node != NULL) { \
+        Name##Node *next = node->next; \
+        free(node); \
+        node = next; \
+    } \
+    list->head->next = NULL; \
+    list->size = 0; \
+} \
+\
+/* Delete the list. */ \
+static inline void delete##Name(Name *list) { \
+    deleteAll##Name##Vals(list); \
+    free(list->head); \
+    /* set fields to safe values */ \
+    list->head = NULL; \
+    list->maxCapacity = 0; \
+    free(list); \
+} \
+\
+/* Print the list using a function that prints one value. */ \
+static inline void print##Name(Name *list, void (*printVal)(T val)) { \
+    printf("( "); \
+    for (Name##Node *node = list->head->next; node != NULL; node = node->next) { \
+        printVal(node->val); \
+        printf(" "); \
+    } \
+    printf(")\n"); \
+}
+
+#endif /* TYPED_LINKED_LIST_H_ */
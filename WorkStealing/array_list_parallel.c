@@ -0,0 +1,203 @@
+/**
+ * @file array_list_parallel.c
+ *
+ * Implementation for bulk ArrayList operations that run on a TaskPool.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "array_list.h"
+#include "array_list_parallel.h"
+#include "task_pool.h"
+
+/** Below this many values, the sort uses insertion sort */
+#define SORT_INSERTION_LIMIT 16
+
+/** Below this many values, the sort does not fork */
+#define SORT_LEAF 4096
+
+/** Arguments of a sort task */
+typedef struct {
+    /** the pool, or NULL to sort serially */
+    TaskPool *pool;
+    /** the values to sort */
+    char **vals;
+    /** scratch space for the values */
+    char **tmp;
+    /** the number of values */
+    size_t count;
+    /** the comparison function */
+    ArrayListCompareFn cmp;
+} SortArg;
+
+/** Context of a bulk load */
+typedef struct {
+    /** where the copies go */
+    char **dest;
+    /** the values to copy */
+    const char **vals;
+    /** set if a copy failed */
+    atomic_bool failed;
+} LoadContext;
+
+/**
+ * Sort a few values with insertion sort.
+ *
+ * @param vals the values
+ * @param count the number of values
+ * @param cmp the comparison function
+ */
+static void insertionSort(char **vals, size_t count, ArrayListCompareFn cmp) {
+    for (size_t i = 1; i < count; i++) {
+        char *val = vals[i];
+        size_t j = i;
+        for (; j > 0 && cmp(vals[j-1], val) > 0; j--) {
+            vals[j] = vals[j-1];
+        }
+        vals[j] = val;
+    }
+}
+
+/**
+ * Merge sort a range of values, forking the lower half above the
+ * leaf size. The merge itself is serial.
+ *
+ * @param arg the SortArg
+ */
+static void sortTask(void *arg) {
+    SortArg *sa = arg;
+    if (sa->count <= SORT_INSERTION_LIMIT) {
+        insertionSort(sa->vals, sa->count, sa->cmp);
+        return;
+    }
+    size_t half = sa->count / 2;
+    SortArg lower = { sa->pool, sa->vals, sa->tmp, half, sa->cmp };
+    SortArg upper = { sa->pool, sa->vals + half, sa->tmp + half, sa->count - half, sa->cmp };
+    if (sa->pool != NULL && sa->count > SORT_LEAF) {
+        Task task;
+        spawnTask(sa->pool, &task, sortTask, &lower);
+        sortTask(&upper);
+        waitTask(sa->pool, &task);
+    } else {
+        sortTask(&lower);
+        sortTask(&upper);
+    }
+
+    // halves already in order
+    if (sa->cmp(sa->vals[half-1], sa->vals[half]) <= 0) {
+        return;
+    }
+    // only the lower half needs moving out of the way
+    memcpy(sa->tmp, sa->vals, half * sizeof(char*));
+    size_t i = 0, j = half, k = 0;
+    while (i < half && j < sa->count) {
+        // take from the lower half on ties to keep the sort stable
+        if (sa->cmp(sa->tmp[i], sa->vals[j]) <= 0) {
+            sa->vals[k++] = sa->tmp[i++];
+        } else {
+            sa->vals[k++] = sa->vals[j++];
+        }
+    }
+    while (i < half) {
+        sa->vals[k++] = sa->tmp[i++];
+    }
+}
+
+/**
+ * Sort the list with a stable parallel merge sort.
+ *
+ * @param pool the TaskPool, or NULL for the default pool
+ * @param list the ArrayList
+ * @param cmp the comparison function
+ * @return false if out of memory, leaving the list unchanged
+ */
+bool sortArrayListParallel(TaskPool *pool, ArrayList *list, ArrayListCompareFn cmp) {
+    if (list->size < 2) {
+        return true;
+    }
+    if (pool == NULL && (pool = getDefaultTaskPool()) == NULL) {
+        return false;
+    }
+    char **tmp = malloc(list->size * sizeof(char*));
+    if (tmp == NULL) {
+        return false;
+    }
+    SortArg sa = { pool, list->vals, tmp, list->size, cmp };
+    runTaskPool(pool, sortTask, &sa);
+    free(tmp);
+    return true;
+}
+
+/**
+ * Copy a subrange of the values of a bulk load.
+ *
+ * @param ctx the LoadContext
+ * @param begin the first index
+ * @param end one past the last index
+ */
+static void loadRange(void *ctx, size_t begin, size_t end) {
+    LoadContext *lc = ctx;
+    for (size_t i = begin; i < end; i++) {
+        // must copy input string
+        lc->dest[i] = strdup(lc->vals[i]);
+        if (lc->dest[i] == NULL) {
+            atomic_store_explicit(&lc->failed, true, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Add copies of values to the end of the list, copying them in
+ * parallel.
+ *
+ * @param pool the TaskPool, or NULL for the default pool
+ * @param list the ArrayList
+ * @param vals the values
+ * @param count the number of values
+ * @return false if the list would exceed its maximum capacity or
+ *   out of memory, leaving the list unchanged
+ */
+bool addAllArrayListValsParallel(TaskPool *pool, ArrayList *list,
+                                 const char *vals[], size_t count) {
+    if (count > list->maxCapacity - list->size) {
+        return false;
+    }
+    if (pool == NULL && (pool = getDefaultTaskPool()) == NULL) {
+        return false;
+    }
+
+    // grow once to the final size
+    size_t newSize = list->size + count;
+    if (newSize > list->capacity) {
+        char **newVals = realloc(list->vals, newSize * sizeof(char*));
+        if (newVals == NULL) { // not enough memory to reallocate
+            return false;
+        }
+        // initialize new memory to NULL
+        for (size_t i = list->capacity; i < newSize; i++) {
+            newVals[i] = NULL;
+        }
+        list->capacity = newSize;
+        list->vals = newVals;
+    }
+
+    LoadContext lc;
+    lc.dest = list->vals + list->size;
+    lc.vals = vals;
+    atomic_init(&lc.failed, false);
+    parallelForTaskPool(pool, 0, count, 0, loadRange, &lc);
+
+    if (atomic_load(&lc.failed)) {
+        for (size_t i = 0; i < count; i++) {
+            free(lc.dest[i]);  // free ok with NULL
+            lc.dest[i] = NULL;
+        }
+        return false;
+    }
+    list->size = newSize;
+    return true;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file array_list_parallel.h
+ *
+ * Declarations for bulk ArrayList operations that run on a TaskPool.
+ *
+ * The sort is a stable merge sort of the value pointers; the values
+ * themselves are never copied. The bulk load grows the list once and
+ * copies the new values in parallel.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef ARRAY_LIST_PARALLEL_H_
+#define ARRAY_LIST_PARALLEL_H_
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "array_list.h"
+#include "task_pool.h"
+
+/** Compares two values: negative, 0 or positive as for strcmp */
+typedef int (*ArrayListCompareFn)(const char *val1, const char *val2);
+
+/**
+ * Sort the list with a stable parallel merge sort.
+ *
+ * @param pool the TaskPool, or NULL for the default pool
+ * @param list the ArrayList
+ * @param cmp the comparison function
+ * @return false if out of memory, leaving the list unchanged
+ */
+bool sortArrayListParallel(TaskPool *pool, ArrayList *list, ArrayListCompareFn cmp);
+
+/**
+ * Add copies of values to the end of the list, copying them in
+ * parallel.
+ *
+ * @param pool the TaskPool, or NULL for the default pool
+ * @param list the ArrayList
+ * @param vals the values
+ * @param count the number of values
+ * @return false if the list would exceed its maximum capacity or
+ *   out of memory, leaving the list unchanged
+ */
+bool addAllArrayListValsParallel(TaskPool *pool, ArrayList *list,
+                                 const char *vals[], size_t count);
+
+#endif /* ARRAY_LIST_PARALLEL_H_ */
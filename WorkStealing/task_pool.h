@@ -0,0 +1,232 @@
+/**
+ * @file task_pool.h
+ *
+ * Declarations for a fork-join thread pool built on work-stealing
+ * deques.
+ *
+ * Each worker thread owns a WorkStealingDeque. A task spawned by a
+ * worker goes on the bottom of its own deque, and the worker runs
+ * its own tasks newest first. A worker with nothing to do steals
+ * the oldest task from a random other worker, and so takes the
+ * largest pieces of work. A worker that waits for a task runs other
+ * tasks until it is done. Tasks submitted from outside the pool go
+ * on a shared submission queue.
+ *
+ * Tasks are owned by the caller and are usually local variables of
+ * the spawning function, which must wait for them before it returns.
+ * A TaskGroup waits for any number of tasks at once, and
+ * parallelForTaskPool splits an index range into tasks.
+ *
+ * A worker that finds no work for a while parks on a WaitEvent, so
+ * an idle pool uses no CPU. Spawning a task wakes a parked worker;
+ * while no worker is parked this costs a fence and a load.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef TASK_POOL_H_
+#define TASK_POOL_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "wait_event.h"
+#include "work_stealing_deque.h"
+
+/** Function run by a task */
+typedef void (*TaskFn)(void *arg);
+
+/** Function run on a subrange [begin, end) of a parallel loop */
+typedef void (*RangeFn)(void *ctx, size_t begin, size_t end);
+
+/** Group of tasks that are waited for together */
+typedef struct {
+    /** Number of tasks spawned and not yet done */
+    atomic_size_t pending;
+} TaskGroup;
+
+/** Task data structure */
+typedef struct Task {
+    /** The function to run */
+    TaskFn fn;
+    /** The argument to the function */
+    void *arg;
+    /** Set once the function has returned */
+    atomic_bool done;
+    /** The group the task belongs to, or NULL */
+    TaskGroup *group;
+    /** Set if spawned from outside the pool, so its waiter may park */
+    bool external;
+    /** The next task in the submission queue */
+    struct Task *next;
+} Task;
+
+struct TaskPool;
+
+/** Worker thread state, on its own cache lines */
+typedef struct {
+    /** The pool */
+    _Alignas(WS_CACHE_LINE) struct TaskPool *pool;
+    /** The worker's deque */
+    WorkStealingDeque *deque;
+    /** The worker thread */
+    pthread_t thread;
+    /** Random state for choosing victims; never 0 */
+    uint64_t randomState;
+    /** Number of tasks run by this worker */
+    atomic_size_t executed;
+    /** Number of tasks this worker stole */
+    atomic_size_t steals;
+} TaskWorker;
+
+/** Task pool data structure */
+typedef struct TaskPool {
+    /** Number of workers */
+    int numWorkers;
+    /** The workers */
+    TaskWorker *workers;
+    /** Protects the submission queue */
+    pthread_mutex_t submitLock;
+    /** First task submitted from outside the pool */
+    Task *submitHead;
+    /** Last task submitted from outside the pool */
+    Task *submitTail;
+    /** Number of tasks in the submission queue */
+    atomic_size_t submitted;
+    /** Set to stop the workers */
+    atomic_bool stop;
+    /** Parked workers wait here for new tasks */
+    WaitEvent workAvailable;
+    /** Threads outside the pool wait here for their tasks */
+    WaitEvent taskDone;
+} TaskPool;
+
+/**
+ * Create a task pool and start its workers.
+ *
+ * @param numWorkers the number of worker threads; 0 or less for
+ *   the TASK_POOL_WORKERS environment variable if set, else one
+ *   per online processor
+ * @return the allocated task pool, or NULL if out of memory
+ */
+TaskPool *newTaskPool(int numWorkers);
+
+/**
+ * Returns the shared default pool, creating it with newTaskPool(0)
+ * on first use. The default pool is never deleted.
+ *
+ * @return the default pool, or NULL if out of memory
+ */
+TaskPool *getDefaultTaskPool(void);
+
+/**
+ * Spawn a task that runs fn(arg). From a worker the task goes on
+ * the worker's own deque; from another thread it is submitted to
+ * the pool. The task must be waited for with waitTask.
+ *
+ * @param pool the TaskPool
+ * @param task the task; must stay valid until waited for
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void spawnTask(TaskPool *pool, Task *task, TaskFn fn, void *arg);
+
+/**
+ * Wait for a spawned task to finish. A worker runs other tasks
+ * while it waits.
+ *
+ * @param pool the TaskPool
+ * @param task the task
+ */
+void waitTask(TaskPool *pool, Task *task);
+
+/**
+ * Run fn(arg) in the pool and wait for it to finish. From a worker
+ * fn is called directly.
+ *
+ * @param pool the TaskPool
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void runTaskPool(TaskPool *pool, TaskFn fn, void *arg);
+
+/**
+ * Initialize an empty task group.
+ *
+ * @param group the TaskGroup
+ */
+void initTaskGroup(TaskGroup *group);
+
+/**
+ * Spawn a task that runs fn(arg) as part of a group. The task is
+ * waited for with waitTaskGroup rather than waitTask.
+ *
+ * @param pool the TaskPool
+ * @param group the TaskGroup
+ * @param task the task; must stay valid until the group is waited for
+ * @param fn the function to run
+ * @param arg the argument to the function
+ */
+void spawnTaskGroup(TaskPool *pool, TaskGroup *group, Task *task, TaskFn fn, void *arg);
+
+/**
+ * Wait for every task spawned in a group to finish. A worker runs
+ * other tasks while it waits.
+ *
+ * @param pool the TaskPool
+ * @param group the TaskGroup
+ */
+void waitTaskGroup(TaskPool *pool, TaskGroup *group);
+
+/**
+ * Call fn(ctx, b, e) on subranges [b, e) that together cover
+ * [begin, end), in parallel, and wait for all of them. The range is
+ * split in halves until a piece is no longer than grain.
+ *
+ * @param pool the TaskPool
+ * @param begin the first index
+ * @param end one past the last index
+ * @param grain the largest subrange run as one call; 0 to choose
+ *   one from the range size and number of workers
+ * @param fn the function to call on each subrange
+ * @param ctx the context passed to fn
+ */
+void parallelForTaskPool(TaskPool *pool, size_t begin, size_t end, size_t grain,
+                         RangeFn fn, void *ctx);
+
+/**
+ * Returns the number of workers in the pool.
+ *
+ * @param pool the TaskPool
+ * @return the number of workers
+ */
+int taskPoolWorkers(TaskPool *pool);
+
+/**
+ * Get the total number of tasks run and stolen by the workers.
+ *
+ * @param pool the TaskPool
+ * @param executed result parameter for the number of tasks run
+ * @param steals result parameter for the number of tasks stolen
+ */
+void getTaskPoolStats(TaskPool *pool, size_t *executed, size_t *steals);
+
+/**
+ * Get the number of workers parked waiting for work.
+ *
+ * @param pool the TaskPool
+ * @return the number of parked workers
+ */
+int parkedTaskPoolWorkers(TaskPool *pool);
+
+/**
+ * Stop the workers and delete the pool. No tasks may be pending.
+ *
+ * @param pool the TaskPool
+ */
+void deleteTaskPool(TaskPool *pool);
+
+#endif /* TASK_POOL_H_ */
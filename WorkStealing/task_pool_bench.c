@@ -0,0 +1,282 @@
+/*
+ * @file task_pool_bench.c
+ *
+ * Benchmark of fork-join workloads on TaskPool with increasing
+ * numbers of workers, against the same computation run serially:
+ *
+ *   fib  - recursive Fibonacci, forking down to a cutoff
+ *   sum  - divide-and-conquer sum of a large array
+ *   sort - merge sort of an ArrayList of strings
+ *
+ * Also reports the startup time of a pool and the CPU time its
+ * workers use while idle.
+ *
+ * Usage: task_pool_bench [maxWorkers [fibN [sumSize [sortSize]]]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include "array_list.h"
+#include "array_list_parallel.h"
+#include "task_pool.h"
+
+/** Below this n, fib runs serially */
+#define FIB_CUTOFF 20
+
+/** Below this many elements, sum runs serially */
+#define SUM_LEAF 4096
+
+/** Arguments and result of a fib task */
+typedef struct {
+    /** the pool, or NULL to run serially */
+    TaskPool *pool;
+    /** the argument */
+    int n;
+    /** the result */
+    long result;
+} FibArg;
+
+/** Arguments and result of a sum task */
+typedef struct {
+    /** the pool, or NULL to run serially */
+    TaskPool *pool;
+    /** the values */
+    const double *vals;
+    /** the number of values */
+    size_t count;
+    /** the result */
+    double result;
+} SumArg;
+
+/**
+ * Compute a Fibonacci number serially.
+ *
+ * @param n the argument
+ * @return fib(n)
+ */
+static long fibSerial(int n) {
+    return (n < 2) ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+/**
+ * Compute a Fibonacci number, forking fib(n-1) above the cutoff.
+ *
+ * @param arg the FibArg
+ */
+static void fibTask(void *arg) {
+    FibArg *fa = arg;
+    if (fa->pool == NULL || fa->n < FIB_CUTOFF) {
+        fa->result = fibSerial(fa->n);
+        return;
+    }
+    FibArg left = { fa->pool, fa->n - 1, 0 };
+    FibArg right = { fa->pool, fa->n - 2, 0 };
+    Task task;
+    spawnTask(fa->pool, &task, fibTask, &left);
+    fibTask(&right);
+    waitTask(fa->pool, &task);
+    fa->result = left.result + right.result;
+}
+
+/**
+ * Sum an array, forking the first half above the leaf size.
+ *
+ * @param arg the SumArg
+ */
+static void sumTask(void *arg) {
+    SumArg *sa = arg;
+    if (sa->pool == NULL || sa->count <= SUM_LEAF) {
+        double sum = 0;
+        for (size_t i = 0; i < sa->count; i++) {
+            sum += sa->vals[i];
+        }
+        sa->result = sum;
+        return;
+    }
+    size_t half = sa->count / 2;
+    SumArg left = { sa->pool, sa->vals, half, 0 };
+    SumArg right = { sa->pool, sa->vals + half, sa->count - half, 0 };
+    Task task;
+    spawnTask(sa->pool, &task, sumTask, &left);
+    sumTask(&right);
+    waitTask(sa->pool, &task);
+    sa->result = left.result + right.result;
+}
+
+/**
+ * Returns the current time in milliseconds.
+ *
+ * @return the time
+ */
+static double nowMillis(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * Returns the CPU time used by the process in milliseconds.
+ *
+ * @return the time
+ */
+static double cpuMillis(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e3
+         + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e3;
+}
+
+/**
+ * Create an ArrayList of pseudo-random numeric strings.
+ *
+ * @param count the number of values
+ * @return the list
+ */
+static ArrayList *newRandomList(size_t count) {
+    ArrayList *list = newArrayList(count);
+    uint64_t state = 88172645463325252u;
+    for (size_t i = 0; i < count; i++) {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%llu", (unsigned long long)(state % 1000000000));
+        addLastArrayListVal(list, buf);
+    }
+    return list;
+}
+
+/**
+ * Sort a random list on a pool and time the sort.
+ *
+ * @param pool the pool
+ * @param count the number of values
+ * @return the time in milliseconds
+ */
+static double timeSort(TaskPool *pool, size_t count) {
+    ArrayList *list = newRandomList(count);
+    double start = nowMillis();
+    sortArrayListParallel(pool, list, strcmp);
+    double millis = nowMillis() - start;
+    for (size_t i = 1; i < count; i++) {
+        if (strcmp(list->vals[i-1], list->vals[i]) > 0) {
+            printf("sort out of order at %zu\n", i);
+            break;
+        }
+    }
+    deleteArrayList(list);
+    return millis;
+}
+
+/**
+ * Print one result row.
+ *
+ * @param name the workload name
+ * @param workers the number of workers, or 0 for serial
+ * @param millis the run time
+ * @param serialMillis the serial run time
+ * @param pool the pool, or NULL for serial
+ */
+static void printRow(const char *name, int workers, double millis, double serialMillis,
+                     TaskPool *pool) {
+    size_t executed = 0, steals = 0;
+    if (pool != NULL) {
+        getTaskPoolStats(pool, &executed, &steals);
+    }
+    printf("%-6s %8d %12.2f %8.2f %12zu %10zu\n",
+           name, workers, millis, serialMillis / millis, executed, steals);
+}
+
+/**
+ * Run the benchmark.
+ */
+int main(int argc, char *argv[]) {
+    int maxWorkers = (argc > 1) ? atoi(argv[1]) : 8;
+    int fibN = (argc > 2) ? atoi(argv[2]) : 36;
+    size_t sumSize = (argc > 3) ? strtoul(argv[3], NULL, 10) : 1 << 24;
+    size_t sortSize = (argc > 4) ? strtoul(argv[4], NULL, 10) : 1 << 20;
+
+    double *vals = malloc(sumSize * sizeof(double));
+    for (size_t i = 0; i < sumSize; i++) {
+        vals[i] = (double)(i % 1000);
+    }
+
+    printf("%-6s %8s %12s %8s %12s %10s\n",
+           "work", "workers", "time (ms)", "speedup", "tasks", "steals");
+
+    double start = nowMillis();
+    FibArg fa = { NULL, fibN, 0 };
+    fibTask(&fa);
+    double fibSerialMillis = nowMillis() - start;
+    long fibExpected = fa.result;
+    printRow("fib", 0, fibSerialMillis, fibSerialMillis, NULL);
+
+    start = nowMillis();
+    SumArg sa = { NULL, vals, sumSize, 0 };
+    sumTask(&sa);
+    double sumSerialMillis = nowMillis() - start;
+    double sumExpected = sa.result;
+    printRow("sum", 0, sumSerialMillis, sumSerialMillis, NULL);
+
+    // one worker that is never stolen from is the serial sort
+    TaskPool *serialPool = newTaskPool(1);
+    double sortSerialMillis = timeSort(serialPool, sortSize);
+    deleteTaskPool(serialPool);
+    printRow("sort", 0, sortSerialMillis, sortSerialMillis, NULL);
+
+    for (int workers = 1; workers <= maxWorkers; workers *= 2) {
+        TaskPool *pool = newTaskPool(workers);
+
+        start = nowMillis();
+        fa = (FibArg){ pool, fibN, 0 };
+        runTaskPool(pool, fibTask, &fa);
+        printRow("fib", workers, nowMillis() - start, fibSerialMillis, pool);
+        if (fa.result != fibExpected) {
+            printf("fib mismatch: %ld != %ld\n", fa.result, fibExpected);
+        }
+        deleteTaskPool(pool);
+
+        pool = newTaskPool(workers);
+        start = nowMillis();
+        sa = (SumArg){ pool, vals, sumSize, 0 };
+        runTaskPool(pool, sumTask, &sa);
+        printRow("sum", workers, nowMillis() - start, sumSerialMillis, pool);
+        if (sa.result != sumExpected) {
+            printf("sum mismatch: %f != %f\n", sa.result, sumExpected);
+        }
+        deleteTaskPool(pool);
+
+        pool = newTaskPool(workers);
+        double millis = timeSort(pool, sortSize);
+        printRow("sort", workers, millis, sortSerialMillis, pool);
+        deleteTaskPool(pool);
+        fflush(stdout);
+    }
+
+    printf("\n%8s %12s %16s\n", "workers", "start (ms)", "idle cpu (ms/s)");
+    for (int workers = 1; workers <= maxWorkers; workers *= 2) {
+        double start = nowMillis();
+        TaskPool *pool = newTaskPool(workers);
+        double startMillis = nowMillis() - start;
+        // let the workers park, then measure one idle second
+        struct timespec settle = { 0, 100000000 };
+        nanosleep(&settle, NULL);
+        double cpuStart = cpuMillis();
+        struct timespec idle = { 1, 0 };
+        nanosleep(&idle, NULL);
+        printf("%8d %12.3f %16.3f\n", workers, startMillis, cpuMillis() - cpuStart);
+        deleteTaskPool(pool);
+    }
+
+    free(vals);
+    return EXIT_SUCCESS;
+}
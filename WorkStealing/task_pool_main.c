@@ -0,0 +1,273 @@
+/*
+ * @file task_pool_main.c
+ *
+ * Test program for WorkStealingDeque and TaskPool. Checks that the
+ * owner and thieves of a deque take every item exactly once,
+ * computes Fibonacci numbers with fork-join tasks, runs a task group
+ * and a parallel loop, checks that idle workers park, and sorts and
+ * bulk loads an ArrayList on the pool.
+ *
+ * Usage: task_pool_main [workers [items]]
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "array_list.h"
+#include "array_list_parallel.h"
+#include "task_pool.h"
+#include "work_stealing_deque.h"
+
+/** Number of thief threads in the deque test */
+#define THIEVES 3
+
+/** State shared by the deque owner and thieves */
+typedef struct {
+    /** the deque */
+    WorkStealingDeque *deque;
+    /** number of items the owner pushes */
+    size_t count;
+    /** number of times each item was taken */
+    atomic_uchar *taken;
+    /** set when the owner is done */
+    atomic_bool ownerDone;
+    /** number of items stolen */
+    atomic_size_t stolen;
+} DequeState;
+
+/**
+ * Thief thread that steals until the owner is done and the deque
+ * is empty.
+ *
+ * @param arg the deque state
+ * @return NULL
+ */
+static void *thief(void *arg) {
+    DequeState *ds = arg;
+    void *item;
+    while (!atomic_load(&ds->ownerDone) || !isWorkStealingDequeEmpty(ds->deque)) {
+        if (stealWorkStealingDeque(ds->deque, &item)) {
+            atomic_fetch_add(&ds->taken[(uintptr_t)item - 1], 1);
+            atomic_fetch_add(&ds->stolen, 1);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Owner pushes items, popping one for every two pushed, while
+ * thieves steal; then checks every item was taken once.
+ *
+ * @param count the number of items
+ */
+static void testDeque(size_t count) {
+    DequeState ds;
+    ds.deque = newWorkStealingDeque(2);  // small so it grows
+    ds.count = count;
+    ds.taken = calloc(count, sizeof(atomic_uchar));
+    atomic_init(&ds.ownerDone, false);
+    atomic_init(&ds.stolen, 0);
+
+    pthread_t thieves[THIEVES];
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_create(&thieves[t], NULL, thief, &ds);
+    }
+    void *item;
+    for (size_t i = 1; i <= count; i++) {
+        pushWorkStealingDeque(ds.deque, (void*)(uintptr_t)i);  // items are never null
+        if (i % 2 == 0 && popWorkStealingDeque(ds.deque, &item)) {
+            atomic_fetch_add(&ds.taken[(uintptr_t)item - 1], 1);
+        }
+    }
+    while (popWorkStealingDeque(ds.deque, &item)) {
+        atomic_fetch_add(&ds.taken[(uintptr_t)item - 1], 1);
+    }
+    atomic_store(&ds.ownerDone, true);
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_join(thieves[t], NULL);
+    }
+
+    size_t bad = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (atomic_load(&ds.taken[i]) != 1) {
+            bad++;
+        }
+    }
+    printf("%zu items, %zu stolen, %zu missing or duplicated\n",
+           count, atomic_load(&ds.stolen), bad);
+    free(ds.taken);
+    deleteWorkStealingDeque(ds.deque);
+}
+
+/** Arguments and result of a Fibonacci task */
+typedef struct {
+    /** the pool */
+    TaskPool *pool;
+    /** the argument */
+    int n;
+    /** the result */
+    long result;
+} FibArg;
+
+/**
+ * Compute a Fibonacci number by forking a task for fib(n-1) and
+ * computing fib(n-2) directly.
+ *
+ * @param arg the FibArg
+ */
+static void fibTask(void *arg) {
+    FibArg *fa = arg;
+    if (fa->n < 2) {
+        fa->result = fa->n;
+        return;
+    }
+    FibArg left = { fa->pool, fa->n - 1, 0 };
+    FibArg right = { fa->pool, fa->n - 2, 0 };
+    Task task;
+    spawnTask(fa->pool, &task, fibTask, &left);
+    fibTask(&right);
+    waitTask(fa->pool, &task);
+    fa->result = left.result + right.result;
+}
+
+/**
+ * Square each index of a subrange into an array.
+ *
+ * @param ctx the array
+ * @param begin the first index
+ * @param end one past the last index
+ */
+static void squareRange(void *ctx, size_t begin, size_t end) {
+    long *squares = ctx;
+    for (size_t i = begin; i < end; i++) {
+        squares[i] = (long)(i * i);
+    }
+}
+
+/**
+ * Compare two numeric strings by value.
+ *
+ * @param val1 the first value
+ * @param val2 the second value
+ * @return negative, 0 or positive as val1 is less, equal or greater
+ */
+static int compareNumbers(const char *val1, const char *val2) {
+    long n1 = atol(val1), n2 = atol(val2);
+    return (n1 > n2) - (n1 < n2);
+}
+
+/**
+ * Test functions.
+ */
+int main(int argc, char *argv[]) {
+    int workers = (argc > 1) ? atoi(argv[1]) : 4;
+    size_t items = (argc > 2) ? strtoul(argv[2], NULL, 10) : 200000;
+
+    printf("Single-threaded deque operations\n");
+    WorkStealingDeque *deque = newWorkStealingDeque(2);
+    for (uintptr_t i = 1; i <= 5; i++) {
+        pushWorkStealingDeque(deque, (void*)i);
+    }
+    void *item;
+    printf("size: %zu\n", workStealingDequeSize(deque));
+    popWorkStealingDeque(deque, &item);
+    printf("pop: %zu\n", (size_t)(uintptr_t)item);
+    stealWorkStealingDeque(deque, &item);
+    printf("steal: %zu\n", (size_t)(uintptr_t)item);
+    while (popWorkStealingDeque(deque, &item)) {
+        printf("pop: %zu\n", (size_t)(uintptr_t)item);
+    }
+    printf("empty? %s\n", isWorkStealingDequeEmpty(deque) ? "true" : "false");
+    deleteWorkStealingDeque(deque);
+
+    printf("\nOwner with %d thieves\n", THIEVES);
+    testDeque(items);
+
+    printf("\nFork-join Fibonacci with %d workers\n", workers);
+    TaskPool *pool = newTaskPool(workers);
+    for (int n = 10; n <= 25; n += 5) {
+        FibArg fa = { pool, n, 0 };
+        runTaskPool(pool, fibTask, &fa);
+        printf("fib(%d) = %ld\n", n, fa.result);
+    }
+    size_t executed, steals;
+    getTaskPoolStats(pool, &executed, &steals);
+    printf("tasks run: %zu, stolen: %zu\n", executed, steals);
+
+    printf("\nTask group of 8 Fibonacci tasks\n");
+    TaskGroup group;
+    initTaskGroup(&group);
+    Task tasks[8];
+    FibArg args[8];
+    for (int t = 0; t < 8; t++) {
+        args[t] = (FibArg){ pool, 10 + t, 0 };
+        spawnTaskGroup(pool, &group, &tasks[t], fibTask, &args[t]);
+    }
+    waitTaskGroup(pool, &group);
+    for (int t = 0; t < 8; t++) {
+        printf("fib(%d) = %ld\n", args[t].n, args[t].result);
+    }
+
+    printf("\nParallel loop over %zu indexes\n", items);
+    long *squares = calloc(items, sizeof(long));
+    parallelForTaskPool(pool, 0, items, 0, squareRange, squares);
+    size_t wrong = 0;
+    for (size_t i = 0; i < items; i++) {
+        if (squares[i] != (long)(i * i)) {
+            wrong++;
+        }
+    }
+    printf("%zu wrong\n", wrong);
+    free(squares);
+
+    printf("\nIdle workers park\n");
+    struct timespec pause = { 0, 200000000 };
+    nanosleep(&pause, NULL);
+    printf("parked: %d of %d\n", parkedTaskPoolWorkers(pool), taskPoolWorkers(pool));
+    FibArg fa = { pool, 20, 0 };
+    runTaskPool(pool, fibTask, &fa);
+    printf("fib(20) after waking = %ld\n", fa.result);
+
+    printf("\nParallel bulk load and sort of an ArrayList\n");
+    size_t count = items;
+    char **vals = malloc(count * sizeof(char*));
+    for (size_t i = 0; i < count; i++) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%zu", (i * 7919) % count);  // a permutation
+        vals[i] = strdup(buf);
+    }
+    ArrayList *list = newArrayList(count);
+    bool loaded = addAllArrayListValsParallel(pool, list, (const char **)vals, count);
+    printf("loaded: %s, size: %zu\n", loaded ? "true" : "false", arrayListSize(list));
+    printf("load past maxCapacity: %s\n",
+           addAllArrayListValsParallel(pool, list, (const char **)vals, 1) ? "true" : "false");
+    sortArrayListParallel(pool, list, compareNumbers);
+    size_t unsorted = 0;
+    for (size_t i = 0; i < arrayListSize(list); i++) {
+        const char *val;
+        getArrayListValAt(list, i, &val);
+        if (atol(val) != (long)i) {
+            unsorted++;
+        }
+    }
+    printf("%zu out of place\n", unsorted);
+    deleteArrayList(list);
+    for (size_t i = 0; i < count; i++) {
+        free(vals[i]);
+    }
+    free(vals);
+    deleteTaskPool(pool);
+
+    printf("\nDefault pool: %d workers\n", taskPoolWorkers(getDefaultTaskPool()));
+
+    printf("program exiting\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file wait_event.c
+ *
+ * Implementation for a wait event.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <time.h>
+#ifdef __linux__
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <pthread.h>
+#endif
+#include "wait_event.h"
+
+/**
+ * Initialize a wait event.
+ *
+ * @param event the wait event
+ */
+void initWaitEvent(WaitEvent *event) {
+    atomic_init(&event->seq, 0);
+    atomic_init(&event->waiters, 0);
+#ifndef __linux__
+    pthread_mutex_init(&event->lock, NULL);
+    pthread_cond_init(&event->cond, NULL);
+#endif
+}
+
+/**
+ * Destroy a wait event. No thread may be waiting.
+ *
+ * @param event the wait event
+ */
+void destroyWaitEvent(WaitEvent *event) {
+#ifndef __linux__
+    pthread_cond_destroy(&event->cond);
+    pthread_mutex_destroy(&event->lock);
+#else
+    (void)event;  // nothing to release for a futex
+#endif
+}
+
+/**
+ * Register the calling thread as a waiter. Must be called before the
+ * thread checks its condition, and be followed by endWaitEvent.
+ *
+ * @param event the wait event
+ * @return the sequence to pass to awaitWaitEvent
+ */
+unsigned beginWaitEvent(WaitEvent *event) {
+    // register before reading seq so a notifier that misses us
+    // has already bumped seq (both seq_cst)
+    atomic_fetch_add(&event->waiters, 1);
+    return atomic_load(&event->seq);
+}
+
+/**
+ * Compute the time left until a deadline.
+ *
+ * @param deadline the CLOCK_MONOTONIC deadline
+ * @param remaining result parameter for the time left
+ * @return false if the deadline has passed
+ */
+static bool timeUntil(const struct timespec *deadline, struct timespec *remaining) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    remaining->tv_sec = deadline->tv_sec - now.tv_sec;
+    remaining->tv_nsec = deadline->tv_nsec - now.tv_nsec;
+    if (remaining->tv_nsec < 0) {
+        remaining->tv_sec--;
+        remaining->tv_nsec += 1000000000;
+    }
+    return remaining->tv_sec >= 0 && (remaining->tv_sec > 0 || remaining->tv_nsec > 0);
+}
+
+/**
+ * Sleep until the event is notified after seq was read, or until
+ * the deadline passes. May return early spuriously. The caller
+ * must check its condition again after this returns.
+ *
+ * @param event the wait event
+ * @param seq the sequence returned by beginWaitEvent; updated to
+ *   the current sequence on return
+ * @param deadline the CLOCK_MONOTONIC deadline, or NULL for none
+ * @return false if the deadline has passed
+ */
+bool awaitWaitEvent(WaitEvent *event, unsigned *seq, const struct timespec *deadline) {
+    struct timespec remaining;
+    if (deadline != NULL && !timeUntil(deadline, &remaining)) {
+        return false;
+    }
+
+#ifdef __linux__
+    // sleeps only if seq is unchanged; futex timeout is relative
+    syscall(SYS_futex, &event->seq, FUTEX_WAIT_PRIVATE, *seq,
+            (deadline != NULL) ? &remaining : NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&event->lock);
+    if (atomic_load(&event->seq) == *seq) {
+        if (deadline == NULL) {
+            pthread_cond_wait(&event->cond, &event->lock);
+        } else {
+            // condition variables time out on the realtime clock
+            struct timespec abstime;
+            clock_gettime(CLOCK_REALTIME, &abstime);
+            abstime.tv_sec += remaining.tv_sec;
+            abstime.tv_nsec += remaining.tv_nsec;
+            if (abstime.tv_nsec >= 1000000000) {
+                abstime.tv_sec++;
+                abstime.tv_nsec -= 1000000000;
+            }
+            pthread_cond_timedwait(&event->cond, &event->lock, &abstime);
+        }
+    }
+    pthread_mutex_unlock(&event->lock);
+#endif
+
+    *seq = atomic_load(&event->seq);
+    return deadline == NULL || timeUntil(deadline, &remaining);
+}
+
+/**
+ * Unregister the calling thread as a waiter.
+ *
+ * @param event the wait event
+ */
+void endWaitEvent(WaitEvent *event) {
+    atomic_fetch_sub(&event->waiters, 1);
+}
+
+/**
+ * Notify waiters that the state changed. Makes no system call if
+ * no thread is waiting.
+ *
+ * @param event the wait event
+ * @param all true to wake all waiters, false to wake one
+ */
+void notifyWaitEvent(WaitEvent *event, bool all) {
+    // bump seq before reading waiters so a waiter we miss sees
+    // the new seq and does not sleep (both seq_cst)
+    atomic_fetch_add(&event->seq, 1);
+    if (atomic_load(&event->waiters) == 0) {
+        return;  // fast path: nobody to wake
+    }
+
+#ifdef __linux__
+    syscall(SYS_futex, &event->seq, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1,
+            NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&event->lock);
+    if (all) {
+        pthread_cond_broadcast(&event->cond);
+    } else {
+        pthread_cond_signal(&event->cond);
+    }
+    pthread_mutex_unlock(&event->lock);
+#endif
+}
+
+/**
+ * Compute the CLOCK_MONOTONIC deadline for a timeout.
+ *
+ * @param timeoutMillis the timeout in milliseconds
+ * @param deadline result parameter for the deadline
+ */
+void waitEventDeadline(long timeoutMillis, struct timespec *deadline) {
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeoutMillis / 1000;
+    deadline->tv_nsec += (timeoutMillis % 1000) * 1000000;
+    if (deadline->tv_nsec >= 1000000000) {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000;
+    }
+}
@@ -0,0 +1,221 @@
+/**
+ * @file work_stealing_deque.c
+ *
+ * Implementation for a Chase-Lev work-stealing deque, using the
+ * memory orders of Le, Pop, Cohen and Zappa Nardelli, "Correct and
+ * Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "work_stealing_deque.h"
+
+/**
+ * Allocate a circular array.
+ *
+ * @param capacity the capacity; a power of 2
+ * @return the array, or NULL if out of memory
+ */
+static WorkStealingArray *newWorkStealingArray(size_t capacity) {
+    WorkStealingArray *array = malloc(sizeof(WorkStealingArray) + capacity * sizeof(void*));
+    if (array != NULL) {
+        array->capacity = capacity;
+        array->previous = NULL;
+    }
+    return array;
+}
+
+/**
+ * Create a work-stealing deque.
+ *
+ * @param capacity the initial capacity; rounded up to a power of 2
+ * @return the allocated deque, or NULL if out of memory
+ */
+WorkStealingDeque *newWorkStealingDeque(size_t capacity) {
+    size_t arrayCapacity = 1;
+    while (arrayCapacity < capacity) {
+        arrayCapacity *= 2;
+    }
+
+    // aligned so each index is on its own cache line
+    WorkStealingDeque *deque = aligned_alloc(WS_CACHE_LINE, sizeof(WorkStealingDeque));
+    if (deque == NULL) {
+        return NULL;
+    }
+    WorkStealingArray *array = newWorkStealingArray(arrayCapacity);
+    if (array == NULL) {
+        free(deque);
+        return NULL;
+    }
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->array, array);
+    return deque;
+}
+
+/**
+ * Replace the array with one twice the size holding the same items.
+ * Owner only.
+ *
+ * @param deque the WorkStealingDeque
+ * @param array the current array
+ * @param top the top index
+ * @param bottom the bottom index
+ * @return the new array, or NULL if out of memory
+ */
+static WorkStealingArray *growWorkStealingDeque(WorkStealingDeque *deque, WorkStealingArray *array,
+                                                long long top, long long bottom) {
+    WorkStealingArray *newArray = newWorkStealingArray(array->capacity * 2);
+    if (newArray == NULL) {
+        return NULL;
+    }
+    size_t oldMask = array->capacity - 1;
+    size_t newMask = newArray->capacity - 1;
+    for (long long i = top; i < bottom; i++) {
+        void *item = atomic_load_explicit(&array->items[i & oldMask], memory_order_relaxed);
+        atomic_store_explicit(&newArray->items[i & newMask], item, memory_order_relaxed);
+    }
+    // keep the old array: a thief may have loaded it already
+    newArray->previous = array;
+    // release: thieves that load the new array see its items
+    atomic_store_explicit(&deque->array, newArray, memory_order_release);
+    return newArray;
+}
+
+/**
+ * Push an item onto the bottom of the deque. Owner only.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item the item; cannot be null
+ * @return false if the deque could not grow
+ */
+bool pushWorkStealingDeque(WorkStealingDeque *deque, void *item) {
+    long long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    long long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    if (bottom - top > (long long)array->capacity - 1) {
+        array = growWorkStealingDeque(deque, array, top, bottom);
+        if (array == NULL) {
+            return false;
+        }
+    }
+    atomic_store_explicit(&array->items[bottom & (array->capacity - 1)], item,
+                          memory_order_relaxed);
+    // release: a thief that sees the new bottom sees the item and
+    // everything the owner wrote before pushing it
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Pop the item at the bottom of the deque. Owner only.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item result parameter for the item
+ * @return false if the deque is empty
+ */
+bool popWorkStealingDeque(WorkStealingDeque *deque, void **item) {
+    long long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    // claim the bottom item before looking at top
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        // deque was empty; undo the claim
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *item = atomic_load_explicit(&array->items[bottom & (array->capacity - 1)],
+                                 memory_order_relaxed);
+    if (top == bottom) {
+        // last item: race thieves for it
+        bool won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                           memory_order_seq_cst,
+                                                           memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+/**
+ * Steal the item at the top of the deque. Any thread.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item result parameter for the item
+ * @return false if the deque is empty or another thread took
+ *   the item first
+ */
+bool stealWorkStealingDeque(WorkStealingDeque *deque, void **item) {
+    long long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) {
+        return false;
+    }
+
+    WorkStealingArray *array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void *stolen = atomic_load_explicit(&array->items[top & (array->capacity - 1)],
+                                        memory_order_relaxed);
+    // the item is ours only if no one else advanced top
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        return false;
+    }
+    *item = stolen;
+    return true;
+}
+
+/**
+ * Returns number of items in the deque. The result may be out of
+ * date if other threads are changing the deque.
+ *
+ * @param deque the WorkStealingDeque
+ * @return the number of items in the deque
+ */
+size_t workStealingDequeSize(WorkStealingDeque *deque) {
+    long long top = atomic_load(&deque->top);
+    long long bottom = atomic_load(&deque->bottom);
+    // bottom is briefly below top while the owner pops from empty
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+/**
+ * Determines whether deque is empty. The result may be out of
+ * date if other threads are changing the deque.
+ *
+ * @param deque the WorkStealingDeque
+ * @return true if deque is empty, false otherwise
+ */
+bool isWorkStealingDequeEmpty(WorkStealingDeque *deque) {
+    return workStealingDequeSize(deque) == 0;
+}
+
+/**
+ * Delete the deque and all of its arrays. Does not free the items.
+ * No thread may be using the deque.
+ *
+ * @param deque the WorkStealingDeque
+ */
+void deleteWorkStealingDeque(WorkStealingDeque *deque) {
+    WorkStealingArray *array = atomic_load(&deque->array);
+    while (array != NULL) {
+        WorkStealingArray *previous = array->previous;
+        free(array);
+        array = previous;
+    }
+
+    // set fields to safe values
+    atomic_store(&deque->array, NULL);
+
+    // free the deque itself
+    free(deque);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file work_stealing_deque.h
+ *
+ * Declarations for a Chase-Lev work-stealing deque.
+ *
+ * The deque has the shape of ArrayDeque used as a stack by one
+ * thread and as a queue by others. The owner thread pushes and pops
+ * items at the bottom without locks; any other thread may steal the
+ * item at the top with a compare-and-swap. Only a pop of the last
+ * item races with thieves, and it too resolves the race with a CAS
+ * on the top index.
+ *
+ * Items live in a circular array whose capacity is a power of 2.
+ * When the owner pushes onto a full array it copies the items into
+ * an array twice the size and publishes it. Thieves may still be
+ * reading the old array, so old arrays are kept until the deque is
+ * deleted; their total size is less than that of the current array.
+ *
+ *  @date Oct 18, 2026
+ *  @author: Nam H. Nguyen
+ */
+
+#ifndef WORK_STEALING_DEQUE_H_
+#define WORK_STEALING_DEQUE_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/** Size of a cache line */
+#define WS_CACHE_LINE 64
+
+/** Circular array of items */
+typedef struct WorkStealingArray {
+    /** Capacity of the array; a power of 2 */
+    size_t capacity;
+    /** The array this one replaced, kept for thieves */
+    struct WorkStealingArray *previous;
+    /** The items */
+    _Atomic(void*) items[];
+} WorkStealingArray;
+
+/** Work-stealing deque data structure */
+typedef struct {
+    /** Index of the top item; advanced by thieves and the owner */
+    _Alignas(WS_CACHE_LINE) atomic_llong top;
+    /** Index one past the bottom item; written by the owner */
+    _Alignas(WS_CACHE_LINE) atomic_llong bottom;
+    /** The current array */
+    _Alignas(WS_CACHE_LINE) _Atomic(WorkStealingArray*) array;
+} WorkStealingDeque;
+
+/**
+ * Create a work-stealing deque.
+ *
+ * @param capacity the initial capacity; rounded up to a power of 2
+ * @return the allocated deque, or NULL if out of memory
+ */
+WorkStealingDeque *newWorkStealingDeque(size_t capacity);
+
+/**
+ * Push an item onto the bottom of the deque. Owner only.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item the item; cannot be null
+ * @return false if the deque could not grow
+ */
+bool pushWorkStealingDeque(WorkStealingDeque *deque, void *item);
+
+/**
+ * Pop the item at the bottom of the deque. Owner only.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item result parameter for the item
+ * @return false if the deque is empty
+ */
+bool popWorkStealingDeque(WorkStealingDeque *deque, void **item);
+
+/**
+ * Steal the item at the top of the deque. Any thread.
+ *
+ * @param deque the WorkStealingDeque
+ * @param item result parameter for the item
+ * @return false if the deque is empty or another thread took
+ *   the item first
+ */
+bool stealWorkStealingDeque(WorkStealingDeque *deque, void **item);
+
+/**
+ * Returns number of items in the deque. The result may be out of
+ * date if other threads are changing the deque.
+ *
+ * @param deque the WorkStealingDeque
+ * @return the number of items in the deque
+ */
+size_t workStealingDequeSize(WorkStealingDeque *deque);
+
+/**
+ * Determines whether deque is empty. The result may be out of
+ * date if other threads are changing the deque.
+ *
+ * @param deque the WorkStealingDeque
+ * @return true if deque is empty, false otherwise
+ */
+bool isWorkStealingDequeEmpty(WorkStealingDeque *deque);
+
+/**
+ * Delete the deque and all of its arrays. Does not free the items.
+ * No thread may be using the deque.
+ *
+ * @param deque the WorkStealingDeque
+ */
+void deleteWorkStealingDeque(WorkStealingDeque *deque);
+
+#endif /* WORK_STEALING_DEQUE_H_ */